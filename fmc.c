@@ -21,9 +21,80 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fmc.h"
 #include "w9825g6kh.h"
+#include "w9825g6kh_flight.h"
+#include "w9825g6kh_part.h"
+#include "w9825g6kh_tlm.h"
 #include "stdio.h"
 /* USER CODE BEGIN 0 */
 
+/**
+  * @brief  Flight recorder recovery, memory tests, configuration and
+  *         partition map dump, run once SDRAM is usable
+  */
+static void FMC_SDRAM_PostInit(void)
+{
+    W9825G6KH_StatusTypeDef sdram_status;
+
+    /* Recover the flight recorder first: nothing below may write SDRAM
+     * before the previous session's tail has been read */
+    if (W9825G6KH_Flight_Init() == W9825G6KH_OK) {
+        W9825G6KH_Flight_Dump(32);
+    }
+
+    /* Attribute driver traffic to partitions from here on */
+    (void)W9825G6KH_Part_Init();
+
+    /* Test results and configuration also go out as binary frames on ITM
+     * port W9825G6KH_TLM_ITM_PORT (w9825g6kh_tlm_decode.py --itm 1) */
+    (void)W9825G6KH_Tlm_Init(W9825G6KH_TLM_SINK_ITM, NULL, 0U);
+
+    /* Optional: Run a memory test */
+    sdram_status = W9825G6KH_MemoryTest(W9825G6KH_PART_OFFSET(SELFTEST), 1024); /* Test first 1KB */
+    if (sdram_status != W9825G6KH_OK) {
+        printf("SDRAM Memory Test Failed!\r\n");
+    } else {
+        printf("SDRAM Memory Test Passed\r\n");
+    }
+    //********************************************************************************************
+    printf("Running SDRAM Memory Test...\n");
+    sdram_status = W9825G6KH_MemoryTest(W9825G6KH_PART_OFFSET(SELFTEST), W9825G6KH_PART_SIZE(SELFTEST)); /* Test first 4KB */
+    if (sdram_status != W9825G6KH_OK) {
+        printf("SDRAM Memory Test Failed!\r\n");
+        /* Don't necessarily error out, could be timing issue */
+    } else {
+        printf("SDRAM Memory Test Passed\r\n");
+    }
+
+    /* Test larger area if first test passes */
+    if (sdram_status == W9825G6KH_OK) {
+        sdram_status = W9825G6KH_MemoryTest(W9825G6KH_PART_OFFSET(SELFTEST_EXT), W9825G6KH_PART_SIZE(SELFTEST_EXT)); /* Test at 1MB offset */
+        if (sdram_status == W9825G6KH_OK) {
+            printf("Extended SDRAM Test Passed\r\n");
+        }
+    }
+
+    /* Dump configuration for debugging */
+    W9825G6KH_DumpConfig();
+    W9825G6KH_Part_PrintMap();
+}
+
+#if W9825G6KH_INIT_NONBLOCKING
+/**
+  * @brief  Completion of the non-blocking SDRAM initialization
+  * @note   Runs in the context that calls W9825G6KH_InitStep; drive the steps
+  *         from the main loop (or move the tests out) if that is a timer ISR
+  */
+void W9825G6KH_InitCpltCallback(W9825G6KH_StatusTypeDef status)
+{
+    if (status != W9825G6KH_OK) {
+        printf("SDRAM Init Failed: %s\r\n", W9825G6KH_StatusToString(status));
+        Error_Handler();
+    }
+
+    FMC_SDRAM_PostInit();
+}
+#endif
+
 /* USER CODE END 0 */
 
 SDRAM_HandleTypeDef hsdram1;
@@ -76,12 +147,22 @@ void MX_FMC_Init(void)
    Config.BurstType = W9825G6KH_MR_BURST_TYPE_SEQUENTIAL;
    Config.CASLatency = W9825G6KH_MR_CAS_LATENCY_3;
    Config.OperatingMode = W9825G6KH_MR_OPERATING_MODE_STANDARD;
-   //Config.WriteBurstMode = W9825G6KH_MR_WRITE_BURST_MODE_PROGRAMMED;
+   /* Boot setting; W9825G6KH_SetBurstMode changes burst length, write burst
+    * and FMC read burst later, W9825G6KH_Burst_Tune picks them by measurement */
    Config.WriteBurstMode = W9825G6KH_MR_WRITE_BURST_MODE_SINGLE;
 
    /* Calculate refresh rate for 100MHz SD clock (HCLK/2 = 100MHz) */
    Config.RefreshRate = W9825G6KH_CalculateRefreshRate(100, 64);
 
+#if W9825G6KH_INIT_NONBLOCKING
+   /* Bring-up continues in W9825G6KH_InitStep; other peripherals can start
+    * meanwhile. W9825G6KH_InitCpltCallback above runs the tests. */
+   sdram_status = W9825G6KH_InitStart(&hsdram1, &Config);
+   if (sdram_status != W9825G6KH_OK) {
+     printf("SDRAM Init Failed: %s\r\n", W9825G6KH_StatusToString(sdram_status));
+     Error_Handler();
+   }
+#else
    sdram_status = W9825G6KH_Init(&hsdram1, &Config);
 
    if (sdram_status != W9825G6KH_OK) {
@@ -99,39 +180,8 @@ void MX_FMC_Init(void)
 	   printf("  Refresh Rate: %lu\r\n", Config.RefreshRate);
    }
 
-   /* Optional: Run a memory test */
-   sdram_status = W9825G6KH_MemoryTest(0, 1024); /* Test first 1KB */
-   if (sdram_status != W9825G6KH_OK) {
-     printf("SDRAM Memory Test Failed!\r\n");
-   } else {
-     printf("SDRAM Memory Test Passed\r\n");
-   }
-   //********************************************************************************************
-   printf("Running SDRAM Memory Test...\n");
-   sdram_status = W9825G6KH_MemoryTest(0x00000000, 4096); /* Test first 4KB */
-   if (sdram_status != W9825G6KH_OK) {
-       printf("SDRAM Memory Test Failed!\r\n");
-       /* Don't necessarily error out, could be timing issue */
-   } else {
-       printf("SDRAM Memory Test Passed\r\n");
-   }
-
-   /* Test larger area if first test passes */
-   if (sdram_status == W9825G6KH_OK) {
-       sdram_status = W9825G6KH_MemoryTest(0x00100000, 4096); /* Test at 1MB offset */
-       if (sdram_status == W9825G6KH_OK) {
-           printf("Extended SDRAM Test Passed\r\n");
-       }
-   }
-
-   /* Dump configuration for debugging */
-   W9825G6KH_DumpConfig();
-
-  //***********************************************************************************************
-
-
-
-
+   FMC_SDRAM_PostInit();
+#endif
 
   /* USER CODE END FMC_Init 2 */
 }
@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    hal_stub.c
+  * @brief   Host stand-ins for the HAL/CMSIS pieces used by the tests in tests/
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The driver keeps CPU addresses in uint32_t (W9825G6KH_BANK_ADDR +
+  * offset), so the SDRAM window must sit below 4 GB at its real address.
+  * A constructor maps W9825G6KH_SIZE_BYTES of anonymous memory at
+  * 0xC0000000 with MAP_FIXED_NOREPLACE and exits if that range is taken.
+  * Linux only.
+  *
+  * DWT->CYCCNT follows CLOCK_MONOTONIC in nanoseconds, SystemCoreClock is
+  * 1 GHz to match. PRIMASK is a plain variable: code that relies on
+  * masking interrupts must stay single-threaded on the host.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "w9825g6kh.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+
+/* Private variables ---------------------------------------------------------*/
+static DWT_Type host_dwt;
+static uint32_t host_primask;
+
+uint32_t SystemCoreClock = 1000000000U;
+
+/* Private functions ---------------------------------------------------------*/
+
+__attribute__((constructor)) static void HostStub_MapSdram(void)
+{
+    void *p = mmap((void *)(uintptr_t)W9825G6KH_BANK_ADDR, W9825G6KH_SIZE_BYTES, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p != (void *)(uintptr_t)W9825G6KH_BANK_ADDR) {
+        fprintf(stderr, "hal_stub: cannot map the SDRAM window at 0x%08lX\n", (unsigned long)W9825G6KH_BANK_ADDR);
+        exit(2);
+    }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+DWT_Type *HostStub_Dwt(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    host_dwt.CYCCNT = (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+    return &host_dwt;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return host_primask;
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+    host_primask = primask;
+}
+
+void __disable_irq(void)
+{
+    host_primask = 1U;
+}
+
+void __enable_irq(void)
+{
+    host_primask = 0U;
+}
+
+void Error_Handler(void)
+{
+    abort();
+}
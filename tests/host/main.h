@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @brief   Host stand-in for the CubeMX main.h: just the HAL/CMSIS names the
+  *          W9825G6KH headers and the host-tested modules use
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Only for the tests in tests/. hal_stub.c maps the SDRAM window at its
+  * real address (W9825G6KH_BANK_ADDR) and backs the few registers read.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/* HAL types used by the W9825G6KH prototypes --------------------------------*/
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+
+typedef struct {
+    uint32_t LoadToActiveDelay, ExitSelfRefreshDelay, SelfRefreshTime, RowCycleDelay;
+    uint32_t WriteRecoveryTime, RPDelay, RCDDelay;
+} FMC_SDRAM_TimingTypeDef;
+
+typedef struct {
+    uint32_t CommandMode, CommandTarget, AutoRefreshNumber, ModeRegisterDefinition;
+} FMC_SDRAM_CommandTypeDef;
+
+typedef struct {
+    void *Instance;
+} SDRAM_HandleTypeDef;
+
+#define FMC_SDRAM_CMD_TARGET_BANK1       0x10U
+
+/* CMSIS core ----------------------------------------------------------------*/
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+DWT_Type *HostStub_Dwt(void);
+#define DWT                              (HostStub_Dwt())   /* CYCCNT follows the host clock */
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+#define __DSB()                          __sync_synchronize()
+#define __DMB()                          __sync_synchronize()
+#define __ISB()                          __sync_synchronize()
+#define __weak                           __attribute__((weak))
+#define UNUSED(x)                        ((void)(x))
+
+extern uint32_t SystemCoreClock;
+
+void Error_Handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file    os_pthread.c
+  * @brief   Host test of the W9825G6KH OS abstraction on its pthreads backend:
+  *          recursive mutex, contention, semaphores and thread creation
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The zeroing, heap and slab layers take the driver mutex again from code
+  * that already holds it, and rely on it excluding every other task. This
+  * checks exactly that on the backend host builds use:
+  *
+  *  - Recursion: a mutex locked three times by one thread keeps another
+  *    thread out until the third unlock, then lets it in.
+  *  - Contention: threads created with OS_ThreadCreate update a plain
+  *    counter under a nested lock; no two are ever inside at once and no
+  *    update is lost. Completion is signalled through a semaphore.
+  *  - Semaphores: a timed take on an empty semaphore times out, a give
+  *    from another thread wakes a waiting take.
+  *
+  * Build and run (Linux, see tests/README.md):
+  *   gcc -O2 -pthread -DW9825G6KH_OS=3 -Wno-int-to-pointer-cast -Itests/host -I. -o os_pthread \
+  *       tests/os_pthread.c tests/host/hal_stub.c w9825g6kh_os.c
+  *   ./os_pthread [threads] [iterations]
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_os.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if (W9825G6KH_OS != W9825G6KH_OS_PTHREAD)
+#error "Build with -DW9825G6KH_OS=3 (W9825G6KH_OS_PTHREAD)"
+#endif
+
+/* Private defines -----------------------------------------------------------*/
+#define OS_MAX_THREADS               32U
+#define OS_SETTLE_MS                 50U     /* Time given to a blocked thread to sneak in */
+
+#define OS_CHECK(cond, ...)                                   \
+    do {                                                      \
+        if (!(cond)) {                                        \
+            printf("FAIL: " __VA_ARGS__);                     \
+            printf("\n");                                     \
+            os_failed = 1;                                    \
+        }                                                     \
+    } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static int os_failed;
+static W9825G6KH_OS_MutexTypeDef os_mutex;
+static W9825G6KH_OS_SemTypeDef os_done;
+static volatile uint32_t os_contender_in;
+static volatile uint32_t os_inside;
+static volatile uint32_t os_overlaps;
+static uint32_t os_counter;              /* Only ever touched under os_mutex */
+static uint32_t os_iterations = 200000U;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void Os_SleepMs(uint32_t ms)
+{
+    struct timespec ts = { (time_t)(ms / 1000U), (long)(ms % 1000U) * 1000000L };
+
+    nanosleep(&ts, NULL);
+}
+
+static uint32_t Os_NowMs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U);
+}
+
+static void Os_Contender(void *arg)
+{
+    (void)arg;
+
+    W9825G6KH_OS_MutexLock(os_mutex);
+    os_contender_in = 1U;
+    W9825G6KH_OS_MutexUnlock(os_mutex);
+    W9825G6KH_OS_SemGive(os_done);
+}
+
+static void Os_Worker(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t i = 0; i < os_iterations; i++) {
+        W9825G6KH_OS_MutexLock(os_mutex);
+        W9825G6KH_OS_MutexLock(os_mutex);      /* Nested, as Zero_Mark inside a heap call */
+        if (__atomic_add_fetch(&os_inside, 1U, __ATOMIC_ACQ_REL) != 1U) {
+            __atomic_fetch_add(&os_overlaps, 1U, __ATOMIC_RELAXED);
+        }
+        os_counter++;
+        __atomic_fetch_sub(&os_inside, 1U, __ATOMIC_ACQ_REL);
+        W9825G6KH_OS_MutexUnlock(os_mutex);
+        W9825G6KH_OS_MutexUnlock(os_mutex);
+    }
+    W9825G6KH_OS_SemGive(os_done);
+}
+
+/**
+  * @brief  A thread holding the mutex three deep keeps others out until the
+  *         last unlock
+  */
+static void Os_Recursion(void)
+{
+    W9825G6KH_OS_MutexLock(os_mutex);
+    W9825G6KH_OS_MutexLock(os_mutex);
+    W9825G6KH_OS_MutexLock(os_mutex);
+
+    OS_CHECK(W9825G6KH_OS_ThreadCreate(Os_Contender, NULL, "contender", 1024U, 0U) == W9825G6KH_OK,
+             "thread create");
+
+    for (uint32_t depth = 3U; depth > 1U; depth--) {
+        Os_SleepMs(OS_SETTLE_MS);
+        OS_CHECK(os_contender_in == 0U, "other thread got in with the mutex held %lu deep",
+                 (unsigned long)depth);
+        W9825G6KH_OS_MutexUnlock(os_mutex);
+    }
+    Os_SleepMs(OS_SETTLE_MS);
+    OS_CHECK(os_contender_in == 0U, "other thread got in with the mutex held 1 deep");
+    W9825G6KH_OS_MutexUnlock(os_mutex);
+
+    OS_CHECK(W9825G6KH_OS_SemTake(os_done, 5000U) == 1U && os_contender_in == 1U,
+             "other thread did not get in after the last unlock");
+    printf("Recursion: held 3 deep, other thread admitted after the third unlock\n");
+}
+
+/**
+  * @brief  Threads counting under a nested lock never overlap or lose updates
+  */
+static void Os_Contention(uint32_t nthreads)
+{
+    uint32_t started = 0;
+
+    for (uint32_t i = 0; i < nthreads; i++) {
+        if (W9825G6KH_OS_ThreadCreate(Os_Worker, NULL, "worker", 1024U, 0U) == W9825G6KH_OK) {
+            started++;
+        }
+    }
+    OS_CHECK(started == nthreads, "started %lu of %lu threads", (unsigned long)started, (unsigned long)nthreads);
+
+    for (uint32_t i = 0; i < started; i++) {
+        (void)W9825G6KH_OS_SemTake(os_done, W9825G6KH_OS_WAIT_FOREVER);
+    }
+
+    printf("Contention: %lu threads x %lu iterations: counter %lu, overlaps %lu\n", (unsigned long)started,
+           (unsigned long)os_iterations, (unsigned long)os_counter, (unsigned long)os_overlaps);
+    OS_CHECK(os_counter == started * os_iterations, "counter %lu, expected %lu", (unsigned long)os_counter,
+             (unsigned long)(started * os_iterations));
+    OS_CHECK(os_overlaps == 0U, "%lu overlapping critical sections", (unsigned long)os_overlaps);
+}
+
+static void Os_Giver(void *arg)
+{
+    Os_SleepMs(OS_SETTLE_MS);
+    W9825G6KH_OS_SemGive((W9825G6KH_OS_SemTypeDef)arg);
+}
+
+/**
+  * @brief  Timed take times out on an empty semaphore; a give wakes a waiter
+  */
+static void Os_Semaphore(void)
+{
+    W9825G6KH_OS_SemTypeDef sem = W9825G6KH_OS_SemCreate(1U, 0U);
+    uint32_t t0;
+    uint32_t waited;
+
+    OS_CHECK(sem != NULL, "semaphore create");
+
+    t0 = Os_NowMs();
+    OS_CHECK(W9825G6KH_OS_SemTake(sem, OS_SETTLE_MS) == 0U, "take on an empty semaphore succeeded");
+    waited = Os_NowMs() - t0;
+    OS_CHECK(waited + 5U >= OS_SETTLE_MS, "timed take returned after %lu ms, expected %lu",
+             (unsigned long)waited, (unsigned long)OS_SETTLE_MS);
+
+    OS_CHECK(W9825G6KH_OS_ThreadCreate(Os_Giver, sem, "giver", 1024U, 0U) == W9825G6KH_OK, "thread create");
+    OS_CHECK(W9825G6KH_OS_SemTake(sem, W9825G6KH_OS_WAIT_FOREVER) == 1U, "give did not wake the waiter");
+    OS_CHECK(W9825G6KH_OS_SemTake(sem, 0U) == 0U, "one give satisfied two takes");
+    printf("Semaphore: timed take waited %lu ms, give woke the waiter\n", (unsigned long)waited);
+}
+
+/* Main ----------------------------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    uint32_t nthreads = 8U;
+
+    if (argc > 1) {
+        nthreads = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2) {
+        os_iterations = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    if (nthreads == 0U || nthreads > OS_MAX_THREADS) {
+        fprintf(stderr, "threads: 1 .. %u\n", (unsigned)OS_MAX_THREADS);
+        return 2;
+    }
+
+    os_mutex = W9825G6KH_OS_MutexCreate();
+    os_done = W9825G6KH_OS_SemCreate(OS_MAX_THREADS, 0U);
+    if (os_mutex == NULL || os_done == NULL) {
+        printf("FAIL: create\n");
+        return 1;
+    }
+
+    Os_Recursion();
+    Os_Contention(nthreads);
+    Os_Semaphore();
+
+    printf("%s\n", os_failed ? "FAIL" : "PASS");
+    return os_failed;
+}
@@ -0,0 +1,282 @@
+/**
+  ******************************************************************************
+  * @file    qos_sim.c
+  * @brief   Host simulation of the W9825G6KH QoS scheduler: WFQ bandwidth
+  *          shares and EDF deadline-miss accounting
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The weak hooks are replaced by a simulated bus: IssueBurst copies and
+  * advances a virtual clock by one tick per byte, GetTime returns it. Time
+  * is therefore exact and every figure below is deterministic.
+  *
+  *  - WFQ: three always-backlogged classes weighted 4:2:1 must split the
+  *    bytes 4:2:1, and every copy must land intact.
+  *  - Deadlines: a request that cannot make its deadline is counted as
+  *    missed with the exact lateness, one that can is not, and a deadline
+  *    that wraps onto 0 is still a deadline.
+  *  - EDF: a periodic stream with deadlines next to a bulk backlog meets
+  *    every deadline under EDF; under WFQ with a small weight it misses.
+  *
+  * Build and run (Linux, see tests/README.md):
+  *   gcc -O2 -Wno-int-to-pointer-cast -Itests/host -I. -o qos_sim \
+  *       tests/qos_sim.c tests/host/hal_stub.c w9825g6kh_qos.c
+  *   ./qos_sim
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_qos.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_CHUNK_BYTES              8192U
+#define SIM_CHUNKS                   8U
+#define SIM_LINE_BYTES               1024U
+#define SIM_LINE_PERIOD              4000U   /* Ticks between display lines */
+#define SIM_LINE_SLACK               2500U   /* Deadline after the line is due */
+#define SIM_LINES                    50U
+
+#define SIM_CHECK(cond, ...)                                  \
+    do {                                                      \
+        if (!(cond)) {                                        \
+            printf("FAIL: " __VA_ARGS__);                     \
+            printf("\n");                                     \
+            sim_failed = 1;                                   \
+        }                                                     \
+    } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t sim_clock = 1000U;
+static int sim_failed;
+static uint8_t sim_src[3][SIM_CHUNK_BYTES * SIM_CHUNKS];
+static uint32_t sim_done[W9825G6KH_QOS_CLASSES];
+static uint32_t sim_late[W9825G6KH_QOS_CLASSES];
+static uint32_t sim_last_late;
+static uint32_t sim_order[4];
+static uint32_t sim_order_count;
+
+/* Simulated bus -------------------------------------------------------------*/
+
+uint32_t W9825G6KH_QoS_GetTime(void)
+{
+    return sim_clock;
+}
+
+void W9825G6KH_QoS_IssueBurst(void *pDst, const void *pSrc, uint32_t Size)
+{
+    memcpy(pDst, pSrc, Size);
+    sim_clock += Size;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint8_t *Sim_Sdram(uint32_t Offset)
+{
+    return (uint8_t *)(uintptr_t)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+static void Sim_Done(void *Context, uint32_t Late)
+{
+    uint32_t c = (uint32_t)(uintptr_t)Context;
+
+    sim_done[c]++;
+    if (Late != 0U) {
+        sim_late[c]++;
+    }
+    sim_last_late = Late;
+    if (sim_order_count < 4U) {
+        sim_order[sim_order_count++] = c;
+    }
+}
+
+static W9825G6KH_StatusTypeDef Sim_Submit(uint32_t Class, const void *pSrc, void *pDst, uint32_t Size,
+                                          uint32_t Deadline, uint32_t Tag)
+{
+    W9825G6KH_QoSRequestTypeDef r;
+
+    r.Class = Class;
+    r.pSrc = pSrc;
+    r.pDst = pDst;
+    r.Size = Size;
+    r.Deadline = Deadline;
+    r.Callback = Sim_Done;
+    r.Context = (void *)(uintptr_t)Tag;
+    return W9825G6KH_QoS_Submit(&r);
+}
+
+static void Sim_Reset(W9825G6KH_QoSPolicyTypeDef Policy)
+{
+    (void)W9825G6KH_QoS_Init(Policy);
+    memset(sim_done, 0, sizeof(sim_done));
+    memset(sim_late, 0, sizeof(sim_late));
+    sim_order_count = 0;
+}
+
+/**
+  * @brief  Three backlogged classes at 4:2:1 split the bus 4:2:1
+  */
+static void Sim_WfqShares(void)
+{
+    static const uint32_t weight[3] = { 4U, 2U, 1U };
+    W9825G6KH_QoSClassStatsTypeDef s[3];
+    uint32_t total = 0;
+
+    Sim_Reset(W9825G6KH_QOS_POLICY_WFQ);
+    for (uint32_t c = 0; c < 3U; c++) {
+        (void)W9825G6KH_QoS_SetWeight(c, weight[c]);
+        for (uint32_t k = 0; k < SIM_CHUNKS; k++) {
+            SIM_CHECK(Sim_Submit(c, &sim_src[c][k * SIM_CHUNK_BYTES],
+                                 Sim_Sdram(c * 0x100000U + k * SIM_CHUNK_BYTES + 100U),
+                                 SIM_CHUNK_BYTES, W9825G6KH_QOS_NO_DEADLINE, c) == W9825G6KH_OK,
+                      "WFQ submit class %lu", (unsigned long)c);
+        }
+    }
+
+    /* Stop while all three are still backlogged: 112 bursts give class 0
+     * about half of its 64 KB */
+    (void)W9825G6KH_QoS_Run(7U * 16U);
+    for (uint32_t c = 0; c < 3U; c++) {
+        (void)W9825G6KH_QoS_GetClassStats(c, &s[c]);
+        total += s[c].Bytes;
+    }
+    printf("WFQ 4:2:1 after %lu bytes: %lu / %lu / %lu\n", (unsigned long)total,
+           (unsigned long)s[0].Bytes, (unsigned long)s[1].Bytes, (unsigned long)s[2].Bytes);
+    for (uint32_t c = 0; c < 3U; c++) {
+        uint32_t expect = total / 7U * weight[c];
+        uint32_t diff = (s[c].Bytes > expect) ? s[c].Bytes - expect : expect - s[c].Bytes;
+
+        /* Off by at most one burst from the exact share */
+        SIM_CHECK(diff <= W9825G6KH_QOS_BURST_BYTES, "WFQ class %lu got %lu bytes, expected %lu",
+                  (unsigned long)c, (unsigned long)s[c].Bytes, (unsigned long)expect);
+    }
+
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+    for (uint32_t c = 0; c < 3U; c++) {
+        SIM_CHECK(memcmp(Sim_Sdram(c * 0x100000U + 100U), sim_src[c], sizeof(sim_src[c])) == 0,
+                  "WFQ class %lu data", (unsigned long)c);
+        SIM_CHECK(sim_done[c] == SIM_CHUNKS, "WFQ class %lu completed %lu of %lu", (unsigned long)c,
+                  (unsigned long)sim_done[c], (unsigned long)SIM_CHUNKS);
+    }
+    SIM_CHECK(W9825G6KH_QoS_Pending() == 0U, "WFQ queue not empty");
+}
+
+/**
+  * @brief  Missed deadlines are counted with their exact lateness, and the
+  *         earliest deadline goes first
+  */
+static void Sim_DeadlineAccounting(void)
+{
+    W9825G6KH_QoSClassStatsTypeDef s;
+    uint32_t start;
+
+    Sim_Reset(W9825G6KH_QOS_POLICY_EDF);
+
+    /* 4096 bytes take 4096 ticks: a deadline 100 ticks out is 3996 late */
+    start = sim_clock;
+    (void)Sim_Submit(1U, sim_src[1], Sim_Sdram(0x200000U), 4096U, start + 100U, 1U);
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+    (void)W9825G6KH_QoS_GetClassStats(1U, &s);
+    SIM_CHECK(s.Missed == 1U && s.MaxLate == 3996U && sim_last_late == 3996U,
+              "late request: missed %lu, max late %lu, callback late %lu (expected 1, 3996, 3996)",
+              (unsigned long)s.Missed, (unsigned long)s.MaxLate, (unsigned long)sim_last_late);
+
+    /* Same size, deadline exactly at completion: met */
+    start = sim_clock;
+    (void)Sim_Submit(1U, sim_src[1], Sim_Sdram(0x200000U), 4096U, start + 4096U, 1U);
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+    (void)W9825G6KH_QoS_GetClassStats(1U, &s);
+    SIM_CHECK(s.Missed == 1U && s.Completed == 2U && sim_last_late == 0U,
+              "deadline at completion counted as missed (missed %lu, late %lu)",
+              (unsigned long)s.Missed, (unsigned long)sim_last_late);
+
+    /* A deadline computed across the clock wrap that lands on 0 still
+     * counts: it is moved to 1, and the copy ends at 3996 */
+    sim_clock = 0U - 100U;
+    (void)Sim_Submit(1U, sim_src[1], Sim_Sdram(0x200000U), 4096U, W9825G6KH_QoS_DeadlineIn(100U), 1U);
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+    (void)W9825G6KH_QoS_GetClassStats(1U, &s);
+    SIM_CHECK(s.Missed == 2U && sim_last_late == 3995U,
+              "deadline on 0 after the wrap: missed %lu, late %lu (expected 2, 3995)",
+              (unsigned long)s.Missed, (unsigned long)sim_last_late);
+
+    /* Later deadline submitted first still finishes second */
+    sim_order_count = 0;
+    start = sim_clock;
+    (void)Sim_Submit(2U, sim_src[2], Sim_Sdram(0x300000U), 2048U, start + 100000U, 2U);
+    (void)Sim_Submit(3U, sim_src[2], Sim_Sdram(0x380000U), 2048U, start + 5000U, 3U);
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+    SIM_CHECK(sim_order_count == 2U && sim_order[0] == 3U && sim_order[1] == 2U,
+              "EDF order: class %lu finished first", (unsigned long)sim_order[0]);
+}
+
+/**
+  * @brief  Periodic deadline stream beside a bulk backlog
+  * @retval Display lines that missed their deadline
+  */
+static uint32_t Sim_DisplayUnderLoad(W9825G6KH_QoSPolicyTypeDef Policy)
+{
+    W9825G6KH_QoSClassStatsTypeDef s;
+    uint32_t next = sim_clock;
+    uint32_t lines = 0;
+
+    Sim_Reset(Policy);
+    (void)W9825G6KH_QoS_SetWeight(0U, 1U);
+    (void)W9825G6KH_QoS_SetWeight(2U, 8U);
+
+    while (lines < SIM_LINES) {
+        if ((int32_t)(sim_clock - next) >= 0 &&
+            Sim_Submit(0U, sim_src[0], Sim_Sdram(0x800000U + lines * SIM_LINE_BYTES), SIM_LINE_BYTES,
+                       W9825G6KH_QOS_DEADLINE_AT(next + SIM_LINE_SLACK), 0U) == W9825G6KH_OK) {
+            lines++;
+            next += SIM_LINE_PERIOD;
+        }
+        if (W9825G6KH_QoS_Pending() < 8U) {
+            (void)Sim_Submit(2U, sim_src[2], Sim_Sdram(0x400000U), 4096U, W9825G6KH_QOS_NO_DEADLINE, 2U);
+        }
+        (void)W9825G6KH_QoS_Run(1U);
+    }
+    while (W9825G6KH_QoS_Run(0) != W9825G6KH_OK) {
+    }
+
+    (void)W9825G6KH_QoS_GetClassStats(0U, &s);
+    printf("%s: display lines %lu, missed %lu (max late %lu), bulk requests %lu\n",
+           (Policy == W9825G6KH_QOS_POLICY_EDF) ? "EDF" : "WFQ", (unsigned long)s.Completed,
+           (unsigned long)s.Missed, (unsigned long)s.MaxLate, (unsigned long)sim_done[2]);
+    SIM_CHECK(s.Completed == SIM_LINES && sim_done[0] == SIM_LINES, "display lines lost");
+    SIM_CHECK(s.Missed == sim_late[0], "Missed %lu but %lu callbacks saw Late != 0",
+              (unsigned long)s.Missed, (unsigned long)sim_late[0]);
+    SIM_CHECK(sim_done[2] > 0U, "bulk starved");
+
+    return s.Missed;
+}
+
+/* Main ----------------------------------------------------------------------*/
+
+int main(void)
+{
+    for (uint32_t c = 0; c < 3U; c++) {
+        for (uint32_t i = 0; i < sizeof(sim_src[c]); i++) {
+            sim_src[c][i] = (uint8_t)(i * 7U + c * 31U + (i >> 8));
+        }
+    }
+
+    Sim_WfqShares();
+    Sim_DeadlineAccounting();
+    SIM_CHECK(Sim_DisplayUnderLoad(W9825G6KH_QOS_POLICY_EDF) == 0U, "EDF missed display deadlines");
+    SIM_CHECK(Sim_DisplayUnderLoad(W9825G6KH_QOS_POLICY_WFQ) > 0U,
+              "WFQ at weight 1:8 met every deadline; the load is too light to show EDF working");
+
+    printf("%s\n", sim_failed ? "FAIL" : "PASS");
+    return sim_failed;
+}
@@ -0,0 +1,199 @@
+/**
+  ******************************************************************************
+  * @file    slab_stress.c
+  * @brief   Host stress test for the lock-free W9825G6KH slab free list
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Threads hammer one small pool with Alloc, AllocBulk, Free and FreeBulk.
+  * Every held object carries its owner and a sequence number, checked on
+  * each pass and before it is freed, so an object handed to two owners at
+  * once (a lost ABA race) is caught. After the threads join, the free list
+  * must hold every object exactly once and the counters must balance.
+  *
+  * Build and run (Linux, see tests/README.md):
+  *   gcc -O2 -pthread -Wno-int-to-pointer-cast -Itests/host -I. -o slab_stress \
+  *       tests/slab_stress.c tests/host/hal_stub.c w9825g6kh_slab.c
+  *   ./slab_stress [threads] [iterations]
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_slab.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define STRESS_MAX_THREADS           32U
+#define STRESS_HELD_MAX              64U
+#define STRESS_POOL_OFFSET           0x1000U
+#define STRESS_OBJ_SIZE              40U     /* Word 0 is the free-list link */
+#define STRESS_OBJ_COUNT             256U    /* Small, so threads keep colliding */
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_SlabPoolTypeDef stress_pool;
+static uint32_t stress_iterations = 1000000U;
+static volatile uint32_t stress_errors;
+static uint8_t stress_seen[STRESS_OBJ_COUNT];
+
+/* Private functions ---------------------------------------------------------*/
+
+static void Stress_Stamp(void *obj, uint32_t id, uint32_t seq)
+{
+    ((volatile uint32_t *)obj)[1] = id;
+    ((volatile uint32_t *)obj)[2] = seq;
+}
+
+static void Stress_Check(const void *obj, uint32_t id, uint32_t seq)
+{
+    if (((const volatile uint32_t *)obj)[1] != id || ((const volatile uint32_t *)obj)[2] != seq) {
+        __atomic_fetch_add(&stress_errors, 1U, __ATOMIC_RELAXED);
+    }
+}
+
+static void *Stress_Worker(void *arg)
+{
+    uint32_t id = (uint32_t)(uintptr_t)arg;
+    unsigned int seed = id * 7919U + 1U;
+    void *held[STRESS_HELD_MAX];
+    uint32_t seq[STRESS_HELD_MAX];
+    uint32_t n = 0;
+
+    for (uint32_t it = 0; it < stress_iterations; it++) {
+        uint32_t op = (uint32_t)rand_r(&seed) % 8U;
+
+        if (op < 3U && n < STRESS_HELD_MAX) {
+            void *p = W9825G6KH_Slab_Alloc(&stress_pool);
+
+            if (p != NULL) {
+                Stress_Stamp(p, id, it);
+                held[n] = p;
+                seq[n++] = it;
+            }
+        } else if (op < 4U && n + 8U <= STRESS_HELD_MAX) {
+            void *bulk[8];
+
+            if (W9825G6KH_Slab_AllocBulk(&stress_pool, bulk, 8U) == 8U) {
+                for (uint32_t k = 0; k < 8U; k++) {
+                    Stress_Stamp(bulk[k], id, it);
+                    held[n] = bulk[k];
+                    seq[n++] = it;
+                }
+            }
+        } else if (op < 7U && n > 0U) {
+            uint32_t k = (uint32_t)rand_r(&seed) % n;
+
+            Stress_Check(held[k], id, seq[k]);
+            if (W9825G6KH_Slab_Free(&stress_pool, held[k]) != W9825G6KH_OK) {
+                __atomic_fetch_add(&stress_errors, 1U, __ATOMIC_RELAXED);
+            }
+            n--;
+            held[k] = held[n];
+            seq[k] = seq[n];
+        } else if (n >= 4U) {
+            for (uint32_t k = n - 4U; k < n; k++) {
+                Stress_Check(held[k], id, seq[k]);
+            }
+            if (W9825G6KH_Slab_FreeBulk(&stress_pool, &held[n - 4U], 4U) != W9825G6KH_OK) {
+                __atomic_fetch_add(&stress_errors, 1U, __ATOMIC_RELAXED);
+            }
+            n -= 4U;
+        }
+
+        /* Nobody else may have touched what this thread still holds */
+        for (uint32_t k = 0; k < n; k++) {
+            Stress_Check(held[k], id, seq[k]);
+        }
+    }
+
+    if (n > 0U) {
+        (void)W9825G6KH_Slab_FreeBulk(&stress_pool, held, n);
+    }
+    return NULL;
+}
+
+/**
+  * @brief  Walks the free list after the threads are done
+  * @retval Objects on the list, or 0xFFFFFFFF if one is on it twice
+  */
+static uint32_t Stress_CountFree(void)
+{
+    uint32_t mask = (1UL << stress_pool.IndexBits) - 1U;
+    uint32_t index = stress_pool.Head & mask;
+    uint32_t count = 0;
+
+    memset(stress_seen, 0, sizeof(stress_seen));
+    while (index != mask && count <= stress_pool.Count) {
+        if (index >= stress_pool.Count || stress_seen[index]++ != 0U) {
+            return 0xFFFFFFFFU;
+        }
+        count++;
+        index = *(volatile uint32_t *)(uintptr_t)(stress_pool.Base + index * stress_pool.Stride) & mask;
+    }
+
+    return count;
+}
+
+/* Main ----------------------------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    pthread_t threads[STRESS_MAX_THREADS];
+    uint32_t nthreads = 16U;
+    uint32_t free_count;
+    void *all[STRESS_OBJ_COUNT];
+    void *extra;
+    int failed = 0;
+
+    if (argc > 1) {
+        nthreads = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2) {
+        stress_iterations = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    if (nthreads == 0U || nthreads > STRESS_MAX_THREADS) {
+        fprintf(stderr, "threads: 1 .. %u\n", (unsigned)STRESS_MAX_THREADS);
+        return 2;
+    }
+
+    if (W9825G6KH_Slab_Create(&stress_pool, STRESS_POOL_OFFSET, STRESS_OBJ_COUNT * 64U,
+                              STRESS_OBJ_SIZE, W9825G6KH_SLAB_ALIGN_CACHE_LINE) != W9825G6KH_OK ||
+        stress_pool.Count != STRESS_OBJ_COUNT) {
+        printf("FAIL: pool create\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < nthreads; i++) {
+        pthread_create(&threads[i], NULL, Stress_Worker, (void *)(uintptr_t)i);
+    }
+    for (uint32_t i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    W9825G6KH_Slab_PrintStats("stress", &stress_pool);
+
+    free_count = Stress_CountFree();
+    printf("%lu threads x %lu iterations: %lu ownership errors, free list %ld/%lu\n",
+           (unsigned long)nthreads, (unsigned long)stress_iterations, (unsigned long)stress_errors,
+           (long)(int32_t)free_count, (unsigned long)stress_pool.Count);
+    if (stress_errors != 0U || free_count != stress_pool.Count || stress_pool.InUse != 0U) {
+        failed = 1;
+    }
+
+    /* The pool is whole again: all of it can be taken, and no more */
+    if (W9825G6KH_Slab_AllocBulk(&stress_pool, all, stress_pool.Count) != stress_pool.Count ||
+        W9825G6KH_Slab_AllocBulk(&stress_pool, &extra, 1U) != 0U ||
+        W9825G6KH_Slab_Free(&stress_pool, (uint8_t *)all[0] + 4) != W9825G6KH_INVALID_PARAM) {
+        printf("FAIL: pool not whole after the run\n");
+        failed = 1;
+    }
+
+    printf("%s\n", failed ? "FAIL" : "PASS");
+    return failed;
+}
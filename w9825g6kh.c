@@ -16,22 +16,53 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "w9825g6kh.h"
+#include "w9825g6kh_atomic.h"
+#include "w9825g6kh_perf.h"
+#include "w9825g6kh_crc.h"
+#include "w9825g6kh_tlm.h"
 #include <string.h>
 #include <stdio.h>
 
 /* Private defines -----------------------------------------------------------*/
 #define W9825G6KH_COMMAND_TIMEOUT    0xFFFFU
 #define W9825G6KH_BUSY_TIMEOUT_MS    1000      /* 1 second timeout for busy state */
+#define W9825G6KH_DIAG_CHUNK_BYTES   1024      /* SRAM staging size for diagnostics */
+
+#if W9825G6KH_TEXT_DIAGNOSTICS
+#define W9825G6KH_DIAG_PRINTF(...)   printf(__VA_ARGS__)
+#else
+#define W9825G6KH_DIAG_PRINTF(...)   ((void)0)
+#endif
 
 /* Private variables ---------------------------------------------------------*/
 static SDRAM_HandleTypeDef *hsdram_ptr = NULL;
 static W9825G6KH_InitTypeDef DeviceConfig = W9825G6KH_DEFAULT_CONFIG;
 static uint32_t sdram_size_bytes = W9825G6KH_SIZE_BYTES;
+static W9825G6KH_AccessHookTypeDef access_hooks[W9825G6KH_MAX_ACCESS_HOOKS];
+static volatile W9825G6KH_InitStateTypeDef init_state = W9825G6KH_INIT_IDLE;
+static uint32_t init_wait_start = 0;        /* DWT cycle count at last command */
+static uint32_t init_wait_cycles = 0;       /* Minimum cycles before next step */
+static uint32_t init_mode_register = 0;     /* Last value loaded into the mode register */
+#if defined(DMA2D)
+static volatile uint32_t dma2d_owned = 0;   /* 1 while a user programs DMA2D */
+static W9825G6KH_Dma2dJobTypeDef *volatile dma2d_pending = NULL;   /* Job left running */
+#endif
 
 /* Private function prototypes -----------------------------------------------*/
 static W9825G6KH_StatusTypeDef W9825G6KH_WaitReady(void);
 
 static W9825G6KH_StatusTypeDef W9825G6KH_CheckAddressRange(uint32_t addr, uint32_t size);
+static void W9825G6KH_NotifyAccess(uint32_t addr, uint32_t size, uint32_t access);
+static W9825G6KH_StatusTypeDef W9825G6KH_SetPowerMode(uint32_t cmd_mode, uint32_t expected);
+static W9825G6KH_StatusTypeDef W9825G6KH_CheckRect(uint32_t addr, uint32_t pitch, const W9825G6KH_RectTypeDef *Rect, uint32_t *pSpan);
+static uint32_t W9825G6KH_CopyCrc(uint8_t *dst, const uint8_t *src, uint32_t size, uint32_t state);
+static uint32_t W9825G6KH_NsToCycles(uint32_t ns);
+static uint32_t W9825G6KH_NsToClocks(uint32_t ns, uint32_t clock_hz);
+static uint32_t W9825G6KH_ClockDivider(uint32_t sdclk_period);
+static uint32_t W9825G6KH_BuildModeRegister(void);
+static W9825G6KH_StatusTypeDef W9825G6KH_LoadModeRegister(uint32_t mode_value);
+static W9825G6KH_StatusTypeDef W9825G6KH_ConfigureController(uint32_t mode_register);
+static W9825G6KH_StatusTypeDef W9825G6KH_InitFinish(W9825G6KH_StatusTypeDef status);
 //W9825G6KH_StatusTypeDef W9825G6KH_CheckAddressRange(uint32_t addr, uint32_t size)
 static void W9825G6KH_PrintModeRegisterDetails(uint32_t mode_register);
 
@@ -49,6 +80,11 @@ static W9825G6KH_StatusTypeDef W9825G6KH_WaitReady(void)
         return W9825G6KH_ERROR;
     }
 
+    /* Non-blocking initialization still in progress */
+    if (init_state != W9825G6KH_INIT_DONE) {
+        return (init_state == W9825G6KH_INIT_FAILED) ? W9825G6KH_ERROR : W9825G6KH_BUSY;
+    }
+
     /* Wait if SDRAM is busy */
     while (HAL_SDRAM_GetState(hsdram_ptr) == HAL_SDRAM_STATE_BUSY &&
            timeout < W9825G6KH_BUSY_TIMEOUT_MS) {
@@ -80,14 +116,31 @@ static W9825G6KH_StatusTypeDef W9825G6KH_CheckAddressRange(uint32_t addr, uint32
         return W9825G6KH_INVALID_PARAM;
     }
 
-    /* Check for overflow */
-    if ((addr + size) > sdram_size_bytes) {
+    /* addr < sdram_size_bytes here, so the subtraction cannot wrap
+     * (addr + size could, for sizes near 4 GB) */
+    if (size > sdram_size_bytes - addr) {
         return W9825G6KH_INVALID_PARAM;
     }
 
     return W9825G6KH_OK;
 }
 
+/**
+  * @brief  Runs the registered access hooks ahead of an SDRAM access
+  * @param  addr: Starting address (offset from base)
+  * @param  size: Size in bytes
+  * @param  access: W9825G6KH_ACCESS_READ or W9825G6KH_ACCESS_WRITE
+  */
+static void W9825G6KH_NotifyAccess(uint32_t addr, uint32_t size, uint32_t access)
+{
+    for (uint32_t i = 0; i < W9825G6KH_MAX_ACCESS_HOOKS; i++) {
+        W9825G6KH_AccessHookTypeDef hook = access_hooks[i];
+        if (hook != NULL) {
+            hook(addr, size, access);
+        }
+    }
+}
+
 /**
   * @brief  Print detailed mode register information
   * @param  mode_register: Mode register value
@@ -173,97 +226,100 @@ void W9825G6KH_PrintModeRegisterDetails(uint32_t mode_register) {
            (mode_register & 0x200) ? "Single Location" : "Programmed");
 }
 
-
-
-/* Public functions ----------------------------------------------------------*/
-
 /**
-  * @brief  Initializes the W9825G6KH SDRAM device
-  * @param  hsdram_param: SDRAM handle pointer
-  * @param  Config: Configuration structure
-  * @retval W9825G6KH status
+  * @brief  Converts a minimum delay in ns to core cycles, rounding up
+  * @param  ns: Delay in nanoseconds
+  * @retval Cycles at SystemCoreClock (at least 1 for a non-zero delay)
   */
-
-W9825G6KH_StatusTypeDef W9825G6KH_Init(SDRAM_HandleTypeDef *hsdram_param, W9825G6KH_InitTypeDef *Config)
+static uint32_t W9825G6KH_NsToCycles(uint32_t ns)
 {
-    FMC_SDRAM_CommandTypeDef Command = {0};
-    uint32_t mode_register;
-
-    if (hsdram_param == NULL || Config == NULL) {
-        return W9825G6KH_ERROR;
-    }
-
-    hsdram_ptr = hsdram_param;
-    memcpy(&DeviceConfig, Config, sizeof(W9825G6KH_InitTypeDef));
-
-    printf("=== SDRAM Initialization Started ===\n");
-
-    /* Step 1: Clock Enable Command */
-    printf("1. Sending Clock Enable command...\n");
-    Command.CommandMode = FMC_SDRAM_CMD_CLK_ENABLE;
-    Command.CommandTarget = Config->TargetBank;
-    Command.AutoRefreshNumber = 1;
-    Command.ModeRegisterDefinition = 0;
-
-    if (HAL_SDRAM_SendCommand(hsdram_param, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
-        printf("  ERROR: Clock Enable failed\n");
-        return W9825G6KH_ERROR;
-    }
-    printf("  OK: Clock enabled\n");
+    return (uint32_t)(((uint64_t)ns * SystemCoreClock + 999999999ULL) / 1000000000ULL);
+}
 
-    /* Step 2: Wait at least 100µs (minimum 2 SD clock cycles) */
-    HAL_Delay(1);  /* 1ms is more than enough */
+/**
+  * @brief  Converts a minimum delay in ns to SDRAM clocks, rounding up
+  * @param  ns: Delay in nanoseconds
+  * @param  clock_hz: SDCLK frequency
+  * @retval Clocks
+  */
+static uint32_t W9825G6KH_NsToClocks(uint32_t ns, uint32_t clock_hz)
+{
+    return (uint32_t)(((uint64_t)ns * clock_hz + 999999999ULL) / 1000000000ULL);
+}
 
-    /* Step 3: Precharge All Command */
-    printf("2. Sending Precharge All command...\n");
-    Command.CommandMode = FMC_SDRAM_CMD_PALL;
-    Command.AutoRefreshNumber = 1;
-    if (HAL_SDRAM_SendCommand(hsdram_param, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
-        printf("  ERROR: Precharge All failed\n");
-        return W9825G6KH_ERROR;
+/**
+  * @brief  Divider of an FMC_SDRAM_CLOCK_PERIOD_x value
+  * @retval 2 or 3, or 0 if the value is not a valid period
+  */
+static uint32_t W9825G6KH_ClockDivider(uint32_t sdclk_period)
+{
+    if (sdclk_period == FMC_SDRAM_CLOCK_PERIOD_2) {
+        return 2U;
     }
-    printf("  OK: All banks precharged\n");
-
-    /* Step 4: Auto Refresh Command (minimum 2 cycles, 8 is typical) */
-    printf("3. Sending Auto Refresh commands (8 cycles)...\n");
-    Command.CommandMode = FMC_SDRAM_CMD_AUTOREFRESH_MODE;
-    Command.AutoRefreshNumber = 8;
-    if (HAL_SDRAM_SendCommand(hsdram_param, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
-        printf("  ERROR: Auto Refresh failed\n");
-        return W9825G6KH_ERROR;
+    if (sdclk_period == FMC_SDRAM_CLOCK_PERIOD_3) {
+        return 3U;
     }
-    printf("  OK: Auto refresh completed\n");
-
-    /* Step 5: Load Mode Register Command */
-    printf("4. Loading Mode Register...\n");
+    return 0U;
+}
 
-    // USE CUBEMX'S CAS SETTING, not Config->CASLatency
+/**
+  * @brief  Builds the mode register value from DeviceConfig
+  * @note   Uses CubeMX's CAS setting, not DeviceConfig.CASLatency
+  * @retval Mode register value
+  */
+static uint32_t W9825G6KH_BuildModeRegister(void)
+{
     uint32_t cube_mx_cas;
-    if (hsdram_param->Init.CASLatency == FMC_SDRAM_CAS_LATENCY_2) {
+
+    if (hsdram_ptr->Init.CASLatency == FMC_SDRAM_CAS_LATENCY_2) {
         cube_mx_cas = W9825G6KH_MR_CAS_LATENCY_2;
     } else {
         cube_mx_cas = W9825G6KH_MR_CAS_LATENCY_3;
     }
 
-    mode_register = Config->BurstLength |
-                    Config->BurstType |
-                    cube_mx_cas |
-                    Config->OperatingMode |
-                    Config->WriteBurstMode;
+    return DeviceConfig.BurstLength |
+           DeviceConfig.BurstType |
+           cube_mx_cas |
+           DeviceConfig.OperatingMode |
+           DeviceConfig.WriteBurstMode;
+}
 
-    W9825G6KH_PrintModeRegisterDetails(mode_register);
+/**
+  * @brief  Sends LOAD_MODE and records the fields it set
+  * @param  mode_value: Mode register value
+  * @retval W9825G6KH status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_LoadModeRegister(uint32_t mode_value)
+{
+    FMC_SDRAM_CommandTypeDef Command = {0};
 
     Command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
+    Command.CommandTarget = DeviceConfig.TargetBank;
     Command.AutoRefreshNumber = 1;
-    Command.ModeRegisterDefinition = mode_register;
+    Command.ModeRegisterDefinition = mode_value;
 
-    if (HAL_SDRAM_SendCommand(hsdram_param, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
-        printf("  ERROR: Load Mode Register failed\n");
+    if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
         return W9825G6KH_ERROR;
     }
-    printf("  OK: Mode register loaded\n");
 
-    /* Step 6: Fix FMC Hardware CAS Configuration */
+    init_mode_register = mode_value;
+    DeviceConfig.BurstLength = mode_value & W9825G6KH_MR_BURST_LENGTH_MASK;
+    DeviceConfig.BurstType = mode_value & W9825G6KH_MR_BURST_TYPE_INTERLEAVED;
+    DeviceConfig.CASLatency = mode_value & 0x30;
+    DeviceConfig.WriteBurstMode = mode_value & W9825G6KH_MR_WRITE_BURST_MODE_SINGLE;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Matches the FMC CAS setting to the mode register and programs
+  *         the refresh timer (last steps of initialization)
+  * @param  mode_register: Mode register value that was loaded
+  * @retval W9825G6KH status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_ConfigureController(uint32_t mode_register)
+{
+    /* Step 5: Fix FMC Hardware CAS Configuration */
     printf("5. Verifying FMC hardware CAS configuration...\n");
 
     // FIXED: Use FMC_Bank5_6_R instead of FMC_Bank5_6
@@ -300,27 +356,236 @@ W9825G6KH_StatusTypeDef W9825G6KH_Init(SDRAM_HandleTypeDef *hsdram_param, W9825G
         printf("  OK: FMC hardware matches SDRAM CAS configuration\n");
     }
 
-    /* Step 7: Set Refresh Rate */
-    printf("6. Setting Refresh Rate to %lu...\n", Config->RefreshRate);
-    if (HAL_SDRAM_ProgramRefreshRate(hsdram_param, Config->RefreshRate) != HAL_OK) {
+    /* Step 6: Set Refresh Rate */
+    printf("6. Setting Refresh Rate to %lu...\n", DeviceConfig.RefreshRate);
+    if (HAL_SDRAM_ProgramRefreshRate(hsdram_ptr, DeviceConfig.RefreshRate) != HAL_OK) {
         printf("  ERROR: Set Refresh Rate failed\n");
         return W9825G6KH_ERROR;
     }
     printf("  OK: Refresh rate configured\n");
 
-    /* Final delay and status check */
-    HAL_Delay(10);
     printf("=== SDRAM Initialization Complete ===\n\n");
 
     // Print final configuration
     printf("  CAS Latency: %s\n", sdram_cas == 0x3 ? "3" :
                                    sdram_cas == 0x2 ? "2" :
                                    sdram_cas == 0x1 ? "1" : "Unknown");
-    printf("  Refresh Rate: %lu\n", Config->RefreshRate);
+    printf("  Refresh Rate: %lu\n", DeviceConfig.RefreshRate);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Ends the initialization sequence and reports the result
+  * @param  status: W9825G6KH_OK or W9825G6KH_ERROR
+  * @retval status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_InitFinish(W9825G6KH_StatusTypeDef status)
+{
+    init_state = (status == W9825G6KH_OK) ? W9825G6KH_INIT_DONE : W9825G6KH_INIT_FAILED;
+    init_wait_cycles = 0;
+
+    W9825G6KH_InitCpltCallback(status);
+
+    return status;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Initializes the W9825G6KH SDRAM device (blocking)
+  * @note   Runs the same sequence as W9825G6KH_InitStart/W9825G6KH_InitStep
+  *         to completion
+  * @param  hsdram_param: SDRAM handle pointer
+  * @param  Config: Configuration structure
+  * @retval W9825G6KH status
+  */
+
+W9825G6KH_StatusTypeDef W9825G6KH_Init(SDRAM_HandleTypeDef *hsdram_param, W9825G6KH_InitTypeDef *Config)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    status = W9825G6KH_InitStart(hsdram_param, Config);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    do {
+        status = W9825G6KH_InitStep();
+    } while (status == W9825G6KH_BUSY);
+
+    return status;
+}
+
+/**
+  * @brief  Starts the non-blocking initialization sequence
+  * @note   No command is issued here; drive the sequence with
+  *         W9825G6KH_InitStep from the main loop or a periodic timer.
+  *         Checked accesses return W9825G6KH_BUSY until it completes.
+  * @param  hsdram_param: SDRAM handle pointer (HAL_SDRAM_Init already done)
+  * @param  Config: Configuration structure (copied)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_InitStart(SDRAM_HandleTypeDef *hsdram_param, W9825G6KH_InitTypeDef *Config)
+{
+    if (hsdram_param == NULL || Config == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    hsdram_ptr = hsdram_param;
+    memcpy(&DeviceConfig, Config, sizeof(W9825G6KH_InitTypeDef));
+
+    /* Also starts the DWT cycle counter the step delays are measured with */
+    W9825G6KH_Perf_Init();
+
+    init_wait_cycles = 0;
+    init_state = W9825G6KH_INIT_CLOCK_ENABLE;
+
+    printf("=== SDRAM Initialization Started ===\n");
 
     return W9825G6KH_OK;
 }
 
+/**
+  * @brief  Advances the initialization sequence by at most one command
+  * @note   Returns immediately while the datasheet delay that follows the
+  *         previous command has not elapsed. W9825G6KH_InitCpltCallback is
+  *         called once, from the call that finishes (or fails) the sequence.
+  * @retval W9825G6KH_BUSY while in progress, W9825G6KH_OK once SDRAM is
+  *         usable, W9825G6KH_ERROR if a command failed or init not started
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_InitStep(void)
+{
+    FMC_SDRAM_CommandTypeDef Command = {0};
+    W9825G6KH_InitStateTypeDef next;
+    uint32_t delay_ns = 0;
+
+    switch (init_state) {
+        case W9825G6KH_INIT_DONE:
+            return W9825G6KH_OK;
+        case W9825G6KH_INIT_IDLE:
+        case W9825G6KH_INIT_FAILED:
+            return W9825G6KH_ERROR;
+        default:
+            break;
+    }
+
+    /* Minimum delay after the previous command */
+    if (init_wait_cycles != 0U) {
+        if ((W9825G6KH_Perf_GetCycles() - init_wait_start) < init_wait_cycles) {
+            return W9825G6KH_BUSY;
+        }
+        init_wait_cycles = 0;
+    }
+
+    Command.CommandTarget = DeviceConfig.TargetBank;
+    Command.AutoRefreshNumber = 1;
+    Command.ModeRegisterDefinition = 0;
+
+    switch (init_state) {
+        case W9825G6KH_INIT_CLOCK_ENABLE:
+            /* Step 1: Clock Enable, then the power-up pause */
+            printf("1. Sending Clock Enable command...\n");
+            Command.CommandMode = FMC_SDRAM_CMD_CLK_ENABLE;
+            if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
+                printf("  ERROR: Clock Enable failed\n");
+                return W9825G6KH_InitFinish(W9825G6KH_ERROR);
+            }
+            printf("  OK: Clock enabled\n");
+            delay_ns = W9825G6KH_INIT_POWERUP_US * 1000U;
+            next = W9825G6KH_INIT_PRECHARGE;
+            break;
+
+        case W9825G6KH_INIT_PRECHARGE:
+            /* Step 2: Precharge All, then tRP */
+            printf("2. Sending Precharge All command...\n");
+            Command.CommandMode = FMC_SDRAM_CMD_PALL;
+            if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
+                printf("  ERROR: Precharge All failed\n");
+                return W9825G6KH_InitFinish(W9825G6KH_ERROR);
+            }
+            printf("  OK: All banks precharged\n");
+            delay_ns = W9825G6KH_TRP_NS;
+            next = W9825G6KH_INIT_AUTOREFRESH;
+            break;
+
+        case W9825G6KH_INIT_AUTOREFRESH:
+            /* Step 3: Auto Refresh (minimum 2 cycles, 8 is typical), then tRFC each */
+            printf("3. Sending Auto Refresh commands (%u cycles)...\n", (unsigned)W9825G6KH_INIT_AUTOREFRESH_COUNT);
+            Command.CommandMode = FMC_SDRAM_CMD_AUTOREFRESH_MODE;
+            Command.AutoRefreshNumber = W9825G6KH_INIT_AUTOREFRESH_COUNT;
+            if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
+                printf("  ERROR: Auto Refresh failed\n");
+                return W9825G6KH_InitFinish(W9825G6KH_ERROR);
+            }
+            printf("  OK: Auto refresh completed\n");
+            delay_ns = W9825G6KH_TRFC_NS * W9825G6KH_INIT_AUTOREFRESH_COUNT;
+            next = W9825G6KH_INIT_LOAD_MODE;
+            break;
+
+        case W9825G6KH_INIT_LOAD_MODE:
+            /* Step 4: Load Mode Register, then tMRD */
+            printf("4. Loading Mode Register...\n");
+            init_mode_register = W9825G6KH_BuildModeRegister();
+            W9825G6KH_PrintModeRegisterDetails(init_mode_register);
+
+            Command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
+            Command.ModeRegisterDefinition = init_mode_register;
+            if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
+                printf("  ERROR: Load Mode Register failed\n");
+                return W9825G6KH_InitFinish(W9825G6KH_ERROR);
+            }
+            printf("  OK: Mode register loaded\n");
+            delay_ns = W9825G6KH_TMRD_NS;
+            next = W9825G6KH_INIT_CONFIGURE;
+            break;
+
+        case W9825G6KH_INIT_CONFIGURE:
+        default:
+            /* Steps 5-6: FMC CAS check and refresh timer */
+            if (W9825G6KH_ConfigureController(init_mode_register) != W9825G6KH_OK) {
+                return W9825G6KH_InitFinish(W9825G6KH_ERROR);
+            }
+            return W9825G6KH_InitFinish(W9825G6KH_OK);
+    }
+
+    init_state = next;
+    init_wait_start = W9825G6KH_Perf_GetCycles();
+    init_wait_cycles = W9825G6KH_NsToCycles(delay_ns);
+
+    return W9825G6KH_BUSY;
+}
+
+/**
+  * @brief  Current position of the initialization sequence
+  * @retval W9825G6KH_InitStateTypeDef
+  */
+W9825G6KH_InitStateTypeDef W9825G6KH_GetInitState(void)
+{
+    return init_state;
+}
+
+/**
+  * @brief  Reports whether initialization has completed successfully
+  * @retval 1 if SDRAM is usable, 0 otherwise
+  */
+uint32_t W9825G6KH_IsReady(void)
+{
+    return (init_state == W9825G6KH_INIT_DONE) ? 1U : 0U;
+}
+
+/**
+  * @brief  Initialization complete callback
+  * @note   Called from the W9825G6KH_InitStep call that ends the sequence,
+  *         i.e. from interrupt context when the steps are timer-driven.
+  *         This function should not be modified; when the callback is
+  *         needed, implement it in the user file.
+  * @param  status: W9825G6KH_OK or W9825G6KH_ERROR
+  */
+__weak void W9825G6KH_InitCpltCallback(W9825G6KH_StatusTypeDef status)
+{
+    UNUSED(status);
+}
 
 
 /**
@@ -338,6 +603,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_DeInit(void)
     }
 
     hsdram_ptr = NULL;
+    init_state = W9825G6KH_INIT_IDLE;
     memset(&DeviceConfig, 0, sizeof(W9825G6KH_InitTypeDef));
     printf("SDRAM deinitialized\n");
 
@@ -351,6 +617,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_DeInit(void)
   */
 W9825G6KH_StatusTypeDef W9825G6KH_SendCommand(FMC_SDRAM_CommandTypeDef *Command)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+
     if (hsdram_ptr == NULL || Command == NULL) {
         return W9825G6KH_ERROR;
     }
@@ -359,6 +627,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_SendCommand(FMC_SDRAM_CommandTypeDef *Command)
         return W9825G6KH_ERROR;
     }
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_COMMAND, 0, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -369,30 +639,80 @@ W9825G6KH_StatusTypeDef W9825G6KH_SendCommand(FMC_SDRAM_CommandTypeDef *Command)
   */
 W9825G6KH_StatusTypeDef W9825G6KH_SetModeRegister(uint32_t mode_value)
 {
-    FMC_SDRAM_CommandTypeDef Command = {0};
-
     if (hsdram_ptr == NULL) {
         return W9825G6KH_ERROR;
     }
 
-    Command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
-    Command.CommandTarget = DeviceConfig.TargetBank;
-    Command.AutoRefreshNumber = 1;
-    Command.ModeRegisterDefinition = mode_value;
-
     printf("Setting mode register to: 0x%08lX\n", mode_value);
     W9825G6KH_PrintModeRegisterDetails(mode_value);
 
-    if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
-        return W9825G6KH_ERROR;
+    return W9825G6KH_LoadModeRegister(mode_value);
+}
+
+/**
+  * @brief  Registers a hook called before every checked read/write/fill/test
+  * @param  hook: Callback receiving offset, size and access type
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RegisterAccessHook(W9825G6KH_AccessHookTypeDef hook)
+{
+    if (hook == NULL) {
+        return W9825G6KH_INVALID_PARAM;
     }
 
-    DeviceConfig.BurstLength = mode_value & 0x7;
-    DeviceConfig.BurstType = mode_value & W9825G6KH_MR_BURST_TYPE_INTERLEAVED;
-    DeviceConfig.CASLatency = mode_value & 0x30;
-    DeviceConfig.WriteBurstMode = mode_value & W9825G6KH_MR_WRITE_BURST_MODE_SINGLE;
+    for (uint32_t i = 0; i < W9825G6KH_MAX_ACCESS_HOOKS; i++) {
+        if (access_hooks[i] == hook) {
+            return W9825G6KH_OK;
+        }
+    }
 
-    return W9825G6KH_OK;
+    for (uint32_t i = 0; i < W9825G6KH_MAX_ACCESS_HOOKS; i++) {
+        if (access_hooks[i] == NULL) {
+            access_hooks[i] = hook;
+            return W9825G6KH_OK;
+        }
+    }
+
+    return W9825G6KH_BUSY;
+}
+
+/**
+  * @brief  Removes a hook added with W9825G6KH_RegisterAccessHook
+  * @param  hook: Callback to remove
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_UnregisterAccessHook(W9825G6KH_AccessHookTypeDef hook)
+{
+    for (uint32_t i = 0; i < W9825G6KH_MAX_ACCESS_HOOKS; i++) {
+        if (access_hooks[i] == hook && hook != NULL) {
+            access_hooks[i] = NULL;
+            return W9825G6KH_OK;
+        }
+    }
+
+    return W9825G6KH_INVALID_PARAM;
+}
+
+/**
+  * @brief  Runs the write hooks for SDRAM changed outside the checked paths
+  * @note   For modules that write through raw pointers or DMA, so hooked
+  *         caches drop the stale lines
+  * @param  Addr: Starting address (offset from SDRAM base)
+  * @param  Size: Size in bytes
+  * @param  Skip: Caller's own hook, not run (may be NULL)
+  */
+void W9825G6KH_NotifyWrite(uint32_t Addr, uint32_t Size, W9825G6KH_AccessHookTypeDef Skip)
+{
+    if (W9825G6KH_CheckAddressRange(Addr, Size) != W9825G6KH_OK) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < W9825G6KH_MAX_ACCESS_HOOKS; i++) {
+        W9825G6KH_AccessHookTypeDef hook = access_hooks[i];
+        if (hook != NULL && hook != Skip) {
+            hook(Addr, Size, W9825G6KH_ACCESS_WRITE);
+        }
+    }
 }
 
 /* Memory Access Functions ---------------------------------------------------*/
@@ -406,6 +726,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_SetModeRegister(uint32_t mode_value)
   */
 W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint8_t *pSdram;
     W9825G6KH_StatusTypeDef status;
 
@@ -424,12 +745,16 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAd
         return status;
     }
 
+    W9825G6KH_NotifyAccess(WriteAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + WriteAddr);
     memcpy(pSdram, pBuffer, BufferSize);
 
     /* Ensure memory barrier for cache coherency */
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -442,6 +767,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAd
   */
 W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint8_t *pSdram;
     W9825G6KH_StatusTypeDef status;
 
@@ -460,12 +786,16 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr
         return status;
     }
 
+    W9825G6KH_NotifyAccess(ReadAddr, BufferSize, W9825G6KH_ACCESS_READ);
+
     pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + ReadAddr);
     memcpy(pBuffer, pSdram, BufferSize);
 
     /* Ensure memory barrier for cache coherency */
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -478,6 +808,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr
   */
 W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer16(uint16_t *pBuffer, uint32_t WriteAddr, uint32_t NumHalfWords)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint16_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumHalfWords * 2;
@@ -497,6 +828,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer16(uint16_t *pBuffer, uint32_t Writ
         return status;
     }
 
+    W9825G6KH_NotifyAccess(WriteAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint16_t *)(W9825G6KH_BANK_ADDR + WriteAddr);
 
     /* Use optimized copy for aligned access */
@@ -512,6 +845,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer16(uint16_t *pBuffer, uint32_t Writ
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -524,6 +859,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer16(uint16_t *pBuffer, uint32_t Writ
   */
 W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer16(uint16_t *pBuffer, uint32_t ReadAddr, uint32_t NumHalfWords)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint16_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumHalfWords * 2;
@@ -543,6 +879,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer16(uint16_t *pBuffer, uint32_t ReadA
         return status;
     }
 
+    W9825G6KH_NotifyAccess(ReadAddr, BufferSize, W9825G6KH_ACCESS_READ);
+
     pSdram = (uint16_t *)(W9825G6KH_BANK_ADDR + ReadAddr);
 
     /* Use optimized copy for aligned access */
@@ -558,6 +896,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer16(uint16_t *pBuffer, uint32_t ReadA
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -570,6 +910,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer16(uint16_t *pBuffer, uint32_t ReadA
   */
 W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer32(uint32_t *pBuffer, uint32_t WriteAddr, uint32_t NumWords)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint32_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumWords * 4;
@@ -589,6 +930,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer32(uint32_t *pBuffer, uint32_t Writ
         return status;
     }
 
+    W9825G6KH_NotifyAccess(WriteAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint32_t *)(W9825G6KH_BANK_ADDR + WriteAddr);
 
     /* Ensure address is 32-bit aligned for optimal performance */
@@ -606,6 +949,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer32(uint32_t *pBuffer, uint32_t Writ
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -618,6 +963,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer32(uint32_t *pBuffer, uint32_t Writ
   */
 W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer32(uint32_t *pBuffer, uint32_t ReadAddr, uint32_t NumWords)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint32_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumWords * 4;
@@ -637,6 +983,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer32(uint32_t *pBuffer, uint32_t ReadA
         return status;
     }
 
+    W9825G6KH_NotifyAccess(ReadAddr, BufferSize, W9825G6KH_ACCESS_READ);
+
     pSdram = (uint32_t *)(W9825G6KH_BANK_ADDR + ReadAddr);
 
     /* Ensure address is 32-bit aligned for optimal performance */
@@ -654,6 +1002,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer32(uint32_t *pBuffer, uint32_t ReadA
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -668,6 +1018,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer32(uint32_t *pBuffer, uint32_t ReadA
   */
 W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer(uint32_t StartAddr, uint32_t BufferSize, uint8_t Value)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint8_t *pSdram;
     W9825G6KH_StatusTypeDef status;
 
@@ -682,11 +1033,15 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer(uint32_t StartAddr, uint32_t Buffer
         return status;
     }
 
+    W9825G6KH_NotifyAccess(StartAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + StartAddr);
     memset(pSdram, Value, BufferSize);
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_FILL, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -699,6 +1054,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer(uint32_t StartAddr, uint32_t Buffer
   */
 W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer16(uint32_t StartAddr, uint32_t NumHalfWords, uint16_t Value)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint16_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumHalfWords * 2;
@@ -714,6 +1070,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer16(uint32_t StartAddr, uint32_t NumH
         return status;
     }
 
+    W9825G6KH_NotifyAccess(StartAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint16_t *)(W9825G6KH_BANK_ADDR + StartAddr);
 
     for (uint32_t i = 0; i < NumHalfWords; i++) {
@@ -722,6 +1080,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer16(uint32_t StartAddr, uint32_t NumH
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_FILL, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -734,6 +1094,7 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer16(uint32_t StartAddr, uint32_t NumH
   */
 W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer32(uint32_t StartAddr, uint32_t NumWords, uint32_t Value)
 {
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
     uint32_t *pSdram;
     W9825G6KH_StatusTypeDef status;
     uint32_t BufferSize = NumWords * 4;
@@ -749,6 +1110,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer32(uint32_t StartAddr, uint32_t NumW
         return status;
     }
 
+    W9825G6KH_NotifyAccess(StartAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint32_t *)(W9825G6KH_BANK_ADDR + StartAddr);
 
     for (uint32_t i = 0; i < NumWords; i++) {
@@ -757,6 +1120,8 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer32(uint32_t StartAddr, uint32_t NumW
 
     __DSB();
 
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_FILL, BufferSize, t0);
+
     return W9825G6KH_OK;
 }
 
@@ -771,6 +1136,10 @@ W9825G6KH_StatusTypeDef W9825G6KH_MemoryTest(uint32_t StartAddr, uint32_t TestSi
     uint32_t *pSdram;
     uint32_t num_words;
     W9825G6KH_StatusTypeDef status;
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t errors = 0;
+    uint32_t fail_word = 0;
+    uint32_t fail_got = 0;
 
     static const uint32_t test_patterns[] = {
         0x00000000,  /* All zeros */
@@ -796,14 +1165,16 @@ W9825G6KH_StatusTypeDef W9825G6KH_MemoryTest(uint32_t StartAddr, uint32_t TestSi
         return status;
     }
 
+    W9825G6KH_NotifyAccess(StartAddr, TestSize, W9825G6KH_ACCESS_WRITE);
+
     pSdram = (uint32_t *)(W9825G6KH_BANK_ADDR + StartAddr);
     num_words = TestSize / 4;
 
-    printf("Running memory test (%lu bytes, %lu words)...\n", TestSize, num_words);
+    W9825G6KH_DIAG_PRINTF("Running memory test (%lu bytes, %lu words)...\n", TestSize, num_words);
 
     for (uint32_t p = 0; p < num_patterns; p++) {
         uint32_t pattern = test_patterns[p];
-        printf("  Pattern 0x%08lX: ", pattern);
+        W9825G6KH_DIAG_PRINTF("  Pattern 0x%08lX: ", pattern);
 
         /* Write pattern */
         for (uint32_t i = 0; i < num_words; i++) {
@@ -811,76 +1182,1435 @@ W9825G6KH_StatusTypeDef W9825G6KH_MemoryTest(uint32_t StartAddr, uint32_t TestSi
         }
 
         /* Read back and verify */
-        uint32_t errors = 0;
         for (uint32_t i = 0; i < num_words; i++) {
-            if (pSdram[i] != pattern) {
+            uint32_t got = pSdram[i];
+            if (got != pattern) {
                 errors++;
-                if (errors == 1) {  /* Print first error only */
-                    printf("FAIL at word %lu (got 0x%08lX)\n",
-                           i, pSdram[i]);
+                if (errors == 1) {  /* Report first error only */
+                    fail_word = i;
+                    fail_got = got;
+                    W9825G6KH_DIAG_PRINTF("FAIL at word %lu (got 0x%08lX)\n", i, got);
                 }
             }
         }
 
         if (errors == 0) {
-            printf("PASS\n");
+            W9825G6KH_DIAG_PRINTF("PASS\n");
         } else {
-            printf("  Total errors: %lu\n", errors);
+            W9825G6KH_DIAG_PRINTF("  Total errors: %lu\n", errors);
+            W9825G6KH_Tlm_SendMemTest(StartAddr, TestSize, W9825G6KH_ERROR, p, errors, fail_word, fail_got,
+                                      W9825G6KH_Perf_GetCycles() - t0);
             return W9825G6KH_ERROR;
         }
     }
 
     /* Test incremental pattern */
-    printf("  Incremental pattern: ");
+    W9825G6KH_DIAG_PRINTF("  Incremental pattern: ");
     for (uint32_t i = 0; i < num_words; i++) {
         pSdram[i] = i;
     }
 
-    uint32_t errors = 0;
     for (uint32_t i = 0; i < num_words; i++) {
-        if (pSdram[i] != i) {
+        uint32_t got = pSdram[i];
+        if (got != i) {
             errors++;
             if (errors == 1) {
-                printf("FAIL at word %lu (got 0x%08lX)\n",
-                       i, pSdram[i]);
+                fail_word = i;
+                fail_got = got;
+                W9825G6KH_DIAG_PRINTF("FAIL at word %lu (got 0x%08lX)\n", i, got);
             }
         }
     }
 
     if (errors == 0) {
-        printf("PASS\n");
+        W9825G6KH_DIAG_PRINTF("PASS\n");
     } else {
-        printf("  Total errors: %lu\n", errors);
+        W9825G6KH_DIAG_PRINTF("  Total errors: %lu\n", errors);
+        W9825G6KH_Tlm_SendMemTest(StartAddr, TestSize, W9825G6KH_ERROR, W9825G6KH_TLM_PATTERN_INCREMENT,
+                                  errors, fail_word, fail_got, W9825G6KH_Perf_GetCycles() - t0);
         return W9825G6KH_ERROR;
     }
 
-    printf("Memory test completed successfully\n");
+    W9825G6KH_DIAG_PRINTF("Memory test completed successfully\n");
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_MEMTEST, TestSize, t0);
+    W9825G6KH_Tlm_SendMemTest(StartAddr, TestSize, W9825G6KH_OK, W9825G6KH_TLM_PATTERN_NONE, 0U, 0U, 0U,
+                              W9825G6KH_Perf_GetCycles() - t0);
     return W9825G6KH_OK;
 }
 
-/* Refresh Control Functions -------------------------------------------------*/
+/* 2D Block Transfer Functions -----------------------------------------------*/
 
 /**
-  * @brief  Calculates refresh rate based on clock frequency
-  * @param  SDRAMClockFreqMHz: SDRAM clock frequency in MHz
-  * @param  RefreshTimeMs: Refresh time in milliseconds (typically 64ms)
-  * @retval Calculated refresh rate value
+  * @brief  Validates a rectangle once for the whole transfer
+  * @param  addr: Top-left offset from SDRAM base
+  * @param  pitch: Bytes between line starts
+  * @param  Rect: Geometry
+  * @param  pSpan: Receives the bytes from the first to the last pixel
+  * @retval W9825G6KH status
   */
+static W9825G6KH_StatusTypeDef W9825G6KH_CheckRect(uint32_t addr, uint32_t pitch, const W9825G6KH_RectTypeDef *Rect, uint32_t *pSpan)
+{
+    uint64_t row_bytes, span;
 
+    if (Rect == NULL || Rect->Width == 0 || Rect->Height == 0 ||
+        Rect->PixelSize == 0 || Rect->PixelSize > 4U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
 
+    row_bytes = (uint64_t)Rect->Width * Rect->PixelSize;
+    if (Rect->Height > 1U && pitch < row_bytes) {
+        return W9825G6KH_INVALID_PARAM;   /* Lines would overlap */
+    }
 
-uint32_t W9825G6KH_CalculateRefreshRate(uint32_t clock_freq_mhz, uint32_t refresh_time_ms)
+    span = (uint64_t)(Rect->Height - 1U) * pitch + row_bytes;
+    if (span > sdram_size_bytes) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    *pSpan = (uint32_t)span;
+    return W9825G6KH_CheckAddressRange(addr, (uint32_t)span);
+}
+
+#if defined(DMA2D)
+/**
+  * @brief  Finishes the job left running on DMA2D, if any
+  * @note   Caller owns DMA2D. A job still running W9825G6KH_DMA2D_TIMEOUT_US
+  *         after it was started is aborted and recorded as failed.
+  * @param  Wait: 0 to check only once
+  */
+static void W9825G6KH_Dma2d_Retire(uint32_t Wait)
 {
-    // For 100MHz, 64ms refresh, 4096 rows
-    // Correct calculation: (64ms / 4096) / (10ns) = 1562.5 ≈ 1563
+    W9825G6KH_Dma2dJobTypeDef *job = dma2d_pending;
+    uint32_t timeout = W9825G6KH_NsToCycles(W9825G6KH_DMA2D_TIMEOUT_US * 1000U);
+    uint32_t flags;
 
-    uint32_t refresh_interval_ns = (refresh_time_ms * 1000000UL) / 4096;  // 15625ns
-    uint32_t clock_period_ns = 1000 / clock_freq_mhz;  // 10ns for 100MHz
+    if (job == NULL) {
+        return;
+    }
 
-    uint32_t refresh_count = (refresh_interval_ns + clock_period_ns/2) / clock_period_ns;
+    for (;;) {
+        flags = DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF);
+        if (flags != 0U) {
+            break;
+        }
+        if ((W9825G6KH_Perf_GetCycles() - job->StartCycles) >= timeout) {
+            DMA2D->CR |= DMA2D_CR_ABORT;
+            break;
+        }
+        if (!Wait) {
+            return;
+        }
+    }
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
 
-    // Round up to even number (FMC requirement)
-    if (refresh_count & 1) refresh_count++;
+    dma2d_pending = NULL;
+    W9825G6KH_AtomicStore32(&job->State, (flags == DMA2D_ISR_TCIF) ? W9825G6KH_DMA2D_JOB_DONE
+                                                                   : W9825G6KH_DMA2D_JOB_FAILED);
+}
+
+/**
+  * @brief  Takes DMA2D for programming a transfer
+  * @note   Retires the job another user left running, so the caller starts
+  *         from clear flags. Pair with W9825G6KH_Dma2d_Release once the
+  *         transfer is started (or finished). Not for use from an ISR.
+  * @param  TimeoutMs: How long to wait while another user is programming
+  *         DMA2D; 0 to try once
+  * @retval W9825G6KH_OK, or W9825G6KH_BUSY if DMA2D could not be taken
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Dma2d_Acquire(uint32_t TimeoutMs)
+{
+    uint32_t tickstart = HAL_GetTick();
+    uint32_t expected = 0U;
+
+    while (!W9825G6KH_AtomicCas32(&dma2d_owned, &expected, 1U)) {
+        if ((HAL_GetTick() - tickstart) >= TimeoutMs) {
+            return W9825G6KH_BUSY;
+        }
+        expected = 0U;
+    }
+
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    W9825G6KH_Dma2d_Retire(1U);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Gives DMA2D back
+  * @param  Job: The transfer just started and left running, tracked until
+  *         its owner polls it; NULL if the caller waited for its transfer
+  */
+void W9825G6KH_Dma2d_Release(W9825G6KH_Dma2dJobTypeDef *Job)
+{
+    if (Job != NULL) {
+        Job->StartCycles = W9825G6KH_Perf_GetCycles();
+        W9825G6KH_AtomicStore32(&Job->State, W9825G6KH_DMA2D_JOB_RUNNING);
+        dma2d_pending = Job;
+    }
+    W9825G6KH_AtomicStore32(&dma2d_owned, 0U);
+}
+
+/**
+  * @brief  Checks a job left running by W9825G6KH_Dma2d_Release
+  * @note   The job may already have been retired by another user; its
+  *         recorded outcome is returned then. Waiting is bounded by
+  *         W9825G6KH_DMA2D_TIMEOUT_US, after which the job is aborted.
+  * @param  Wait: 1 to wait for completion
+  * @retval W9825G6KH_OK when the transfer completed, W9825G6KH_BUSY while it
+  *         runs, W9825G6KH_ERROR if it failed or was aborted (the owner
+  *         redoes the work with the CPU)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Dma2d_Poll(W9825G6KH_Dma2dJobTypeDef *Job, uint32_t Wait)
+{
+    uint32_t state;
+    uint32_t expected;
+
+    if (Job == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    for (;;) {
+        state = W9825G6KH_AtomicLoad32(&Job->State);
+        if (state != W9825G6KH_DMA2D_JOB_RUNNING) {
+            break;
+        }
+
+        expected = 0U;
+        if (W9825G6KH_AtomicCas32(&dma2d_owned, &expected, 1U)) {
+            if (dma2d_pending == Job) {
+                W9825G6KH_Dma2d_Retire(0U);
+            }
+            W9825G6KH_AtomicStore32(&dma2d_owned, 0U);
+
+            state = W9825G6KH_AtomicLoad32(&Job->State);
+            if (state != W9825G6KH_DMA2D_JOB_RUNNING) {
+                break;
+            }
+        }
+
+        if (!Wait) {
+            return W9825G6KH_BUSY;
+        }
+    }
+
+    return (state == W9825G6KH_DMA2D_JOB_DONE) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+#endif /* DMA2D */
+
+#if W9825G6KH_BLIT_USE_DMA2D
+/**
+  * @brief  Runs one DMA2D memory-to-memory or register-to-memory transfer
+  * @note   Addresses are CPU addresses; caller has checked Dma2dUsable
+  * @retval W9825G6KH status (W9825G6KH_BUSY if DMA2D stayed taken)
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_Blit_Dma2d(uint32_t src, uint32_t src_pitch, uint32_t src_span,
+                                                    uint32_t dst, uint32_t dst_pitch, uint32_t dst_span,
+                                                    const W9825G6KH_RectTypeDef *Rect, uint32_t Color)
+{
+    uint32_t ps = Rect->PixelSize;
+    uint32_t cm = (ps == 4U) ? 0U : (ps == 3U) ? 1U : 2U;   /* ARGB8888 / RGB888 / RGB565 */
+    uint32_t tickstart;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (W9825G6KH_Dma2d_Acquire(W9825G6KH_CMD_TIMEOUT) != W9825G6KH_OK) {
+        return W9825G6KH_BUSY;
+    }
+
+    /* DMA2D sees memory, not the D-cache */
+    if (src != 0U) {
+        SCB_CleanDCache_by_Addr((uint32_t *)src, (int32_t)src_span);
+    }
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)dst_span);
+
+    DMA2D->CR = (src != 0U) ? 0U : DMA2D_CR_MODE;   /* M2M or R2M */
+    DMA2D->FGMAR = src;
+    DMA2D->FGOR = (src != 0U) ? (src_pitch / ps - Rect->Width) : 0U;
+    DMA2D->FGPFCCR = cm;
+    DMA2D->OPFCCR = cm;
+    DMA2D->OCOLR = Color;
+    DMA2D->OMAR = dst;
+    DMA2D->OOR = dst_pitch / ps - Rect->Width;
+    DMA2D->NLR = (Rect->Width << DMA2D_NLR_PL_Pos) | Rect->Height;
+    DMA2D->CR |= DMA2D_CR_START;
+
+    tickstart = HAL_GetTick();
+    while ((DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) == 0U) {
+        if ((HAL_GetTick() - tickstart) > W9825G6KH_CMD_TIMEOUT) {
+            DMA2D->CR |= DMA2D_CR_ABORT;
+            status = W9825G6KH_TIMEOUT;
+            break;
+        }
+    }
+
+    if (status == W9825G6KH_OK && (DMA2D->ISR & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) != 0U) {
+        status = W9825G6KH_ERROR;
+    }
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+    W9825G6KH_Dma2d_Release(NULL);
+
+    if (status == W9825G6KH_OK) {
+        SCB_InvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)dst_span);
+    }
+    return status;
+}
+
+/**
+  * @brief  Tells whether DMA2D can express the transfer
+  * @retval 1 if usable, 0 to take the CPU path
+  */
+static uint32_t W9825G6KH_Blit_Dma2dUsable(uint32_t src_pitch, uint32_t dst_pitch, const W9825G6KH_RectTypeDef *Rect)
+{
+    uint32_t ps = Rect->PixelSize;
+
+    return (ps >= 2U && (src_pitch % ps) == 0U && (dst_pitch % ps) == 0U &&
+            Rect->Width <= 0x3FFFU && Rect->Height <= 0xFFFFU &&
+            src_pitch / ps - Rect->Width <= 0x3FFFU && dst_pitch / ps - Rect->Width <= 0x3FFFU) ? 1U : 0U;
+}
+#endif /* W9825G6KH_BLIT_USE_DMA2D */
+
+/**
+  * @brief  Copies a rectangle from SDRAM to a buffer
+  * @param  pDst: Destination buffer
+  * @param  DstPitch: Destination bytes per line
+  * @param  SrcAddr: Top-left offset in SDRAM
+  * @param  SrcPitch: SDRAM bytes per line
+  * @param  Rect: Width, height and pixel size
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_ReadRect(uint8_t *pDst, uint32_t DstPitch, uint32_t SrcAddr, uint32_t SrcPitch, const W9825G6KH_RectTypeDef *Rect)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t span, row_bytes;
+    uint8_t *pSdram;
+    W9825G6KH_StatusTypeDef status;
+
+    if (pDst == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckRect(SrcAddr, SrcPitch, Rect, &span);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+    row_bytes = Rect->Width * Rect->PixelSize;
+    if (Rect->Height > 1U && DstPitch < row_bytes) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(SrcAddr, span, W9825G6KH_ACCESS_READ);
+
+    pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + SrcAddr);
+
+#if W9825G6KH_BLIT_USE_DMA2D
+    if (W9825G6KH_Blit_Dma2dUsable(SrcPitch, DstPitch, Rect)) {
+        status = W9825G6KH_Blit_Dma2d((uint32_t)pSdram, SrcPitch, span,
+                                      (uint32_t)pDst, DstPitch, (Rect->Height - 1U) * DstPitch + row_bytes,
+                                      Rect, 0);
+    } else
+#endif
+    {
+        /* Top to bottom: each line is one sequential run through its rows */
+        for (uint32_t y = 0; y < Rect->Height; y++) {
+            memcpy(pDst + y * DstPitch, pSdram + y * SrcPitch, row_bytes);
+        }
+        __DSB();
+    }
+
+    if (status == W9825G6KH_OK) {
+        W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, row_bytes * Rect->Height, t0);
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Copies a rectangle from a buffer to SDRAM
+  * @param  pSrc: Source buffer
+  * @param  SrcPitch: Source bytes per line
+  * @param  DstAddr: Top-left offset in SDRAM
+  * @param  DstPitch: SDRAM bytes per line
+  * @param  Rect: Width, height and pixel size
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WriteRect(const uint8_t *pSrc, uint32_t SrcPitch, uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t span, row_bytes;
+    uint8_t *pSdram;
+    W9825G6KH_StatusTypeDef status;
+
+    if (pSrc == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckRect(DstAddr, DstPitch, Rect, &span);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+    row_bytes = Rect->Width * Rect->PixelSize;
+    if (Rect->Height > 1U && SrcPitch < row_bytes) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(DstAddr, span, W9825G6KH_ACCESS_WRITE);
+
+    pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + DstAddr);
+
+#if W9825G6KH_BLIT_USE_DMA2D
+    if (W9825G6KH_Blit_Dma2dUsable(SrcPitch, DstPitch, Rect)) {
+        status = W9825G6KH_Blit_Dma2d((uint32_t)pSrc, SrcPitch, (Rect->Height - 1U) * SrcPitch + row_bytes,
+                                      (uint32_t)pSdram, DstPitch, span, Rect, 0);
+    } else
+#endif
+    {
+        for (uint32_t y = 0; y < Rect->Height; y++) {
+            memcpy(pSdram + y * DstPitch, pSrc + y * SrcPitch, row_bytes);
+        }
+        __DSB();
+    }
+
+    if (status == W9825G6KH_OK) {
+        W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, row_bytes * Rect->Height, t0);
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Copies a rectangle within SDRAM
+  * @note   Lines go through an SRAM stage in batches, so the SDRAM sees long
+  *         runs of reads then long runs of writes instead of alternating
+  *         between the source and destination rows on every burst.
+  *         Overlapping rectangles are handled when both pitches are equal.
+  * @param  SrcAddr: Source top-left offset
+  * @param  SrcPitch: Source bytes per line
+  * @param  DstAddr: Destination top-left offset
+  * @param  DstPitch: Destination bytes per line
+  * @param  Rect: Width, height and pixel size
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_CopyRect(uint32_t SrcAddr, uint32_t SrcPitch, uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect)
+{
+    static uint8_t stage[W9825G6KH_BLIT_STAGE_BYTES] W9825G6KH_DTCM_ATTR;
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t src_span, dst_span, row_bytes, lines, chunk;
+    uint32_t backward;
+    uint8_t *pSrc, *pDst;
+    W9825G6KH_StatusTypeDef status;
+
+    status = W9825G6KH_CheckRect(SrcAddr, SrcPitch, Rect, &src_span);
+    if (status == W9825G6KH_OK) {
+        status = W9825G6KH_CheckRect(DstAddr, DstPitch, Rect, &dst_span);
+    }
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(SrcAddr, src_span, W9825G6KH_ACCESS_READ);
+    W9825G6KH_NotifyAccess(DstAddr, dst_span, W9825G6KH_ACCESS_WRITE);
+
+    pSrc = (uint8_t *)(W9825G6KH_BANK_ADDR + SrcAddr);
+    pDst = (uint8_t *)(W9825G6KH_BANK_ADDR + DstAddr);
+    row_bytes = Rect->Width * Rect->PixelSize;
+
+#if W9825G6KH_BLIT_USE_DMA2D
+    if (W9825G6KH_Blit_Dma2dUsable(SrcPitch, DstPitch, Rect) &&
+        (DstAddr >= SrcAddr + src_span || SrcAddr >= DstAddr + dst_span)) {
+        status = W9825G6KH_Blit_Dma2d((uint32_t)pSrc, SrcPitch, src_span,
+                                      (uint32_t)pDst, DstPitch, dst_span, Rect, 0);
+        if (status == W9825G6KH_OK) {
+            W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, row_bytes * Rect->Height, t0);
+        }
+        return status;
+    }
+#endif
+
+    /* Whole lines per batch when they fit, else one line in pieces */
+    lines = (row_bytes <= W9825G6KH_BLIT_STAGE_BYTES) ? W9825G6KH_BLIT_STAGE_BYTES / row_bytes : 1U;
+    chunk = (row_bytes <= W9825G6KH_BLIT_STAGE_BYTES) ? row_bytes : W9825G6KH_BLIT_STAGE_BYTES;
+    backward = (DstAddr > SrcAddr && DstAddr < SrcAddr + src_span) ? 1U : 0U;
+
+    for (uint32_t done = 0; done < Rect->Height; done += lines) {
+        uint32_t n = (Rect->Height - done < lines) ? Rect->Height - done : lines;
+        uint32_t first = backward ? Rect->Height - done - n : done;
+
+        for (uint32_t off = 0; off < row_bytes; off += chunk) {
+            uint32_t len = (row_bytes - off < chunk) ? row_bytes - off : chunk;
+            uint32_t col = backward ? row_bytes - off - len : off;
+
+            for (uint32_t i = 0; i < n; i++) {
+                memcpy(stage + i * len, pSrc + (first + i) * SrcPitch + col, len);
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                memcpy(pDst + (first + i) * DstPitch + col, stage + i * len, len);
+            }
+        }
+    }
+
+    __DSB();
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, row_bytes * Rect->Height, t0);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Fills a rectangle in SDRAM with one pixel value
+  * @param  DstAddr: Top-left offset in SDRAM
+  * @param  DstPitch: Bytes per line
+  * @param  Rect: Width, height and pixel size
+  * @param  Color: Pixel value, low PixelSize bytes used (little endian)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_FillRect(uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect, uint32_t Color)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t span, row_bytes, width, height, pitch;
+    uint32_t ps;
+    uint8_t *pSdram;
+    W9825G6KH_StatusTypeDef status;
+
+    status = W9825G6KH_CheckRect(DstAddr, DstPitch, Rect, &span);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(DstAddr, span, W9825G6KH_ACCESS_WRITE);
+
+    pSdram = (uint8_t *)(W9825G6KH_BANK_ADDR + DstAddr);
+    ps = Rect->PixelSize;
+    row_bytes = Rect->Width * ps;
+
+#if W9825G6KH_BLIT_USE_DMA2D
+    if (W9825G6KH_Blit_Dma2dUsable(DstPitch, DstPitch, Rect)) {
+        status = W9825G6KH_Blit_Dma2d(0, 0, 0, (uint32_t)pSdram, DstPitch, span, Rect, Color);
+        if (status == W9825G6KH_OK) {
+            W9825G6KH_Perf_Record(W9825G6KH_PERF_FILL, row_bytes * Rect->Height, t0);
+        }
+        return status;
+    }
+#endif
+
+    /* A rectangle with no gaps between lines is one long line */
+    width = Rect->Width;
+    height = Rect->Height;
+    pitch = DstPitch;
+    if (DstPitch == row_bytes) {
+        width *= height;
+        height = 1;
+    }
+
+    for (uint32_t y = 0; y < height; y++) {
+        uint8_t *line = pSdram + y * pitch;
+
+        if (ps == 1U) {
+            memset(line, (int)(Color & 0xFFU), width);
+        } else if (ps == 4U && ((uint32_t)line % 4U) == 0U) {
+            uint32_t *p32 = (uint32_t *)line;
+            for (uint32_t x = 0; x < width; x++) {
+                p32[x] = Color;
+            }
+        } else if (ps == 2U && ((uint32_t)line % 2U) == 0U) {
+            uint16_t *p16 = (uint16_t *)line;
+            for (uint32_t x = 0; x < width; x++) {
+                p16[x] = (uint16_t)Color;
+            }
+        } else {
+            for (uint32_t x = 0; x < width * ps; x += ps) {
+                for (uint32_t b = 0; b < ps; b++) {
+                    line[x + b] = (uint8_t)(Color >> (8U * b));
+                }
+            }
+        }
+    }
+
+    __DSB();
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_FILL, row_bytes * Rect->Height, t0);
+
+    return W9825G6KH_OK;
+}
+
+/* Integrity Functions -------------------------------------------------------*/
+
+/**
+  * @brief  Copies while folding every word into a CRC state (one pass)
+  * @note   The destination is word aligned first; source words may be
+  *         unaligned, which Cortex-M7 handles for normal memory
+  * @param  state: Inverted CRC (see W9825G6KH_Crc32_StepWord)
+  * @retval Updated state
+  */
+static uint32_t W9825G6KH_CopyCrc(uint8_t *dst, const uint8_t *src, uint32_t size, uint32_t state)
+{
+    while (size > 0U && ((uintptr_t)dst & 3U) != 0U) {
+        *dst = *src++;
+        state = W9825G6KH_Crc32_StepByte(state, *dst++);
+        size--;
+    }
+
+    while (size >= 8U) {
+        uint32_t w0, w1;
+        memcpy(&w0, src, 4);
+        memcpy(&w1, src + 4, 4);
+        ((uint32_t *)dst)[0] = w0;
+        ((uint32_t *)dst)[1] = w1;
+        state = W9825G6KH_Crc32_StepWord(state, w0);
+        state = W9825G6KH_Crc32_StepWord(state, w1);
+        src += 8;
+        dst += 8;
+        size -= 8U;
+    }
+
+    while (size > 0U) {
+        *dst = *src++;
+        state = W9825G6KH_Crc32_StepByte(state, *dst++);
+        size--;
+    }
+
+    return state;
+}
+
+/**
+  * @brief  Writes a buffer to SDRAM and updates a CRC-32 of the data in the
+  *         same pass, with no re-read of SDRAM
+  * @param  pBuffer: Source data
+  * @param  WriteAddr: Write address (offset from SDRAM base)
+  * @param  BufferSize: Size of buffer in bytes
+  * @param  pCrc: CRC in/out (set to 0 before the first call)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WriteBufferCrc(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize, uint32_t *pCrc)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    W9825G6KH_StatusTypeDef status;
+
+    if (pBuffer == NULL || pCrc == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckAddressRange(WriteAddr, BufferSize);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(WriteAddr, BufferSize, W9825G6KH_ACCESS_WRITE);
+    W9825G6KH_Crc32_Init();
+
+    *pCrc = ~W9825G6KH_CopyCrc((uint8_t *)(W9825G6KH_BANK_ADDR + WriteAddr), pBuffer, BufferSize, ~*pCrc);
+
+    __DSB();
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_WRITE, BufferSize, t0);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Reads a buffer from SDRAM and updates a CRC-32 of the data in the
+  *         same pass
+  * @param  pBuffer: Destination buffer
+  * @param  ReadAddr: Read address (offset from SDRAM base)
+  * @param  BufferSize: Size of buffer in bytes
+  * @param  pCrc: CRC in/out (set to 0 before the first call)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_ReadBufferCrc(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize, uint32_t *pCrc)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    W9825G6KH_StatusTypeDef status;
+
+    if (pBuffer == NULL || pCrc == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckAddressRange(ReadAddr, BufferSize);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(ReadAddr, BufferSize, W9825G6KH_ACCESS_READ);
+    W9825G6KH_Crc32_Init();
+
+    *pCrc = ~W9825G6KH_CopyCrc(pBuffer, (const uint8_t *)(W9825G6KH_BANK_ADDR + ReadAddr), BufferSize, ~*pCrc);
+
+    __DSB();
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, BufferSize, t0);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Computes the CRC-32 of an SDRAM region
+  * @param  StartAddr: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @param  pCrc: CRC in/out (set to 0 to start a new checksum)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Checksum(uint32_t StartAddr, uint32_t Size, uint32_t *pCrc)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    W9825G6KH_StatusTypeDef status;
+
+    if (pCrc == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckAddressRange(StartAddr, Size);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(StartAddr, Size, W9825G6KH_ACCESS_READ);
+
+    *pCrc = W9825G6KH_Crc32(*pCrc, (const uint8_t *)(W9825G6KH_BANK_ADDR + StartAddr), Size);
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, Size, t0);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Compares an SDRAM region with a buffer, word at a time
+  * @param  StartAddr: Region start (offset from SDRAM base)
+  * @param  pBuffer: Expected data
+  * @param  Size: Bytes to compare
+  * @param  pMismatch: Receives the offset of the first differing byte (may
+  *         be NULL)
+  * @retval W9825G6KH_OK if equal, W9825G6KH_ERROR on the first difference
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Compare(uint32_t StartAddr, const uint8_t *pBuffer, uint32_t Size, uint32_t *pMismatch)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    const uint8_t *pSdram;
+    W9825G6KH_StatusTypeDef status;
+    uint32_t i = 0;
+
+    if (pBuffer == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_CheckAddressRange(StartAddr, Size);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    /* Wait if SDRAM is busy */
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_NotifyAccess(StartAddr, Size, W9825G6KH_ACCESS_READ);
+
+    pSdram = (const uint8_t *)(W9825G6KH_BANK_ADDR + StartAddr);
+
+    while (i < Size && ((uintptr_t)(pSdram + i) & 3U) != 0U && pSdram[i] == pBuffer[i]) {
+        i++;
+    }
+    if (i < Size && ((uintptr_t)(pSdram + i) & 3U) == 0U) {
+        for (; i + 4U <= Size; i += 4U) {
+            uint32_t expected;
+            memcpy(&expected, pBuffer + i, 4);
+            if (*(const uint32_t *)(pSdram + i) != expected) {
+                break;
+            }
+        }
+    }
+    while (i < Size && pSdram[i] == pBuffer[i]) {
+        i++;
+    }
+
+    W9825G6KH_Perf_Record(W9825G6KH_PERF_READ, i, t0);
+
+    if (i < Size) {
+        if (pMismatch != NULL) {
+            *pMismatch = StartAddr + i;
+        }
+        return W9825G6KH_ERROR;
+    }
+
+    return W9825G6KH_OK;
+}
+
+/* Refresh Control Functions -------------------------------------------------*/
+
+/**
+  * @brief  Calculates refresh rate based on clock frequency
+  * @param  SDRAMClockFreqMHz: SDRAM clock frequency in MHz
+  * @param  RefreshTimeMs: Refresh time in milliseconds (typically 64ms)
+  * @retval Calculated refresh rate value
+  */
+
+
+
+uint32_t W9825G6KH_CalculateRefreshRate(uint32_t clock_freq_mhz, uint32_t refresh_time_ms)
+{
+    // For 100MHz, 64ms refresh, 4096 rows
+    // Correct calculation: (64ms / 4096) / (10ns) = 1562.5 ≈ 1563
+
+    uint32_t refresh_interval_ns = (refresh_time_ms * 1000000UL) / 4096;  // 15625ns
+    uint32_t clock_period_ns = 1000 / clock_freq_mhz;  // 10ns for 100MHz
+
+    uint32_t refresh_count = (refresh_interval_ns + clock_period_ns/2) / clock_period_ns;
+
+    // Round up to even number (FMC requirement)
+    if (refresh_count & 1) refresh_count++;
 
     return refresh_count;  // Should be 1563 for 100MHz
 }
+
+/**
+  * @brief  Programs the FMC auto-refresh timer
+  * @param  RefreshRate: Refresh counter value (see W9825G6KH_CalculateRefreshRate)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_SetRefreshRate(uint32_t RefreshRate)
+{
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    /* SDRTR COUNT is 13 bits and must exceed the refresh cycle time */
+    if (RefreshRate < 41U || RefreshRate > 0x1FFFU) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (HAL_SDRAM_ProgramRefreshRate(hsdram_ptr, RefreshRate) != HAL_OK) {
+        return W9825G6KH_ERROR;
+    }
+
+    DeviceConfig.RefreshRate = RefreshRate;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Changes the CAS latency of both the FMC and the SDRAM
+  * @note   The FMC read sampling point is updated first, then the mode
+  *         register is reloaded. No SDRAM access may be in flight, so do
+  *         not call with code or stack running from SDRAM.
+  * @param  CASLatency: W9825G6KH_MR_CAS_LATENCY_2 or W9825G6KH_MR_CAS_LATENCY_3
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_SetCASLatency(uint32_t CASLatency)
+{
+    uint32_t fmc_cas;
+    uint32_t sdcr;
+
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    if (CASLatency == W9825G6KH_MR_CAS_LATENCY_2) {
+        fmc_cas = FMC_SDRAM_CAS_LATENCY_2;
+    } else if (CASLatency == W9825G6KH_MR_CAS_LATENCY_3) {
+        fmc_cas = FMC_SDRAM_CAS_LATENCY_3;
+    } else {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    __DSB();
+
+    /* FMC_SDRAM_CAS_LATENCY_x are already in SDCR field position */
+    sdcr = FMC_Bank5_6_R->SDCR[0];
+    sdcr &= ~FMC_SDCRx_CAS;
+    sdcr |= fmc_cas;
+    FMC_Bank5_6_R->SDCR[0] = sdcr;
+    hsdram_ptr->Init.CASLatency = fmc_cas;
+
+    return W9825G6KH_SetModeRegister(DeviceConfig.BurstLength |
+                                     DeviceConfig.BurstType |
+                                     CASLatency |
+                                     DeviceConfig.OperatingMode |
+                                     DeviceConfig.WriteBurstMode);
+}
+
+/**
+  * @brief  Changes the burst length, write-burst mode and FMC read burst
+  * @note   Quiesces SDRAM traffic (D-cache cleaned, interrupts masked),
+  *         closes all rows with PALL, then sets SDCR RBURST and reloads the
+  *         mode register with the other fields unchanged. DMA must be idle
+  *         and no code or stack may run from SDRAM.
+  * @param  BurstLength: W9825G6KH_MR_BURST_LENGTH_x (FULL_PAGE only with
+  *         sequential bursts)
+  * @param  WriteBurstMode: W9825G6KH_MR_WRITE_BURST_MODE_PROGRAMMED or _SINGLE
+  * @param  ReadBurst: FMC_SDRAM_RBURST_ENABLE or FMC_SDRAM_RBURST_DISABLE
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_SetBurstMode(uint32_t BurstLength, uint32_t WriteBurstMode, uint32_t ReadBurst)
+{
+    FMC_SDRAM_CommandTypeDef Command = {0};
+    W9825G6KH_StatusTypeDef status;
+    uint32_t mode;
+    uint32_t sdcr;
+    uint32_t primask;
+
+    if (BurstLength > W9825G6KH_MR_BURST_LENGTH_8 && BurstLength != W9825G6KH_MR_BURST_LENGTH_FULL_PAGE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (WriteBurstMode != W9825G6KH_MR_WRITE_BURST_MODE_PROGRAMMED &&
+        WriteBurstMode != W9825G6KH_MR_WRITE_BURST_MODE_SINGLE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (ReadBurst != FMC_SDRAM_RBURST_ENABLE && ReadBurst != FMC_SDRAM_RBURST_DISABLE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    mode = init_mode_register & ~(W9825G6KH_MR_BURST_LENGTH_MASK | W9825G6KH_MR_WRITE_BURST_MODE_SINGLE);
+    mode |= BurstLength | WriteBurstMode;
+    if (BurstLength == W9825G6KH_MR_BURST_LENGTH_FULL_PAGE && (mode & W9825G6KH_MR_BURST_TYPE_INTERLEAVED) != 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache();
+#endif
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    __DSB();
+
+    Command.CommandMode = FMC_SDRAM_CMD_PALL;
+    Command.CommandTarget = DeviceConfig.TargetBank;
+    Command.AutoRefreshNumber = 1;
+    Command.ModeRegisterDefinition = 0;
+
+    if (HAL_SDRAM_SendCommand(hsdram_ptr, &Command, W9825G6KH_COMMAND_TIMEOUT) != HAL_OK) {
+        status = W9825G6KH_ERROR;
+    } else {
+        /* RBURST only exists in SDCR1 and applies to both banks */
+        sdcr = FMC_Bank5_6_R->SDCR[0];
+        sdcr &= ~FMC_SDCRx_RBURST;
+        sdcr |= ReadBurst;
+        FMC_Bank5_6_R->SDCR[0] = sdcr;
+        hsdram_ptr->Init.ReadBurst = ReadBurst;
+
+        status = W9825G6KH_LoadModeRegister(mode);
+    }
+
+    __DSB();
+    __set_PRIMASK(primask);
+
+    if (status == W9825G6KH_OK) {
+        W9825G6KH_Tlm_SendModeRegister(mode, FMC_Bank5_6_R->SDCR[0]);
+    }
+
+    return status;
+}
+
+/**
+  * @brief  FMC read burst setting (SDCR1 RBURST)
+  * @retval FMC_SDRAM_RBURST_ENABLE or FMC_SDRAM_RBURST_DISABLE
+  */
+uint32_t W9825G6KH_GetReadBurst(void)
+{
+    return FMC_Bank5_6_R->SDCR[0] & FMC_SDCRx_RBURST;
+}
+
+/**
+  * @brief  Copies the active configuration (mode register fields and
+  *         refresh rate as last programmed)
+  * @param  Config: Destination
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_GetConfig(W9825G6KH_InitTypeDef *Config)
+{
+    if (Config == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    memcpy(Config, &DeviceConfig, sizeof(W9825G6KH_InitTypeDef));
+
+    return W9825G6KH_OK;
+}
+
+/* Clock Scaling Functions ---------------------------------------------------*/
+
+/**
+  * @brief  Derives FMC timing and refresh counter values for an SDCLK
+  *         frequency from the datasheet parameters
+  * @param  SDClockHz: SDRAM clock (FMC kernel clock / SDClockPeriod)
+  * @param  Timing: Receives the SDTR values in clocks
+  * @param  pRefreshRate: Receives the SDRTR count (may be NULL)
+  * @retval W9825G6KH_OK, or W9825G6KH_INVALID_PARAM if the frequency is
+  *         above W9825G6KH_SDCLK_MAX_HZ or a value does not fit its field
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_ComputeTiming(uint32_t SDClockHz, FMC_SDRAM_TimingTypeDef *Timing, uint32_t *pRefreshRate)
+{
+    uint32_t trcd, trp, trc, tras, txsr, twr;
+    uint64_t refresh;
+
+    if (Timing == NULL || SDClockHz == 0U || SDClockHz > W9825G6KH_SDCLK_MAX_HZ) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    trcd = W9825G6KH_NsToClocks(W9825G6KH_TRCD_NS, SDClockHz);
+    trp = W9825G6KH_NsToClocks(W9825G6KH_TRP_NS, SDClockHz);
+    trc = W9825G6KH_NsToClocks(W9825G6KH_TRFC_NS, SDClockHz);
+    tras = W9825G6KH_NsToClocks(W9825G6KH_TRAS_NS, SDClockHz);
+    txsr = W9825G6KH_NsToClocks(W9825G6KH_TXSR_NS, SDClockHz);
+
+    /* The FMC closes rows from TWR, so it also has to cover
+     * tRAS - tRCD and tRC - tRCD - tRP */
+    twr = W9825G6KH_TWR_CLK;
+    if (tras > trcd && tras - trcd > twr) {
+        twr = tras - trcd;
+    }
+    if (trc > trcd + trp && trc - trcd - trp > twr) {
+        twr = trc - trcd - trp;
+    }
+
+    Timing->LoadToActiveDelay = W9825G6KH_TMRD_CLK;
+    Timing->ExitSelfRefreshDelay = (txsr != 0U) ? txsr : 1U;
+    Timing->SelfRefreshTime = (tras != 0U) ? tras : 1U;
+    Timing->RowCycleDelay = (trc != 0U) ? trc : 1U;
+    Timing->WriteRecoveryTime = twr;
+    Timing->RPDelay = (trp != 0U) ? trp : 1U;
+    Timing->RCDDelay = (trcd != 0U) ? trcd : 1U;
+
+    /* Every SDTR field is 4 bits holding clocks - 1 */
+    if (Timing->ExitSelfRefreshDelay > 16U || Timing->SelfRefreshTime > 16U ||
+        Timing->RowCycleDelay > 16U || Timing->WriteRecoveryTime > 16U ||
+        Timing->RPDelay > 16U || Timing->RCDDelay > 16U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    /* One row every REFRESH_PERIOD / ROW_COUNT, less the margin the FMC
+     * needs to finish a pending access before the refresh */
+    refresh = ((uint64_t)W9825G6KH_REFRESH_PERIOD_MS * SDClockHz) / (1000ULL * W9825G6KH_ROW_COUNT);
+    if (refresh < 41U + W9825G6KH_REFRESH_MARGIN || refresh - W9825G6KH_REFRESH_MARGIN > 0x1FFFU) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (pRefreshRate != NULL) {
+        *pRefreshRate = (uint32_t)refresh - W9825G6KH_REFRESH_MARGIN;
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Changes the SDRAM clock at run time
+  * @note   The SDRAM sits in self-refresh while the divider, timing and
+  *         refresh counter are reprogrammed; W9825G6KH_ClockChangeCallback
+  *         runs in that window to switch the FMC kernel clock. Nothing may
+  *         access SDRAM meanwhile (code, stack, DMA, ISRs), and the D-cache
+  *         is cleaned first so no write-back lands in that window.
+  * @param  KernelClockHz: FMC kernel clock after the change (0: unchanged)
+  * @param  SDClockPeriod: FMC_SDRAM_CLOCK_PERIOD_2 or FMC_SDRAM_CLOCK_PERIOD_3
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_SetClock(uint32_t KernelClockHz, uint32_t SDClockPeriod)
+{
+    FMC_SDRAM_TimingTypeDef timing;
+    W9825G6KH_StatusTypeDef status;
+    uint32_t div = W9825G6KH_ClockDivider(SDClockPeriod);
+    uint32_t refresh;
+    uint32_t sdcr;
+
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    if (div == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (KernelClockHz == 0U) {
+        KernelClockHz = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_FMC);
+    }
+
+    /* Reject before touching anything */
+    status = W9825G6KH_ComputeTiming(KernelClockHz / div, &timing, &refresh);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache();
+#endif
+
+    status = W9825G6KH_EnterSelfRefresh();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    W9825G6KH_ClockChangeCallback(KernelClockHz);
+
+    /* Program for the clock the FMC actually gets now */
+    status = W9825G6KH_ComputeTiming(HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_FMC) / div, &timing, &refresh);
+    if (status == W9825G6KH_OK) {
+        sdcr = FMC_Bank5_6_R->SDCR[0];
+        sdcr &= ~FMC_SDCRx_SDCLK;
+        sdcr |= SDClockPeriod;
+        FMC_Bank5_6_R->SDCR[0] = sdcr;
+        hsdram_ptr->Init.SDClockPeriod = SDClockPeriod;
+
+        if (FMC_SDRAM_Timing_Init(hsdram_ptr->Instance, &timing, hsdram_ptr->Init.SDBank) != HAL_OK ||
+            HAL_SDRAM_ProgramRefreshRate(hsdram_ptr, refresh) != HAL_OK) {
+            status = W9825G6KH_ERROR;
+        } else {
+            DeviceConfig.RefreshRate = refresh;
+        }
+    }
+
+    /* Leave self-refresh even on failure: the old settings still apply */
+    if (W9825G6KH_ExitSelfRefresh() != W9825G6KH_OK && status == W9825G6KH_OK) {
+        status = W9825G6KH_ERROR;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Current SDRAM clock
+  * @retval SDCLK in Hz (0 before initialization)
+  */
+uint32_t W9825G6KH_GetClockHz(void)
+{
+    uint32_t div;
+
+    if (hsdram_ptr == NULL) {
+        return 0U;
+    }
+
+    div = W9825G6KH_ClockDivider(FMC_Bank5_6_R->SDCR[0] & FMC_SDCRx_SDCLK);
+    return (div != 0U) ? HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_FMC) / div : 0U;
+}
+
+/**
+  * @brief  Called by W9825G6KH_SetClock with the SDRAM in self-refresh
+  * @note   Override to switch the FMC kernel clock (RCC D1CCIPR FMCSEL or
+  *         the source PLL) to KernelClockHz. Must not touch SDRAM.
+  * @param  KernelClockHz: Requested FMC kernel clock
+  * @retval None
+  */
+__weak void W9825G6KH_ClockChangeCallback(uint32_t KernelClockHz)
+{
+    UNUSED(KernelClockHz);
+}
+
+/* Power Management Functions -----------------------------------------------*/
+
+/**
+  * @brief  Issues a low-power mode command and waits for the FMC to report
+  *         the expected mode
+  * @param  cmd_mode: FMC_SDRAM_CMD_* command
+  * @param  expected: FMC_SDRAM_*_MODE status the command leads to
+  * @retval W9825G6KH status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_SetPowerMode(uint32_t cmd_mode, uint32_t expected)
+{
+    FMC_SDRAM_CommandTypeDef Command = {0};
+    uint32_t tickstart;
+    W9825G6KH_StatusTypeDef status;
+
+    status = W9825G6KH_WaitReady();
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    Command.CommandMode = cmd_mode;
+    Command.CommandTarget = DeviceConfig.TargetBank;
+    Command.AutoRefreshNumber = 1;
+    Command.ModeRegisterDefinition = 0;
+
+    status = W9825G6KH_SendCommand(&Command);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    tickstart = HAL_GetTick();
+    while (HAL_SDRAM_GetModeStatus(hsdram_ptr) != expected) {
+        if ((HAL_GetTick() - tickstart) > W9825G6KH_CMD_TIMEOUT) {
+            return W9825G6KH_TIMEOUT;
+        }
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Puts the SDRAM in self-refresh; contents are retained with the
+  *         FMC clock stopped
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_EnterSelfRefresh(void)
+{
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    __DSB();
+    return W9825G6KH_SetPowerMode(FMC_SDRAM_CMD_SELFREFRESH_MODE, FMC_SDRAM_SELF_REFRESH_MODE);
+}
+
+/**
+  * @brief  Returns the SDRAM from self-refresh to normal operation
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_ExitSelfRefresh(void)
+{
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    return W9825G6KH_SetPowerMode(FMC_SDRAM_CMD_NORMAL_MODE, FMC_SDRAM_NORMAL_MODE);
+}
+
+/**
+  * @brief  Puts the SDRAM in power-down (refresh must keep running)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_EnterPowerDown(void)
+{
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    __DSB();
+    return W9825G6KH_SetPowerMode(FMC_SDRAM_CMD_POWERDOWN_MODE, FMC_SDRAM_POWER_DOWN_MODE);
+}
+
+/**
+  * @brief  Returns the SDRAM from power-down to normal operation
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_ExitPowerDown(void)
+{
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    return W9825G6KH_SetPowerMode(FMC_SDRAM_CMD_NORMAL_MODE, FMC_SDRAM_NORMAL_MODE);
+}
+
+/* Debug and Diagnostic Functions --------------------------------------------*/
+
+/**
+  * @brief  Converts a driver status to a printable string
+  * @param  status: W9825G6KH status
+  * @retval Status name
+  */
+const char* W9825G6KH_StatusToString(W9825G6KH_StatusTypeDef status)
+{
+    switch (status) {
+        case W9825G6KH_OK:            return "OK";
+        case W9825G6KH_ERROR:         return "ERROR";
+        case W9825G6KH_BUSY:          return "BUSY";
+        case W9825G6KH_TIMEOUT:       return "TIMEOUT";
+        case W9825G6KH_INVALID_PARAM: return "INVALID_PARAM";
+        default:                      return "UNKNOWN";
+    }
+}
+
+/**
+  * @brief  Prints the driver configuration, FMC registers and perf counters
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_DumpConfig(void)
+{
+#if W9825G6KH_TEXT_DIAGNOSTICS
+    static W9825G6KH_PerfSnapshotTypeDef snap;
+#endif
+
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    W9825G6KH_Tlm_SendConfig();
+    W9825G6KH_Tlm_SendPerf();
+
+#if W9825G6KH_TEXT_DIAGNOSTICS
+    printf("=== SDRAM Configuration ===\n");
+    printf("  Base: 0x%08lX  Size: %lu bytes\n", W9825G6KH_BANK_ADDR, sdram_size_bytes);
+    W9825G6KH_PrintModeRegisterDetails(DeviceConfig.BurstLength |
+                                       DeviceConfig.BurstType |
+                                       DeviceConfig.CASLatency |
+                                       DeviceConfig.OperatingMode |
+                                       DeviceConfig.WriteBurstMode);
+    printf("  Refresh Rate: %lu\n", DeviceConfig.RefreshRate);
+    printf("  SDCR[0] = 0x%08lX  SDTR[0] = 0x%08lX\n",
+           FMC_Bank5_6_R->SDCR[0], FMC_Bank5_6_R->SDTR[0]);
+    printf("  SDRTR   = 0x%08lX  SDSR    = 0x%08lX\n",
+           FMC_Bank5_6_R->SDRTR, FMC_Bank5_6_R->SDSR);
+
+    W9825G6KH_Perf_GetSnapshot(&snap);
+    printf("  %-12s %10s %12s %10s %10s %10s\n",
+           "API", "Calls", "Bytes", "MinCyc", "MaxCyc", "KB/s");
+    for (uint32_t a = 0; a < W9825G6KH_PERF_API_COUNT; a++) {
+        const W9825G6KH_PerfCounterTypeDef *c = &snap.Api[a];
+        printf("  %-12s %10lu %12lu %10lu %10lu %10lu\n",
+               W9825G6KH_Perf_ApiName((W9825G6KH_PerfApiTypeDef)a),
+               c->Calls, (uint32_t)c->Bytes,
+               c->Calls ? c->MinCycles : 0, c->MaxCycles,
+               W9825G6KH_Perf_ThroughputKBps(c, snap.CoreClockHz));
+    }
+#endif
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Reports the mode register and checks it against the FMC CAS field
+  * @note   The SDRAM mode register is write-only; this reports the value
+  *         last loaded by the driver (init or W9825G6KH_SetModeRegister)
+  * @retval W9825G6KH_ERROR if the mode register CAS and SDCR CAS disagree
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_DebugReadModeRegister(void)
+{
+    uint32_t sdcr;
+    uint32_t mode_cas;
+    uint32_t fmc_cas;
+
+    if (hsdram_ptr == NULL || init_mode_register == 0U) {
+        return W9825G6KH_ERROR;
+    }
+
+    sdcr = FMC_Bank5_6_R->SDCR[0];
+    mode_cas = (init_mode_register >> W9825G6KH_MR_CAS_LATENCY_POS) & 0x7U;
+    fmc_cas = (sdcr & FMC_SDCRx_CAS) >> FMC_SDCRx_CAS_Pos;
+
+    W9825G6KH_Tlm_SendModeRegister(init_mode_register, sdcr);
+
+#if W9825G6KH_TEXT_DIAGNOSTICS
+    W9825G6KH_PrintModeRegisterDetails(init_mode_register);
+    printf("  SDCR[0] = 0x%08lX  FMC CAS = %lu  %s\n", sdcr, fmc_cas,
+           (mode_cas == fmc_cas) ? "OK" : "MISMATCH");
+#endif
+
+    return (mode_cas == fmc_cas) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Runs write/read/fill/test passes over the start of SDRAM and
+  *         reports the throughput measured by the perf counters
+  * @note   Destructive: overwrites the first test_size bytes
+  * @param  test_size: Size in bytes to exercise (rounded down to 4)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RunDiagnostics(uint32_t test_size)
+{
+    static W9825G6KH_PerfSnapshotTypeDef before;
+    static W9825G6KH_PerfSnapshotTypeDef after;
+    static uint32_t diag_buffer[W9825G6KH_DIAG_CHUNK_BYTES / 4];
+    W9825G6KH_StatusTypeDef status;
+    uint32_t errors = 0;
+
+    test_size &= ~0x3UL;
+
+    if (hsdram_ptr == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    status = W9825G6KH_CheckAddressRange(0, test_size);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    printf("=== SDRAM Diagnostics (%lu bytes) ===\n", test_size);
+    W9825G6KH_Perf_GetSnapshot(&before);
+
+    status = W9825G6KH_FillBuffer32(0, test_size / 4, 0);
+
+    for (uint32_t offset = 0; offset < test_size && status == W9825G6KH_OK;
+         offset += W9825G6KH_DIAG_CHUNK_BYTES) {
+        uint32_t chunk = test_size - offset;
+        if (chunk > W9825G6KH_DIAG_CHUNK_BYTES) {
+            chunk = W9825G6KH_DIAG_CHUNK_BYTES;
+        }
+        for (uint32_t i = 0; i < chunk / 4; i++) {
+            diag_buffer[i] = offset + i * 4;
+        }
+        status = W9825G6KH_WriteBuffer32(diag_buffer, offset, chunk / 4);
+    }
+
+    for (uint32_t offset = 0; offset < test_size && status == W9825G6KH_OK;
+         offset += W9825G6KH_DIAG_CHUNK_BYTES) {
+        uint32_t chunk = test_size - offset;
+        if (chunk > W9825G6KH_DIAG_CHUNK_BYTES) {
+            chunk = W9825G6KH_DIAG_CHUNK_BYTES;
+        }
+        status = W9825G6KH_ReadBuffer32(diag_buffer, offset, chunk / 4);
+        for (uint32_t i = 0; i < chunk / 4 && status == W9825G6KH_OK; i++) {
+            if (diag_buffer[i] != offset + i * 4) {
+                errors++;
+            }
+        }
+    }
+
+    if (status == W9825G6KH_OK) {
+        status = W9825G6KH_MemoryTest(0, test_size);
+    }
+
+    W9825G6KH_Perf_GetSnapshot(&after);
+
+    for (uint32_t a = 0; a < W9825G6KH_PERF_API_COUNT; a++) {
+        W9825G6KH_PerfCounterTypeDef delta = after.Api[a];
+
+        delta.Calls -= before.Api[a].Calls;
+        delta.Bytes -= before.Api[a].Bytes;
+        delta.TotalCycles -= before.Api[a].TotalCycles;
+        if (delta.Calls == 0) {
+            continue;
+        }
+
+        uint32_t kbps = W9825G6KH_Perf_ThroughputKBps(&delta, after.CoreClockHz);
+        printf("  %-12s %6lu calls  %4lu.%03lu MB/s\n",
+               W9825G6KH_Perf_ApiName((W9825G6KH_PerfApiTypeDef)a),
+               delta.Calls, kbps / 1000, kbps % 1000);
+    }
+
+    if (errors != 0) {
+        printf("  Readback errors: %lu\n", errors);
+        status = W9825G6KH_ERROR;
+    }
+
+    printf("Diagnostics result: %s\n", W9825G6KH_StatusToString(status));
+    return status;
+}
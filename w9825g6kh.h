@@ -37,6 +37,12 @@ extern "C" {
 #define W9825G6KH_COLUMN_COUNT           256     /* 8-bit address: 2^8 = 256 */
 #define W9825G6KH_PAGE_SIZE_BYTES        512     /* 256 columns × 16-bit = 512 bytes */
 
+/* Address decode: the FMC maps bank-row-column, so each internal bank is a
+ * contiguous block and a row is a 512-byte page inside it */
+#define W9825G6KH_BANK_SIZE_BYTES        (W9825G6KH_SIZE_BYTES / W9825G6KH_BANK_COUNT)   /* 8MB */
+#define W9825G6KH_ADDR_TO_BANK(off)      ((uint32_t)(off) / W9825G6KH_BANK_SIZE_BYTES)
+#define W9825G6KH_ADDR_TO_ROW(off)       (((uint32_t)(off) / W9825G6KH_PAGE_SIZE_BYTES) % W9825G6KH_ROW_COUNT)
+
 /* Memory Address */
 #define W9825G6KH_BANK_ADDR              ((uint32_t)0xC0000000)
 #define W9825G6KH_END_ADDR               (W9825G6KH_BANK_ADDR + W9825G6KH_SIZE_BYTES - 1)
@@ -53,6 +59,8 @@ extern "C" {
 #define W9825G6KH_MR_BURST_LENGTH_2      (0x0001U)
 #define W9825G6KH_MR_BURST_LENGTH_4      (0x0002U)
 #define W9825G6KH_MR_BURST_LENGTH_8      (0x0003U)
+#define W9825G6KH_MR_BURST_LENGTH_FULL_PAGE (0x0007U)  /* Sequential bursts only */
+#define W9825G6KH_MR_BURST_LENGTH_MASK   (0x0007U)
 #define W9825G6KH_MR_BURST_TYPE_SEQUENTIAL   (0x0000U)
 #define W9825G6KH_MR_BURST_TYPE_INTERLEAVED  (0x0008U)  /* Bit 3 = 1 */
 #define W9825G6KH_MR_CAS_LATENCY_2       (0x0020U)  /* Bits 6-4: 010 */
@@ -61,9 +69,81 @@ extern "C" {
 #define W9825G6KH_MR_WRITE_BURST_MODE_PROGRAMMED (0x0000U)  /* Full page bursts */
 #define W9825G6KH_MR_WRITE_BURST_MODE_SINGLE (0x0200U)      /* Bit 9 = 1 */
 
+/* Placement of driver-owned staging buffers in fast memory. Override with
+ * the section name used by the linker script, e.g.
+ * -DW9825G6KH_DTCM_ATTR='__attribute__((section(".dtcmram")))' */
+#ifndef W9825G6KH_DTCM_ATTR
+#define W9825G6KH_DTCM_ATTR
+#endif
+
+/* Access hook types (W9825G6KH_RegisterAccessHook) */
+#define W9825G6KH_ACCESS_READ            0x0U
+#define W9825G6KH_ACCESS_WRITE           0x1U
+#define W9825G6KH_MAX_ACCESS_HOOKS       4
+
+/* 2D block transfers: SRAM staging for SDRAM-to-SDRAM copies */
+#ifndef W9825G6KH_BLIT_STAGE_BYTES
+#define W9825G6KH_BLIT_STAGE_BYTES       2048U
+#endif
+
+/* 1: offload rectangles with 2-, 3- or 4-byte pixels to DMA2D */
+#ifndef W9825G6KH_BLIT_USE_DMA2D
+#define W9825G6KH_BLIT_USE_DMA2D         0
+#endif
+
+/* Longest a background DMA2D job may run before the driver aborts it and
+ * its owner falls back to the CPU */
+#ifndef W9825G6KH_DMA2D_TIMEOUT_US
+#define W9825G6KH_DMA2D_TIMEOUT_US       20000U
+#endif
+
+/* W9825G6KH_Dma2dJobTypeDef.State */
+#define W9825G6KH_DMA2D_JOB_IDLE         0U
+#define W9825G6KH_DMA2D_JOB_RUNNING      1U
+#define W9825G6KH_DMA2D_JOB_DONE         2U
+#define W9825G6KH_DMA2D_JOB_FAILED       3U      /* Transfer error, or timed out and aborted */
+
 /* Timeouts */
 #define W9825G6KH_CMD_TIMEOUT            1000    /* Command timeout in ms */
 #define W9825G6KH_INIT_DELAY_MS          1       /* Minimum 100µs delay */
+
+/* Initialization sequence timing, measured with the DWT cycle counter */
+#ifndef W9825G6KH_INIT_POWERUP_US
+#define W9825G6KH_INIT_POWERUP_US        100U    /* Pause after clock enable */
+#endif
+#ifndef W9825G6KH_INIT_AUTOREFRESH_COUNT
+#define W9825G6KH_INIT_AUTOREFRESH_COUNT 8U      /* Datasheet minimum is 2 */
+#endif
+#define W9825G6KH_TRP_NS                 15U     /* Precharge to active/refresh */
+#define W9825G6KH_TRFC_NS                60U     /* Refresh cycle time (tRC) */
+#define W9825G6KH_TMRD_NS                20U     /* Mode register set, 2 clocks at 100 MHz */
+
+/* AC parameters (-6 speed grade) W9825G6KH_ComputeTiming converts to SDCLK
+ * cycles; TRP_NS and TRFC_NS above are shared with the init sequence */
+#define W9825G6KH_TRCD_NS                15U     /* Active to read/write */
+#define W9825G6KH_TRAS_NS                42U     /* Active to precharge */
+#define W9825G6KH_TXSR_NS                72U     /* Self-refresh exit to active */
+#define W9825G6KH_TWR_CLK                2U      /* Write recovery, clocks */
+#define W9825G6KH_TMRD_CLK               2U      /* Mode register set, clocks */
+#define W9825G6KH_REFRESH_PERIOD_MS      64U     /* All W9825G6KH_ROW_COUNT rows */
+#define W9825G6KH_REFRESH_MARGIN         20U     /* Counter margin (reference manual) */
+
+/* FMC SDCLK ceiling (STM32H743 datasheet) */
+#ifndef W9825G6KH_SDCLK_MAX_HZ
+#define W9825G6KH_SDCLK_MAX_HZ           110000000U
+#endif
+
+/* 1: MX_FMC_Init only starts initialization; the application calls
+ * W9825G6KH_InitStep until W9825G6KH_IsReady() */
+#ifndef W9825G6KH_INIT_NONBLOCKING
+#define W9825G6KH_INIT_NONBLOCKING       0
+#endif
+
+/* 0: MemoryTest, DumpConfig and DebugReadModeRegister stay silent on the
+ * console and report through w9825g6kh_tlm only (init messages are kept) */
+#ifndef W9825G6KH_TEXT_DIAGNOSTICS
+#define W9825G6KH_TEXT_DIAGNOSTICS       1
+#endif
 #define W9825G6KH_BUSY_TIMEOUT_MS        1000    /* Timeout for busy state */
 
 /* Exported types ------------------------------------------------------------*/
@@ -85,6 +165,21 @@ typedef struct {
     uint32_t RefreshRate;        /* Auto-refresh timer value */
 } W9825G6KH_InitTypeDef;
 
+/* Initialization sequence position (W9825G6KH_InitStep) */
+typedef enum {
+    W9825G6KH_INIT_IDLE = 0,         /* Not started, or deinitialized */
+    W9825G6KH_INIT_CLOCK_ENABLE,
+    W9825G6KH_INIT_PRECHARGE,
+    W9825G6KH_INIT_AUTOREFRESH,
+    W9825G6KH_INIT_LOAD_MODE,
+    W9825G6KH_INIT_CONFIGURE,        /* FMC CAS check and refresh timer */
+    W9825G6KH_INIT_DONE,
+    W9825G6KH_INIT_FAILED
+} W9825G6KH_InitStateTypeDef;
+
+/* Called before a checked access touches [Addr, Addr+Size) */
+typedef void (*W9825G6KH_AccessHookTypeDef)(uint32_t Addr, uint32_t Size, uint32_t Access);
+
 /* Default Configuration for 100MHz SDRAM clock */
 #define W9825G6KH_DEFAULT_CONFIG {                       \
     .TargetBank = FMC_SDRAM_CMD_TARGET_BANK1,            \
@@ -96,12 +191,34 @@ typedef struct {
     .RefreshRate = 1563                                  /* For 100MHz: (64ms*100MHz*1000)/4096 - 20 */ \
 }
 
+/* Rectangle geometry for the 2D block transfer functions */
+typedef struct {
+    uint32_t Width;          /* Pixels per line */
+    uint32_t Height;         /* Lines */
+    uint32_t PixelSize;      /* Bytes per pixel (1 to 4) */
+} W9825G6KH_RectTypeDef;
+
+/* A DMA2D job left running after W9825G6KH_Dma2d_Release. Whoever takes
+ * DMA2D next retires it first and records the outcome here, so each user
+ * only ever sees the completion of its own job. */
+typedef struct {
+    volatile uint32_t State;     /* W9825G6KH_DMA2D_JOB_x */
+    uint32_t StartCycles;
+} W9825G6KH_Dma2dJobTypeDef;
+
 /* Exported functions prototypes ---------------------------------------------*/
 
 /* Initialization and Configuration */
 W9825G6KH_StatusTypeDef W9825G6KH_Init(SDRAM_HandleTypeDef *hsdram, W9825G6KH_InitTypeDef *Config);
 W9825G6KH_StatusTypeDef W9825G6KH_DeInit(void);
 
+/* Non-blocking Initialization */
+W9825G6KH_StatusTypeDef W9825G6KH_InitStart(SDRAM_HandleTypeDef *hsdram, W9825G6KH_InitTypeDef *Config);
+W9825G6KH_StatusTypeDef W9825G6KH_InitStep(void);
+W9825G6KH_InitStateTypeDef W9825G6KH_GetInitState(void);
+uint32_t W9825G6KH_IsReady(void);
+void W9825G6KH_InitCpltCallback(W9825G6KH_StatusTypeDef status);
+
 /* Memory Access Functions */
 W9825G6KH_StatusTypeDef W9825G6KH_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize);
 W9825G6KH_StatusTypeDef W9825G6KH_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize);
@@ -116,9 +233,36 @@ W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer16(uint32_t StartAddr, uint32_t NumH
 W9825G6KH_StatusTypeDef W9825G6KH_FillBuffer32(uint32_t StartAddr, uint32_t NumWords, uint32_t Value);
 W9825G6KH_StatusTypeDef W9825G6KH_MemoryTest(uint32_t StartAddr, uint32_t TestSize);
 
+/* 2D Block Transfer Functions (pitches in bytes) */
+W9825G6KH_StatusTypeDef W9825G6KH_ReadRect(uint8_t *pDst, uint32_t DstPitch, uint32_t SrcAddr, uint32_t SrcPitch, const W9825G6KH_RectTypeDef *Rect);
+W9825G6KH_StatusTypeDef W9825G6KH_WriteRect(const uint8_t *pSrc, uint32_t SrcPitch, uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect);
+W9825G6KH_StatusTypeDef W9825G6KH_CopyRect(uint32_t SrcAddr, uint32_t SrcPitch, uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect);
+W9825G6KH_StatusTypeDef W9825G6KH_FillRect(uint32_t DstAddr, uint32_t DstPitch, const W9825G6KH_RectTypeDef *Rect, uint32_t Color);
+
+/* DMA2D Ownership (blit, zero-fill, overlay loads, latency load generator) */
+W9825G6KH_StatusTypeDef W9825G6KH_Dma2d_Acquire(uint32_t TimeoutMs);
+void W9825G6KH_Dma2d_Release(W9825G6KH_Dma2dJobTypeDef *Job);
+W9825G6KH_StatusTypeDef W9825G6KH_Dma2d_Poll(W9825G6KH_Dma2dJobTypeDef *Job, uint32_t Wait);
+
+/* Integrity Functions (CRC-32 as zlib crc32: pass 0 to start, chainable) */
+W9825G6KH_StatusTypeDef W9825G6KH_WriteBufferCrc(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize, uint32_t *pCrc);
+W9825G6KH_StatusTypeDef W9825G6KH_ReadBufferCrc(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize, uint32_t *pCrc);
+W9825G6KH_StatusTypeDef W9825G6KH_Checksum(uint32_t StartAddr, uint32_t Size, uint32_t *pCrc);
+W9825G6KH_StatusTypeDef W9825G6KH_Compare(uint32_t StartAddr, const uint8_t *pBuffer, uint32_t Size, uint32_t *pMismatch);
+
 /* Refresh Control */
 uint32_t W9825G6KH_CalculateRefreshRate(uint32_t SDRAMClockFreqMHz, uint32_t RefreshTimeMs);
 W9825G6KH_StatusTypeDef W9825G6KH_SetRefreshRate(uint32_t RefreshRate);
+W9825G6KH_StatusTypeDef W9825G6KH_SetCASLatency(uint32_t CASLatency);
+W9825G6KH_StatusTypeDef W9825G6KH_SetBurstMode(uint32_t BurstLength, uint32_t WriteBurstMode, uint32_t ReadBurst);
+uint32_t W9825G6KH_GetReadBurst(void);
+W9825G6KH_StatusTypeDef W9825G6KH_GetConfig(W9825G6KH_InitTypeDef *Config);
+
+/* Clock Scaling (SDRAM in self-refresh while the clock changes) */
+W9825G6KH_StatusTypeDef W9825G6KH_ComputeTiming(uint32_t SDClockHz, FMC_SDRAM_TimingTypeDef *Timing, uint32_t *pRefreshRate);
+W9825G6KH_StatusTypeDef W9825G6KH_SetClock(uint32_t KernelClockHz, uint32_t SDClockPeriod);
+uint32_t W9825G6KH_GetClockHz(void);
+void W9825G6KH_ClockChangeCallback(uint32_t KernelClockHz);
 
 /* Power Management */
 W9825G6KH_StatusTypeDef W9825G6KH_EnterSelfRefresh(void);
@@ -140,6 +284,9 @@ W9825G6KH_StatusTypeDef W9825G6KH_RunDiagnostics(uint32_t test_size);
 /* Low-level Functions (for advanced use) */
 W9825G6KH_StatusTypeDef W9825G6KH_SendCommand(FMC_SDRAM_CommandTypeDef *Command);
 W9825G6KH_StatusTypeDef W9825G6KH_SetModeRegister(uint32_t mode_value);
+W9825G6KH_StatusTypeDef W9825G6KH_RegisterAccessHook(W9825G6KH_AccessHookTypeDef hook);
+W9825G6KH_StatusTypeDef W9825G6KH_UnregisterAccessHook(W9825G6KH_AccessHookTypeDef hook);
+void W9825G6KH_NotifyWrite(uint32_t Addr, uint32_t Size, W9825G6KH_AccessHookTypeDef Skip);
 
 #ifdef __cplusplus
 }
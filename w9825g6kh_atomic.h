@@ -0,0 +1,138 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_atomic.h
+  * @brief   Lock-free atomic helpers shared by the W9825G6KH driver modules
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The 32-bit helpers map onto the GCC/Clang __atomic builtins, which
+  * compile to LDREX/STREX sequences on Cortex-M7 and are therefore safe to
+  * use from both thread and interrupt context without masking interrupts.
+  * The split 64-bit counter masks interrupts for its two-word update and
+  * read instead (a handful of cycles), so it never spins and is safe from
+  * any context too.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_ATOMIC_H
+#define __W9825G6KH_ATOMIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* 64-bit counter built from two 32-bit words (ARMv7-M has no LDREXD).
+ * Both words are only touched with interrupts masked, which on a single
+ * core makes every update and read indivisible. */
+typedef struct {
+    volatile uint32_t Lo;
+    volatile uint32_t Hi;
+} W9825G6KH_Counter64TypeDef;
+
+/* Exported functions --------------------------------------------------------*/
+
+static inline uint32_t W9825G6KH_AtomicLoad32(volatile uint32_t *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void W9825G6KH_AtomicStore32(volatile uint32_t *p, uint32_t v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+/**
+  * @brief  Atomically adds v to *p
+  * @retval Value of *p before the addition
+  */
+static inline uint32_t W9825G6KH_AtomicAdd32(volatile uint32_t *p, uint32_t v)
+{
+    return __atomic_fetch_add(p, v, __ATOMIC_RELAXED);
+}
+
+/**
+  * @brief  Compare-and-swap; on failure *expected receives the current value
+  * @retval 1 if the swap happened, 0 otherwise
+  */
+static inline int W9825G6KH_AtomicCas32(volatile uint32_t *p, uint32_t *expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(p, expected, desired, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline void W9825G6KH_AtomicMin32(volatile uint32_t *p, uint32_t v)
+{
+    uint32_t cur = __atomic_load_n(p, __ATOMIC_RELAXED);
+    while (v < cur && !W9825G6KH_AtomicCas32(p, &cur, v)) {
+    }
+}
+
+static inline void W9825G6KH_AtomicMax32(volatile uint32_t *p, uint32_t v)
+{
+    uint32_t cur = __atomic_load_n(p, __ATOMIC_RELAXED);
+    while (v > cur && !W9825G6KH_AtomicCas32(p, &cur, v)) {
+    }
+}
+
+/**
+  * @brief  Adds v to a split 64-bit counter, carrying into the high word
+  *         when the low word wraps
+  */
+static inline void W9825G6KH_AtomicAdd64(W9825G6KH_Counter64TypeDef *c, uint32_t v)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t lo;
+
+    __disable_irq();
+    lo = c->Lo + v;
+    if (lo < v) {
+        c->Hi = c->Hi + 1U;
+    }
+    c->Lo = lo;
+    __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Sets a split 64-bit counter (e.g. to clear it)
+  */
+static inline void W9825G6KH_AtomicStore64(W9825G6KH_Counter64TypeDef *c, uint64_t v)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    c->Lo = (uint32_t)v;
+    c->Hi = (uint32_t)(v >> 32);
+    __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Reads a split 64-bit counter without tearing
+  */
+static inline uint64_t W9825G6KH_AtomicLoad64(W9825G6KH_Counter64TypeDef *c)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t hi, lo;
+
+    __disable_irq();
+    hi = c->Hi;
+    lo = c->Lo;
+    __set_PRIMASK(primask);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_ATOMIC_H */
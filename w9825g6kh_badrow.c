@@ -0,0 +1,373 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_badrow.c
+  * @brief   Bad-row mapping for W9825G6KH
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * W9825G6KH_MemoryTest stops at the first failing pattern. The scan here
+  * keeps going and records every failing bank/row pair, so a marginal part
+  * can stay in service: W9825G6KH_BadRow_HeapInit hands the SDRAM heap only
+  * the good rows, and W9825G6KH_BadRow_FindClean places static buffers.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_badrow.h"
+#include "w9825g6kh_heap.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define BADROW_PAGE_BYTES            W9825G6KH_PAGE_SIZE_BYTES
+#define BADROW_ADDR_PATTERN          0x00000001U   /* Marker: word index as data */
+#define BADROW_ADDR_PATTERN_INV      0x00000002U   /* Marker: inverted word index */
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint32_t W9825G6KH_BadRow_Crc32(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    while (len--) {
+        crc ^= *data++;
+        for (uint32_t b = 0; b < 8U; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t W9825G6KH_BadRow_MapCrc(const W9825G6KH_BadRowMapTypeDef *map)
+{
+    return W9825G6KH_BadRow_Crc32((const uint8_t *)map, (uint32_t)offsetof(W9825G6KH_BadRowMapTypeDef, Checksum));
+}
+
+static void W9825G6KH_BadRow_Mark(W9825G6KH_BadRowMapTypeDef *map, uint32_t Addr)
+{
+    uint32_t bank, row;
+
+    W9825G6KH_BadRow_AddrToRow(Addr, &bank, &row);
+    if ((map->Bitmap[bank][row / 32U] & (1UL << (row % 32U))) == 0U) {
+        map->Bitmap[bank][row / 32U] |= 1UL << (row % 32U);
+        map->BadRows++;
+    }
+}
+
+/**
+  * @brief  Checks one pattern pass, marking each page that holds a wrong word
+  * @note   A page is abandoned at its first error; later words cannot change
+  *         the verdict
+  */
+static void W9825G6KH_BadRow_Verify(W9825G6KH_BadRowMapTypeDef *map, uint32_t StartAddr, uint32_t NumWords, uint32_t pattern)
+{
+    volatile uint32_t *pSdram = (volatile uint32_t *)(W9825G6KH_BANK_ADDR + StartAddr);
+
+    for (uint32_t i = 0; i < NumWords; i++) {
+        uint32_t expected = pattern;
+
+        if (pattern == BADROW_ADDR_PATTERN) {
+            expected = i;
+        } else if (pattern == BADROW_ADDR_PATTERN_INV) {
+            expected = ~i;
+        }
+
+        if (pSdram[i] != expected) {
+            uint32_t addr = StartAddr + i * 4U;
+            uint32_t next_page = (addr / BADROW_PAGE_BYTES + 1U) * BADROW_PAGE_BYTES;
+
+            W9825G6KH_BadRow_Mark(map, addr);
+            i = (next_page - StartAddr) / 4U - 1U;
+        }
+    }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Empties a bad-row map
+  */
+void W9825G6KH_BadRow_Clear(W9825G6KH_BadRowMapTypeDef *map)
+{
+    memset(map, 0, sizeof(*map));
+    map->Magic = W9825G6KH_BADROW_MAGIC;
+    map->Checksum = W9825G6KH_BadRow_MapCrc(map);
+}
+
+/**
+  * @brief  Destructive test recording every failing bank/row pair
+  * @note   Runs the MemoryTest data patterns plus address-in-address and its
+  *         inverse. Unlike W9825G6KH_MemoryTest it does not stop at the
+  *         first failure.
+  * @param  map: Receives the bitmap (cleared first)
+  * @param  StartAddr: Offset from SDRAM base (word aligned)
+  * @param  TestSize: Bytes to test (multiple of 4)
+  * @retval W9825G6KH_OK if no row failed, W9825G6KH_ERROR if some did
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Scan(W9825G6KH_BadRowMapTypeDef *map, uint32_t StartAddr, uint32_t TestSize)
+{
+    W9825G6KH_StatusTypeDef status;
+    uint32_t num_words = TestSize / 4U;
+    volatile uint32_t *pSdram = (volatile uint32_t *)(W9825G6KH_BANK_ADDR + StartAddr);
+
+    static const uint32_t test_patterns[] = {
+        0x00000000, 0xFFFFFFFF, 0x55555555, 0xAAAAAAAA,
+        0x33333333, 0xCCCCCCCC, 0x0F0F0F0F, 0xF0F0F0F0,
+    };
+
+    if (map == NULL || (StartAddr % 4U) != 0U || (TestSize % 4U) != 0U || num_words == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_BadRow_Clear(map);
+
+    printf("Bad-row scan (%lu bytes at 0x%08lX)...\n", TestSize, StartAddr);
+
+    for (uint32_t p = 0; p < sizeof(test_patterns) / sizeof(test_patterns[0]); p++) {
+        /* FillBuffer32 checks the range and notifies the access hooks */
+        status = W9825G6KH_FillBuffer32(StartAddr, num_words, test_patterns[p]);
+        if (status != W9825G6KH_OK) {
+            return status;
+        }
+        W9825G6KH_BadRow_Verify(map, StartAddr, num_words, test_patterns[p]);
+    }
+
+    /* Address-in-address catches shorted or open address lines. The fill
+     * above has already notified the hooks for this range. */
+    for (uint32_t i = 0; i < num_words; i++) {
+        pSdram[i] = i;
+    }
+    W9825G6KH_BadRow_Verify(map, StartAddr, num_words, BADROW_ADDR_PATTERN);
+
+    for (uint32_t i = 0; i < num_words; i++) {
+        pSdram[i] = ~i;
+    }
+    W9825G6KH_BadRow_Verify(map, StartAddr, num_words, BADROW_ADDR_PATTERN_INV);
+
+    map->Checksum = W9825G6KH_BadRow_MapCrc(map);
+
+    printf("Bad-row scan: %lu of %lu rows failed\n", map->BadRows,
+           (uint32_t)(W9825G6KH_BANK_COUNT * W9825G6KH_ROW_COUNT));
+
+    return (map->BadRows == 0U) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Decodes an SDRAM offset into its bank and row
+  * @param  Addr: Offset from SDRAM base
+  */
+void W9825G6KH_BadRow_AddrToRow(uint32_t Addr, uint32_t *bank, uint32_t *row)
+{
+    *bank = W9825G6KH_ADDR_TO_BANK(Addr) % W9825G6KH_BANK_COUNT;
+    *row = W9825G6KH_ADDR_TO_ROW(Addr);
+}
+
+/**
+  * @brief  Tells whether a bank/row pair is marked bad
+  * @retval 1 if bad, 0 otherwise
+  */
+uint32_t W9825G6KH_BadRow_IsBad(const W9825G6KH_BadRowMapTypeDef *map, uint32_t bank, uint32_t row)
+{
+    if (bank >= W9825G6KH_BANK_COUNT || row >= W9825G6KH_ROW_COUNT) {
+        return 1U;
+    }
+    return (map->Bitmap[bank][row / 32U] >> (row % 32U)) & 1U;
+}
+
+/**
+  * @brief  Tells whether any byte of a range falls in a bad row
+  * @retval 1 if the range touches a bad row, 0 otherwise
+  */
+uint32_t W9825G6KH_BadRow_IsRangeBad(const W9825G6KH_BadRowMapTypeDef *map, uint32_t Addr, uint32_t Size)
+{
+    uint32_t bank, row;
+
+    if (Size == 0) {
+        return 0U;
+    }
+
+    for (uint32_t page = Addr / BADROW_PAGE_BYTES; page <= (Addr + Size - 1U) / BADROW_PAGE_BYTES; page++) {
+        W9825G6KH_BadRow_AddrToRow(page * BADROW_PAGE_BYTES, &bank, &row);
+        if (W9825G6KH_BadRow_IsBad(map, bank, row)) {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+  * @brief  Finds the first range of Size bytes clear of bad rows
+  * @param  StartAddr: Search start (offset from SDRAM base)
+  * @param  EndAddr: Search end, exclusive
+  * @param  Size: Bytes needed
+  * @param  pAddr: Receives the range start
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if no such range exists
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_FindClean(const W9825G6KH_BadRowMapTypeDef *map, uint32_t StartAddr, uint32_t EndAddr, uint32_t Size, uint32_t *pAddr)
+{
+    uint32_t candidate = StartAddr;
+
+    if (map == NULL || pAddr == NULL || Size == 0 || EndAddr > W9825G6KH_SIZE_BYTES || StartAddr >= EndAddr) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    while (Size <= EndAddr - candidate) {
+        uint32_t bad_page = 0xFFFFFFFFU;
+        uint32_t bank, row;
+
+        for (uint32_t page = candidate / BADROW_PAGE_BYTES; page <= (candidate + Size - 1U) / BADROW_PAGE_BYTES; page++) {
+            W9825G6KH_BadRow_AddrToRow(page * BADROW_PAGE_BYTES, &bank, &row);
+            if (W9825G6KH_BadRow_IsBad(map, bank, row)) {
+                bad_page = page;
+                break;
+            }
+        }
+
+        if (bad_page == 0xFFFFFFFFU) {
+            *pAddr = candidate;
+            return W9825G6KH_OK;
+        }
+        candidate = (bad_page + 1U) * BADROW_PAGE_BYTES;
+        if (candidate >= EndAddr) {
+            break;
+        }
+    }
+
+    return W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Initialises the SDRAM heap over a region minus its bad rows
+  * @note   Leading and trailing bad pages shrink the region; bad runs inside
+  *         it are carved out with W9825G6KH_Heap_Reserve
+  * @param  Offset: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_HeapInit(const W9825G6KH_BadRowMapTypeDef *map, uint32_t Offset, uint32_t Size)
+{
+    W9825G6KH_StatusTypeDef status;
+    uint32_t end, page_end, run_start = 0;
+    uint32_t in_run = 0;
+
+    if (map == NULL || Size == 0 || Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    end = Offset + Size;
+
+    /* Start on a whole good page so the first block header is sound */
+    Offset = ((Offset + BADROW_PAGE_BYTES - 1U) / BADROW_PAGE_BYTES) * BADROW_PAGE_BYTES;
+    while (Offset < end && W9825G6KH_BadRow_IsRangeBad(map, Offset, 1)) {
+        Offset += BADROW_PAGE_BYTES;
+    }
+    while (end > Offset && W9825G6KH_BadRow_IsRangeBad(map, end - 1U, 1)) {
+        end = ((end - 1U) / BADROW_PAGE_BYTES) * BADROW_PAGE_BYTES;
+    }
+    if (end <= Offset) {
+        return W9825G6KH_ERROR;
+    }
+
+    status = W9825G6KH_Heap_Init(Offset, end - Offset);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    for (uint32_t addr = Offset; addr < end && status == W9825G6KH_OK; addr = page_end) {
+        uint32_t bad = W9825G6KH_BadRow_IsRangeBad(map, addr, 1);
+
+        page_end = (addr / BADROW_PAGE_BYTES + 1U) * BADROW_PAGE_BYTES;
+        if (bad && !in_run) {
+            run_start = addr;
+            in_run = 1;
+        } else if (!bad && in_run) {
+            status = W9825G6KH_Heap_Reserve(run_start, addr - run_start);
+            in_run = 0;
+        }
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Seals the map with its checksum and writes it to storage
+  * @retval W9825G6KH status of the storage hook
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Save(W9825G6KH_BadRowMapTypeDef *map)
+{
+    if (map == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    map->Magic = W9825G6KH_BADROW_MAGIC;
+    map->Checksum = W9825G6KH_BadRow_MapCrc(map);
+    return W9825G6KH_BadRow_StorageWrite(map, sizeof(*map));
+}
+
+/**
+  * @brief  Reads a map back from storage and validates it
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if missing or corrupted (the map
+  *         is then cleared)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Load(W9825G6KH_BadRowMapTypeDef *map)
+{
+    if (map == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (W9825G6KH_BadRow_StorageRead(map, sizeof(*map)) != W9825G6KH_OK ||
+        map->Magic != W9825G6KH_BADROW_MAGIC ||
+        map->Checksum != W9825G6KH_BadRow_MapCrc(map)) {
+        W9825G6KH_BadRow_Clear(map);
+        return W9825G6KH_ERROR;
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Prints the bad bank/row pairs
+  */
+void W9825G6KH_BadRow_Print(const W9825G6KH_BadRowMapTypeDef *map)
+{
+    printf("=== W9825G6KH Bad Rows: %lu ===\n", map->BadRows);
+
+    for (uint32_t bank = 0; bank < W9825G6KH_BANK_COUNT; bank++) {
+        for (uint32_t row = 0; row < W9825G6KH_ROW_COUNT; row++) {
+            if (W9825G6KH_BadRow_IsBad(map, bank, row)) {
+                printf("  Bank %lu Row %4lu (offset 0x%08lX)\n", bank, row,
+                       bank * (uint32_t)W9825G6KH_BANK_SIZE_BYTES + row * (uint32_t)BADROW_PAGE_BYTES);
+            }
+        }
+    }
+}
+
+/**
+  * @brief  Persistent storage write hook
+  * @note   This function should be overridden by the application
+  * @retval W9825G6KH_ERROR (no storage)
+  */
+__weak W9825G6KH_StatusTypeDef W9825G6KH_BadRow_StorageWrite(const void *pData, uint32_t Size)
+{
+    UNUSED(pData);
+    UNUSED(Size);
+    return W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Persistent storage read hook
+  * @note   This function should be overridden by the application
+  * @retval W9825G6KH_ERROR (no storage)
+  */
+__weak W9825G6KH_StatusTypeDef W9825G6KH_BadRow_StorageRead(void *pData, uint32_t Size)
+{
+    UNUSED(pData);
+    UNUSED(Size);
+    return W9825G6KH_ERROR;
+}
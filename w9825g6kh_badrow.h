@@ -0,0 +1,66 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_badrow.h
+  * @brief   Bad-row mapping for W9825G6KH: per bank/row fault bitmap,
+  *          persistent storage and heap exclusion
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_BADROW_H
+#define __W9825G6KH_BADROW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define W9825G6KH_BADROW_MAGIC           0x42524D31U   /* "BRM1" */
+#define W9825G6KH_BADROW_WORDS           (W9825G6KH_ROW_COUNT / 32U)
+
+/* Exported types ------------------------------------------------------------*/
+/* One bit per bank/row pair. The FMC maps addresses bank-row-column: bank
+ * b is the contiguous 8 MB block at b * 8 MB and row r is the 512-byte page
+ * at r * 512 inside it (W9825G6KH_ADDR_TO_BANK / W9825G6KH_ADDR_TO_ROW). */
+typedef struct {
+    uint32_t Magic;
+    uint32_t BadRows;                                      /* Bits set */
+    uint32_t Bitmap[W9825G6KH_BANK_COUNT][W9825G6KH_BADROW_WORDS];
+    uint32_t Checksum;                                     /* CRC-32 of the above */
+} W9825G6KH_BadRowMapTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void W9825G6KH_BadRow_Clear(W9825G6KH_BadRowMapTypeDef *map);
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Scan(W9825G6KH_BadRowMapTypeDef *map, uint32_t StartAddr, uint32_t TestSize);
+
+void W9825G6KH_BadRow_AddrToRow(uint32_t Addr, uint32_t *bank, uint32_t *row);
+uint32_t W9825G6KH_BadRow_IsBad(const W9825G6KH_BadRowMapTypeDef *map, uint32_t bank, uint32_t row);
+uint32_t W9825G6KH_BadRow_IsRangeBad(const W9825G6KH_BadRowMapTypeDef *map, uint32_t Addr, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_FindClean(const W9825G6KH_BadRowMapTypeDef *map, uint32_t StartAddr, uint32_t EndAddr, uint32_t Size, uint32_t *pAddr);
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_HeapInit(const W9825G6KH_BadRowMapTypeDef *map, uint32_t Offset, uint32_t Size);
+
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Save(W9825G6KH_BadRowMapTypeDef *map);
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_Load(W9825G6KH_BadRowMapTypeDef *map);
+void W9825G6KH_BadRow_Print(const W9825G6KH_BadRowMapTypeDef *map);
+
+/* Storage hooks: weak, default returns W9825G6KH_ERROR. Implement on flash,
+ * EEPROM or backup SRAM to make the map persistent. */
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_StorageWrite(const void *pData, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_BadRow_StorageRead(void *pData, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_BADROW_H */
@@ -0,0 +1,246 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_burst.c
+  * @brief   Burst length / write-burst mode / FMC read burst selection for
+  *          W9825G6KH by measured throughput
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Every combination is applied with W9825G6KH_SetBurstMode and timed on
+  * the same write pass and read-back pass over the test area. With the
+  * D-cache on, the write pass ends with a clean and the read pass starts
+  * from invalidated lines, so both measure 32-byte line traffic to the
+  * device, which is what the burst settings change. A combination that
+  * does not read back its data is reported and never selected. The score
+  * weights the two passes by the caller's read share.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_burst.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define BURST_STEP    0x9E3779B1U     /* Pattern increment: neighbouring words differ */
+#define BURST_COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t burst_lengths[] = {
+    W9825G6KH_MR_BURST_LENGTH_1,
+    W9825G6KH_MR_BURST_LENGTH_2,
+    W9825G6KH_MR_BURST_LENGTH_4,
+    W9825G6KH_MR_BURST_LENGTH_8,
+    W9825G6KH_MR_BURST_LENGTH_FULL_PAGE,
+};
+
+static const uint32_t burst_write_modes[] = {
+    W9825G6KH_MR_WRITE_BURST_MODE_PROGRAMMED,
+    W9825G6KH_MR_WRITE_BURST_MODE_SINGLE,
+};
+
+static const uint32_t burst_read_bursts[] = {
+    FMC_SDRAM_RBURST_DISABLE,
+    FMC_SDRAM_RBURST_ENABLE,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Writes the pattern for seed and pushes it out of the D-cache
+  * @retval Core cycles
+  */
+static uint32_t W9825G6KH_Burst_WritePass(volatile uint32_t *p, uint32_t words, uint32_t seed)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+
+    for (uint32_t i = 0; i < words; i++) {
+        p[i] = seed + i * BURST_STEP;
+    }
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)p, (int32_t)(words * 4U));
+#endif
+    __DSB();
+
+    return W9825G6KH_Perf_GetCycles() - t0;
+}
+
+/**
+  * @brief  Reads the area back from the device and checks the pattern
+  * @param  pErrors: Incremented by the number of mismatching words
+  * @retval Core cycles
+  */
+static uint32_t W9825G6KH_Burst_ReadPass(volatile uint32_t *p, uint32_t words, uint32_t seed, uint32_t *pErrors)
+{
+    uint32_t errors = 0;
+    uint32_t t0;
+    uint32_t cycles;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)p, (int32_t)(words * 4U));
+#endif
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < words; i++) {
+        if (p[i] != seed + i * BURST_STEP) {
+            errors++;
+        }
+    }
+    cycles = W9825G6KH_Perf_GetCycles() - t0;
+
+    *pErrors += errors;
+    return cycles;
+}
+
+static uint32_t W9825G6KH_Burst_KBps(uint32_t bytes, uint32_t cycles)
+{
+    return (cycles != 0U) ? (uint32_t)((uint64_t)bytes * SystemCoreClock / cycles / 1024U) : 0U;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Measures every burst setting and applies the fastest for the mix
+  * @note   Destructive: overwrites Size bytes at Offset. Runs the same
+  *         quiesce sequence as W9825G6KH_SetBurstMode for each candidate,
+  *         so DMA must be idle and no code or stack may run from SDRAM.
+  *         Full-page bursts are skipped while interleaved bursts are set.
+  * @param  Offset: Test area (32-byte aligned)
+  * @param  Size: Bytes per pass (multiple of 32, at least W9825G6KH_BURST_MIN_BYTES)
+  * @param  ReadPercent: Share of reads in the workload, 0 .. 100
+  * @param  pTune: Receives every measurement and the chosen index
+  * @retval W9825G6KH_OK with the best setting applied; W9825G6KH_ERROR if
+  *         no setting read back correctly (the previous one is restored)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Burst_Tune(uint32_t Offset, uint32_t Size, uint32_t ReadPercent,
+                                             W9825G6KH_BurstTuneTypeDef *pTune)
+{
+    W9825G6KH_InitTypeDef saved;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+    volatile uint32_t *p;
+    uint32_t saved_rburst;
+    uint32_t words;
+    uint32_t best_score = 0xFFFFFFFFU;
+
+    if (pTune == NULL || ReadPercent > 100U || (Offset & 31U) != 0U || (Size & 31U) != 0U ||
+        Size < W9825G6KH_BURST_MIN_BYTES || Size > W9825G6KH_SIZE_BYTES ||
+        Offset > W9825G6KH_SIZE_BYTES - Size) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (W9825G6KH_GetConfig(&saved) != W9825G6KH_OK || !W9825G6KH_IsReady()) {
+        return W9825G6KH_ERROR;
+    }
+    saved_rburst = W9825G6KH_GetReadBurst();
+
+    memset(pTune, 0, sizeof(*pTune));
+    pTune->Best = W9825G6KH_BURST_NONE;
+    pTune->Size = Size;
+    pTune->ReadPercent = ReadPercent;
+
+    p = (volatile uint32_t *)(W9825G6KH_BANK_ADDR + Offset);
+    words = Size / 4U;
+
+    for (uint32_t l = 0; l < BURST_COUNT(burst_lengths) && status == W9825G6KH_OK; l++) {
+        if (burst_lengths[l] == W9825G6KH_MR_BURST_LENGTH_FULL_PAGE &&
+            saved.BurstType == W9825G6KH_MR_BURST_TYPE_INTERLEAVED) {
+            continue;
+        }
+
+        for (uint32_t w = 0; w < BURST_COUNT(burst_write_modes) && status == W9825G6KH_OK; w++) {
+            for (uint32_t r = 0; r < BURST_COUNT(burst_read_bursts) && status == W9825G6KH_OK; r++) {
+                W9825G6KH_BurstCandidateTypeDef *c = &pTune->Candidate[pTune->Count];
+
+                c->BurstLength = burst_lengths[l];
+                c->WriteBurstMode = burst_write_modes[w];
+                c->ReadBurst = burst_read_bursts[r];
+
+                status = W9825G6KH_SetBurstMode(c->BurstLength, c->WriteBurstMode, c->ReadBurst);
+                if (status != W9825G6KH_OK) {
+                    break;
+                }
+
+                c->WriteCycles = 0xFFFFFFFFU;
+                c->ReadCycles = 0xFFFFFFFFU;
+                for (uint32_t round = 0; round < W9825G6KH_BURST_ROUNDS; round++) {
+                    uint32_t seed = ((pTune->Count << 8) | round) * BURST_STEP;
+                    uint32_t wc = W9825G6KH_Burst_WritePass(p, words, seed);
+                    uint32_t rc = W9825G6KH_Burst_ReadPass(p, words, seed, &c->Errors);
+
+                    if (wc < c->WriteCycles) {
+                        c->WriteCycles = wc;
+                    }
+                    if (rc < c->ReadCycles) {
+                        c->ReadCycles = rc;
+                    }
+                }
+
+                c->Score = (uint32_t)(((uint64_t)c->ReadCycles * ReadPercent +
+                                       (uint64_t)c->WriteCycles * (100U - ReadPercent)) / 100U);
+                if (c->Errors == 0U && c->Score < best_score) {
+                    best_score = c->Score;
+                    pTune->Best = pTune->Count;
+                }
+                pTune->Count++;
+            }
+        }
+    }
+
+    if (status == W9825G6KH_OK && pTune->Best != W9825G6KH_BURST_NONE) {
+        const W9825G6KH_BurstCandidateTypeDef *c = &pTune->Candidate[pTune->Best];
+        return W9825G6KH_SetBurstMode(c->BurstLength, c->WriteBurstMode, c->ReadBurst);
+    }
+
+    /* Back to the setting we started from */
+    pTune->Best = W9825G6KH_BURST_NONE;
+    (void)W9825G6KH_SetBurstMode(saved.BurstLength, saved.WriteBurstMode, saved_rburst);
+
+    return (status != W9825G6KH_OK) ? status : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Prints one line per candidate; '<' marks the applied one
+  */
+void W9825G6KH_Burst_PrintResult(const W9825G6KH_BurstTuneTypeDef *pTune)
+{
+    if (pTune == NULL) {
+        return;
+    }
+
+    printf("=== SDRAM Burst Tuning (%lu bytes, %lu%% reads) ===\n", pTune->Size, pTune->ReadPercent);
+    printf("  %-5s %-11s %-6s %10s %10s %10s\n", "BL", "WriteBurst", "RBURST", "WriteKB/s", "ReadKB/s", "Score");
+    for (uint32_t i = 0; i < pTune->Count; i++) {
+        const W9825G6KH_BurstCandidateTypeDef *c = &pTune->Candidate[i];
+
+        printf("  %-5s %-11s %-6s %10lu %10lu %10lu%s\n",
+               W9825G6KH_Burst_LengthName(c->BurstLength),
+               (c->WriteBurstMode == W9825G6KH_MR_WRITE_BURST_MODE_SINGLE) ? "single" : "programmed",
+               (c->ReadBurst == FMC_SDRAM_RBURST_ENABLE) ? "on" : "off",
+               W9825G6KH_Burst_KBps(pTune->Size, c->WriteCycles),
+               W9825G6KH_Burst_KBps(pTune->Size, c->ReadCycles),
+               c->Score,
+               (c->Errors != 0U) ? "  readback errors" : ((i == pTune->Best) ? "  <" : ""));
+    }
+}
+
+/**
+  * @brief  Burst length as text
+  * @param  BurstLength: W9825G6KH_MR_BURST_LENGTH_x
+  */
+const char* W9825G6KH_Burst_LengthName(uint32_t BurstLength)
+{
+    switch (BurstLength) {
+        case W9825G6KH_MR_BURST_LENGTH_1:         return "1";
+        case W9825G6KH_MR_BURST_LENGTH_2:         return "2";
+        case W9825G6KH_MR_BURST_LENGTH_4:         return "4";
+        case W9825G6KH_MR_BURST_LENGTH_8:         return "8";
+        case W9825G6KH_MR_BURST_LENGTH_FULL_PAGE: return "page";
+        default:                                  return "?";
+    }
+}
@@ -0,0 +1,70 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_burst.h
+  * @brief   Burst length / write-burst mode / FMC read burst selection for
+  *          W9825G6KH by measured throughput
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_BURST_H
+#define __W9825G6KH_BURST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Burst lengths 1/2/4/8/full page x write burst programmed/single x FMC
+ * read burst off/on */
+#define W9825G6KH_BURST_CANDIDATES       20U
+
+/* Timed passes per candidate; the fastest is kept */
+#ifndef W9825G6KH_BURST_ROUNDS
+#define W9825G6KH_BURST_ROUNDS           3U
+#endif
+
+#define W9825G6KH_BURST_MIN_BYTES        1024U
+#define W9825G6KH_BURST_NONE             0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t BurstLength;        /* W9825G6KH_MR_BURST_LENGTH_x */
+    uint32_t WriteBurstMode;     /* W9825G6KH_MR_WRITE_BURST_MODE_x */
+    uint32_t ReadBurst;          /* FMC_SDRAM_RBURST_x */
+    uint32_t WriteCycles;        /* Fastest pass over the test area */
+    uint32_t ReadCycles;
+    uint32_t Score;              /* Cycles weighted by the read share, lower is better */
+    uint32_t Errors;             /* Words that did not read back; such a candidate never wins */
+} W9825G6KH_BurstCandidateTypeDef;
+
+typedef struct {
+    W9825G6KH_BurstCandidateTypeDef Candidate[W9825G6KH_BURST_CANDIDATES];
+    uint32_t Count;              /* Candidates measured */
+    uint32_t Best;               /* Index of the applied candidate, or W9825G6KH_BURST_NONE */
+    uint32_t Size;               /* Bytes per pass */
+    uint32_t ReadPercent;
+} W9825G6KH_BurstTuneTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Burst_Tune(uint32_t Offset, uint32_t Size, uint32_t ReadPercent,
+                                             W9825G6KH_BurstTuneTypeDef *pTune);
+void W9825G6KH_Burst_PrintResult(const W9825G6KH_BurstTuneTypeDef *pTune);
+const char* W9825G6KH_Burst_LengthName(uint32_t BurstLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_BURST_H */
@@ -0,0 +1,322 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_cache.c
+  * @brief   Optional set-associative SRAM read cache for small random SDRAM
+  *          reads
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Lines are one SDRAM page (512 B) so a miss costs a single row activation
+  * followed by a full-page burst. Replacement is LRU within a set. The cache
+  * is read-only: it registers a driver access hook and drops any line that a
+  * checked write, fill or memory test touches, or that another module
+  * reports through W9825G6KH_NotifyWrite. Other accesses that bypass the
+  * driver (DMA, raw pointers) must call W9825G6KH_Cache_Invalidate.
+  *
+  * The cache is not reentrant; use it from a single context.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_cache.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define CACHE_LINE_COUNT             (W9825G6KH_CACHE_SETS * W9825G6KH_CACHE_WAYS)
+#define CACHE_PAGE_COUNT             (W9825G6KH_SIZE_BYTES / W9825G6KH_CACHE_LINE_SIZE)
+#define CACHE_NO_PAGE                0xFFFFFFFFU
+
+#if (W9825G6KH_CACHE_SETS & (W9825G6KH_CACHE_SETS - 1)) != 0
+#error "W9825G6KH_CACHE_SETS must be a power of two"
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t Data[W9825G6KH_CACHE_LINE_SIZE / 4];
+    uint32_t Page;               /* SDRAM page number held by the line */
+    uint32_t LastUse;
+    uint32_t Valid;
+} W9825G6KH_Cache_LineTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_Cache_LineTypeDef cache_lines[W9825G6KH_CACHE_SETS][W9825G6KH_CACHE_WAYS] W9825G6KH_CACHE_ATTR __attribute__((aligned(32)));
+static W9825G6KH_Cache_StatsTypeDef cache_stats;
+static uint32_t cache_tick = 0;
+static uint32_t cache_last_miss = CACHE_NO_PAGE;
+static uint32_t cache_seq_prefetch = 1;
+
+/* Private functions ---------------------------------------------------------*/
+
+static W9825G6KH_Cache_LineTypeDef* W9825G6KH_Cache_Lookup(uint32_t page)
+{
+    W9825G6KH_Cache_LineTypeDef *set = cache_lines[page & (W9825G6KH_CACHE_SETS - 1U)];
+
+    for (uint32_t w = 0; w < W9825G6KH_CACHE_WAYS; w++) {
+        if (set[w].Valid && set[w].Page == page) {
+            return &set[w];
+        }
+    }
+    return NULL;
+}
+
+/**
+  * @brief  Loads a page into its set, replacing the least recently used way
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_Cache_Fill(uint32_t page, W9825G6KH_Cache_LineTypeDef **out)
+{
+    W9825G6KH_Cache_LineTypeDef *set = cache_lines[page & (W9825G6KH_CACHE_SETS - 1U)];
+    W9825G6KH_Cache_LineTypeDef *victim = &set[0];
+    W9825G6KH_StatusTypeDef status;
+
+    for (uint32_t w = 0; w < W9825G6KH_CACHE_WAYS; w++) {
+        if (!set[w].Valid) {
+            victim = &set[w];
+            break;
+        }
+        if ((int32_t)(set[w].LastUse - victim->LastUse) < 0) {
+            victim = &set[w];
+        }
+    }
+
+    if (victim->Valid) {
+        cache_stats.Evictions++;
+        victim->Valid = 0;
+    }
+
+    status = W9825G6KH_ReadBuffer32(victim->Data, page * W9825G6KH_CACHE_LINE_SIZE,
+                                    W9825G6KH_CACHE_LINE_SIZE / 4);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    victim->Page = page;
+    victim->LastUse = ++cache_tick;
+    victim->Valid = 1;
+
+    if (out != NULL) {
+        *out = victim;
+    }
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Driver access hook: drops lines covered by a write
+  */
+static void W9825G6KH_Cache_AccessHook(uint32_t Addr, uint32_t Size, uint32_t Access)
+{
+    if (Access == W9825G6KH_ACCESS_WRITE) {
+        W9825G6KH_Cache_Invalidate(Addr, Size);
+    }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Clears the cache and hooks it into the driver write paths
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Init(void)
+{
+    memset(cache_lines, 0, sizeof(cache_lines));
+    memset(&cache_stats, 0, sizeof(cache_stats));
+    cache_tick = 0;
+    cache_last_miss = CACHE_NO_PAGE;
+
+    return W9825G6KH_RegisterAccessHook(W9825G6KH_Cache_AccessHook);
+}
+
+/**
+  * @brief  Detaches the cache from the driver and drops all lines
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_DeInit(void)
+{
+    W9825G6KH_Cache_InvalidateAll();
+    return W9825G6KH_UnregisterAccessHook(W9825G6KH_Cache_AccessHook);
+}
+
+/**
+  * @brief  Reads SDRAM through the cache
+  * @param  pBuffer: Pointer to data buffer
+  * @param  ReadAddr: Read address (offset from SDRAM base)
+  * @param  BufferSize: Size of buffer in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (pBuffer == NULL || BufferSize == 0 || ReadAddr >= W9825G6KH_SIZE_BYTES ||
+        BufferSize > W9825G6KH_SIZE_BYTES - ReadAddr) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (BufferSize >= W9825G6KH_CACHE_BYPASS_BYTES) {
+        cache_stats.Bypasses++;
+        return W9825G6KH_ReadBuffer(pBuffer, ReadAddr, BufferSize);
+    }
+
+    while (BufferSize > 0 && status == W9825G6KH_OK) {
+        uint32_t page = ReadAddr / W9825G6KH_CACHE_LINE_SIZE;
+        uint32_t offset = ReadAddr % W9825G6KH_CACHE_LINE_SIZE;
+        uint32_t chunk = W9825G6KH_CACHE_LINE_SIZE - offset;
+        W9825G6KH_Cache_LineTypeDef *line = W9825G6KH_Cache_Lookup(page);
+
+        if (chunk > BufferSize) {
+            chunk = BufferSize;
+        }
+
+        if (line != NULL) {
+            cache_stats.Hits++;
+            line->LastUse = ++cache_tick;
+            memcpy(pBuffer, (const uint8_t *)line->Data + offset, chunk);
+        } else {
+            cache_stats.Misses++;
+            status = W9825G6KH_Cache_Fill(page, &line);
+            if (status != W9825G6KH_OK) {
+                break;
+            }
+            /* Copy out first: the prefetch below may reuse this line when
+             * page + 1 maps to the same set */
+            memcpy(pBuffer, (const uint8_t *)line->Data + offset, chunk);
+
+            /* Two consecutive page misses look like a scan: fetch one ahead */
+            if (cache_seq_prefetch && page == cache_last_miss + 1U &&
+                page + 1U < CACHE_PAGE_COUNT && W9825G6KH_Cache_Lookup(page + 1U) == NULL) {
+                if (W9825G6KH_Cache_Fill(page + 1U, NULL) == W9825G6KH_OK) {
+                    cache_stats.Prefetches++;
+                }
+            }
+            cache_last_miss = page;
+        }
+
+        pBuffer += chunk;
+        ReadAddr += chunk;
+        BufferSize -= chunk;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Hint: loads the pages covering a range ahead of use
+  * @note   At most W9825G6KH_CACHE_SETS * W9825G6KH_CACHE_WAYS pages are loaded
+  * @param  StartAddr: Starting address (offset from SDRAM base)
+  * @param  Size: Size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Prefetch(uint32_t StartAddr, uint32_t Size)
+{
+    uint32_t first, last;
+
+    if (Size == 0 || StartAddr >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - StartAddr) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    first = StartAddr / W9825G6KH_CACHE_LINE_SIZE;
+    last = (StartAddr + Size - 1U) / W9825G6KH_CACHE_LINE_SIZE;
+    if (last - first >= CACHE_LINE_COUNT) {
+        last = first + CACHE_LINE_COUNT - 1U;
+    }
+
+    for (uint32_t page = first; page <= last; page++) {
+        if (W9825G6KH_Cache_Lookup(page) == NULL) {
+            W9825G6KH_StatusTypeDef status = W9825G6KH_Cache_Fill(page, NULL);
+            if (status != W9825G6KH_OK) {
+                return status;
+            }
+            cache_stats.Prefetches++;
+        }
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Enables or disables automatic next-page prefetch on sequential misses
+  * @param  Enable: 1 to enable (default), 0 to disable
+  */
+void W9825G6KH_Cache_SetSequentialPrefetch(uint32_t Enable)
+{
+    cache_seq_prefetch = (Enable != 0U);
+}
+
+/**
+  * @brief  Drops cached lines overlapping [StartAddr, StartAddr+Size)
+  * @param  StartAddr: Starting address (offset from SDRAM base)
+  * @param  Size: Size in bytes
+  */
+void W9825G6KH_Cache_Invalidate(uint32_t StartAddr, uint32_t Size)
+{
+    uint32_t first, last;
+
+    if (Size == 0 || StartAddr >= W9825G6KH_SIZE_BYTES) {
+        return;
+    }
+    if (Size > W9825G6KH_SIZE_BYTES - StartAddr) {
+        Size = W9825G6KH_SIZE_BYTES - StartAddr;
+    }
+
+    first = StartAddr / W9825G6KH_CACHE_LINE_SIZE;
+    last = (StartAddr + Size - 1U) / W9825G6KH_CACHE_LINE_SIZE;
+
+    if (last - first >= CACHE_LINE_COUNT) {
+        /* Large range: cheaper to walk the lines than the pages */
+        for (uint32_t s = 0; s < W9825G6KH_CACHE_SETS; s++) {
+            for (uint32_t w = 0; w < W9825G6KH_CACHE_WAYS; w++) {
+                W9825G6KH_Cache_LineTypeDef *line = &cache_lines[s][w];
+                if (line->Valid && line->Page >= first && line->Page <= last) {
+                    line->Valid = 0;
+                    cache_stats.Invalidations++;
+                }
+            }
+        }
+        return;
+    }
+
+    for (uint32_t page = first; page <= last; page++) {
+        W9825G6KH_Cache_LineTypeDef *line = W9825G6KH_Cache_Lookup(page);
+        if (line != NULL) {
+            line->Valid = 0;
+            cache_stats.Invalidations++;
+        }
+    }
+}
+
+/**
+  * @brief  Drops every cached line
+  */
+void W9825G6KH_Cache_InvalidateAll(void)
+{
+    for (uint32_t s = 0; s < W9825G6KH_CACHE_SETS; s++) {
+        for (uint32_t w = 0; w < W9825G6KH_CACHE_WAYS; w++) {
+            cache_lines[s][w].Valid = 0;
+        }
+    }
+    cache_last_miss = CACHE_NO_PAGE;
+}
+
+/**
+  * @brief  Copies the hit/miss counters
+  */
+void W9825G6KH_Cache_GetStats(W9825G6KH_Cache_StatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = cache_stats;
+    }
+}
+
+/**
+  * @brief  Clears the hit/miss counters
+  */
+void W9825G6KH_Cache_ResetStats(void)
+{
+    memset(&cache_stats, 0, sizeof(cache_stats));
+}
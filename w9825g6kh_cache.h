@@ -0,0 +1,74 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_cache.h
+  * @brief   Optional set-associative SRAM read cache for small random SDRAM
+  *          reads
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_CACHE_H
+#define __W9825G6KH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Geometry: SETS x WAYS page-sized lines (default 16 x 4 x 512 B = 32 KB) */
+#ifndef W9825G6KH_CACHE_SETS
+#define W9825G6KH_CACHE_SETS             16      /* Must be a power of two */
+#endif
+#ifndef W9825G6KH_CACHE_WAYS
+#define W9825G6KH_CACHE_WAYS             4
+#endif
+
+/* Placement of the line storage (DTCM or AXI SRAM section) */
+#ifndef W9825G6KH_CACHE_ATTR
+#define W9825G6KH_CACHE_ATTR             W9825G6KH_DTCM_ATTR
+#endif
+
+/* Reads at least this large go straight to SDRAM without allocating lines */
+#ifndef W9825G6KH_CACHE_BYPASS_BYTES
+#define W9825G6KH_CACHE_BYPASS_BYTES     (4U * W9825G6KH_PAGE_SIZE_BYTES)
+#endif
+
+#define W9825G6KH_CACHE_LINE_SIZE        W9825G6KH_PAGE_SIZE_BYTES
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t Hits;               /* Page segments served from SRAM */
+    uint32_t Misses;             /* Page segments that filled a line */
+    uint32_t Bypasses;           /* Reads served directly from SDRAM */
+    uint32_t Prefetches;         /* Lines filled ahead of use */
+    uint32_t Evictions;          /* Valid lines replaced */
+    uint32_t Invalidations;      /* Lines dropped by driver writes */
+} W9825G6KH_Cache_StatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Init(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_DeInit(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize);
+W9825G6KH_StatusTypeDef W9825G6KH_Cache_Prefetch(uint32_t StartAddr, uint32_t Size);
+void W9825G6KH_Cache_SetSequentialPrefetch(uint32_t Enable);
+void W9825G6KH_Cache_Invalidate(uint32_t StartAddr, uint32_t Size);
+void W9825G6KH_Cache_InvalidateAll(void);
+void W9825G6KH_Cache_GetStats(W9825G6KH_Cache_StatsTypeDef *stats);
+void W9825G6KH_Cache_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_CACHE_H */
@@ -0,0 +1,58 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_crc.h
+  * @brief   Table-driven CRC-32 (slicing-by-4) used by the W9825G6KH fused
+  *          copy and checksum functions
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Standard CRC-32 (IEEE 802.3, reflected, as zlib crc32): chain calls by
+  * passing the previous result, start with 0.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_CRC_H
+#define __W9825G6KH_CRC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported variables --------------------------------------------------------*/
+/* Built by W9825G6KH_Crc32_Init; placed with W9825G6KH_DTCM_ATTR */
+extern uint32_t W9825G6KH_Crc32Table[4][256];
+
+/* Exported functions --------------------------------------------------------*/
+void W9825G6KH_Crc32_Init(void);
+uint32_t W9825G6KH_Crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+
+/* Inner-loop steps for fused copy loops. State is the inverted CRC:
+ * state = ~crc on entry, crc = ~state on exit. */
+static inline uint32_t W9825G6KH_Crc32_StepByte(uint32_t state, uint8_t b)
+{
+    return (state >> 8) ^ W9825G6KH_Crc32Table[0][(state ^ b) & 0xFFU];
+}
+
+static inline uint32_t W9825G6KH_Crc32_StepWord(uint32_t state, uint32_t w)
+{
+    state ^= w;   /* Little-endian: byte 0 of the word is processed first */
+    return W9825G6KH_Crc32Table[3][state & 0xFFU] ^
+           W9825G6KH_Crc32Table[2][(state >> 8) & 0xFFU] ^
+           W9825G6KH_Crc32Table[1][(state >> 16) & 0xFFU] ^
+           W9825G6KH_Crc32Table[0][state >> 24];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_CRC_H */
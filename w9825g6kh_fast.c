@@ -0,0 +1,149 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_fast.c
+  * @brief   Check-failure hook and per-call cost benchmark for the inline
+  *          W9825G6KH access tier
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_fast.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define FAST_BENCH_WINDOW            4096U       /* Bytes the benchmark cycles through */
+#define FAST_BENCH_COPY              16U
+
+/* Private functions ---------------------------------------------------------*/
+
+static void W9825G6KH_Fast_PrintRow(const char *name, uint32_t checked, uint32_t fast, uint32_t n)
+{
+    uint32_t c = checked / n;
+    uint32_t f = fast / n;
+
+    printf("%-16s %10lu %10lu %10lu\r\n", name, (unsigned long)c, (unsigned long)f,
+           (unsigned long)((c > f) ? c - f : 0U));
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Called by the inline helpers (W9825G6KH_FAST_CHECKS = 1) on an
+  *         out-of-range access or before SDRAM is ready
+  * @param  Offset: Requested offset
+  * @param  Size: Requested size in bytes
+  * @retval None
+  */
+__weak void W9825G6KH_Fast_CheckFailed(uint32_t Offset, uint32_t Size)
+{
+    printf("SDRAM fast access out of range or not ready: 0x%08lX + %lu\r\n",
+           (unsigned long)Offset, (unsigned long)Size);
+    Error_Handler();
+}
+
+/**
+  * @brief  Prints cycles per call of the checked API against the inline
+  *         helpers for 4-byte loads and stores and a 16-byte copy
+  * @param  Offset: 4 KB scratch window (overwritten), 4-byte aligned
+  * @param  Iterations: Calls per measurement
+  * @retval None
+  */
+void W9825G6KH_Fast_Benchmark(uint32_t Offset, uint32_t Iterations)
+{
+    uint8_t buf[FAST_BENCH_COPY] = {0};
+    volatile uint32_t sink = 0;
+    uint32_t word = 0x5A5AA5A5U;
+    uint32_t checked, fast, t0, addr;
+
+    if (Iterations == 0U || (Offset & 3U) != 0U ||
+        Offset >= W9825G6KH_SIZE_BYTES || FAST_BENCH_WINDOW > W9825G6KH_SIZE_BYTES - Offset) {
+        printf("Fast benchmark: invalid parameters\r\n");
+        return;
+    }
+    if (!W9825G6KH_IsReady()) {
+        printf("Fast benchmark: SDRAM not ready\r\n");
+        return;
+    }
+
+    printf("\r\n=== SDRAM Access Tiers (cycles per call, %lu calls, checks %s, barriers %s) ===\r\n",
+           (unsigned long)Iterations, W9825G6KH_FAST_CHECKS ? "on" : "off",
+           W9825G6KH_FAST_BARRIERS ? "on" : "off");
+    printf("%-16s %10s %10s %10s\r\n", "Operation", "Checked", "Inline", "Saved");
+
+    /* Same addresses for both tiers so cache state matches */
+    (void)W9825G6KH_FillBuffer32(Offset, FAST_BENCH_WINDOW / 4U, 0U);
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * 4U) & (FAST_BENCH_WINDOW - 1U));
+        (void)W9825G6KH_WriteBuffer32(&word, addr, 1U);
+    }
+    checked = W9825G6KH_Perf_GetCycles() - t0;
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * 4U) & (FAST_BENCH_WINDOW - 1U));
+        W9825G6KH_Fast_Store32(addr, word);
+    }
+    fast = W9825G6KH_Perf_GetCycles() - t0;
+    W9825G6KH_Fast_PrintRow("Store 4 B", checked, fast, Iterations);
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * 4U) & (FAST_BENCH_WINDOW - 1U));
+        (void)W9825G6KH_ReadBuffer32(&word, addr, 1U);
+        sink += word;
+    }
+    checked = W9825G6KH_Perf_GetCycles() - t0;
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * 4U) & (FAST_BENCH_WINDOW - 1U));
+        sink += W9825G6KH_Fast_Load32(addr);
+    }
+    fast = W9825G6KH_Perf_GetCycles() - t0;
+    W9825G6KH_Fast_PrintRow("Load 4 B", checked, fast, Iterations);
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * FAST_BENCH_COPY) & (FAST_BENCH_WINDOW - 1U));
+        (void)W9825G6KH_WriteBuffer(buf, addr, FAST_BENCH_COPY);
+    }
+    checked = W9825G6KH_Perf_GetCycles() - t0;
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * FAST_BENCH_COPY) & (FAST_BENCH_WINDOW - 1U));
+        W9825G6KH_Fast_Write(addr, buf, FAST_BENCH_COPY);
+    }
+    fast = W9825G6KH_Perf_GetCycles() - t0;
+    W9825G6KH_Fast_PrintRow("Write 16 B", checked, fast, Iterations);
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * FAST_BENCH_COPY) & (FAST_BENCH_WINDOW - 1U));
+        (void)W9825G6KH_ReadBuffer(buf, addr, FAST_BENCH_COPY);
+        sink += buf[0];
+    }
+    checked = W9825G6KH_Perf_GetCycles() - t0;
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < Iterations; i++) {
+        addr = Offset + ((i * FAST_BENCH_COPY) & (FAST_BENCH_WINDOW - 1U));
+        W9825G6KH_Fast_Read(buf, addr, FAST_BENCH_COPY);
+        sink += buf[0];
+    }
+    fast = W9825G6KH_Perf_GetCycles() - t0;
+    W9825G6KH_Fast_PrintRow("Read 16 B", checked, fast, Iterations);
+
+    (void)sink;
+}
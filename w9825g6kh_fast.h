@@ -0,0 +1,197 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_fast.h
+  * @brief   Unchecked inline access tier for W9825G6KH SDRAM: typed loads,
+  *          stores and copies with debug-only bounds checks
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The W9825G6KH_Read/Write/Fill functions validate every call, wait for
+  * the controller, run the access hooks and end with a DSB. That is right
+  * for untrusted callers, but for small accesses in a loop it costs more
+  * than the access. These helpers compile to the bare access:
+  *  - bounds and ready checks only when W9825G6KH_FAST_CHECKS is 1
+  *    (default: on unless NDEBUG), reported to W9825G6KH_Fast_CheckFailed
+  *  - no access hooks: call W9825G6KH_Zero_Ensure (or the owning module)
+  *    for the range first, as for any direct pointer access
+  *  - no barrier unless W9825G6KH_FAST_BARRIERS is 1; otherwise call
+  *    W9825G6KH_Fast_Barrier where ordering against DMA or another master
+  *    matters
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_FAST_H
+#define __W9825G6KH_FAST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+#include <string.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef W9825G6KH_FAST_CHECKS
+#ifdef NDEBUG
+#define W9825G6KH_FAST_CHECKS            0
+#else
+#define W9825G6KH_FAST_CHECKS            1
+#endif
+#endif
+
+/* 1: every store helper ends with a DSB, like the checked API */
+#ifndef W9825G6KH_FAST_BARRIERS
+#define W9825G6KH_FAST_BARRIERS          0
+#endif
+
+/* Exported functions prototypes ---------------------------------------------*/
+/* Weak; default prints the range and calls Error_Handler */
+void W9825G6KH_Fast_CheckFailed(uint32_t Offset, uint32_t Size);
+void W9825G6KH_Fast_Benchmark(uint32_t Offset, uint32_t Iterations);
+
+/* Exported functions --------------------------------------------------------*/
+
+static inline void W9825G6KH_Fast_Check(uint32_t Offset, uint32_t Size)
+{
+#if W9825G6KH_FAST_CHECKS
+    if (Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset || !W9825G6KH_IsReady()) {
+        W9825G6KH_Fast_CheckFailed(Offset, Size);
+    }
+#else
+    (void)Offset;
+    (void)Size;
+#endif
+}
+
+static inline void W9825G6KH_Fast_Barrier(void)
+{
+    __DSB();
+}
+
+static inline void W9825G6KH_Fast_StoreBarrier(void)
+{
+#if W9825G6KH_FAST_BARRIERS
+    __DSB();
+#endif
+}
+
+/**
+  * @brief  CPU address of an SDRAM offset
+  */
+static inline void* W9825G6KH_Fast_Ptr(uint32_t Offset)
+{
+    W9825G6KH_Fast_Check(Offset, 1U);
+    return (void *)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+static inline uint8_t W9825G6KH_Fast_Load8(uint32_t Offset)
+{
+    W9825G6KH_Fast_Check(Offset, 1U);
+    return *(volatile const uint8_t *)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+/* 16/32/64-bit helpers expect natural alignment (unaligned SDRAM access
+ * works on the M7 for 16/32-bit, but costs a second beat) */
+static inline uint16_t W9825G6KH_Fast_Load16(uint32_t Offset)
+{
+    W9825G6KH_Fast_Check(Offset, 2U);
+    return *(volatile const uint16_t *)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+static inline uint32_t W9825G6KH_Fast_Load32(uint32_t Offset)
+{
+    W9825G6KH_Fast_Check(Offset, 4U);
+    return *(volatile const uint32_t *)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+static inline uint64_t W9825G6KH_Fast_Load64(uint32_t Offset)
+{
+    W9825G6KH_Fast_Check(Offset, 8U);
+    return *(volatile const uint64_t *)(W9825G6KH_BANK_ADDR + Offset);
+}
+
+static inline void W9825G6KH_Fast_Store8(uint32_t Offset, uint8_t Value)
+{
+    W9825G6KH_Fast_Check(Offset, 1U);
+    *(volatile uint8_t *)(W9825G6KH_BANK_ADDR + Offset) = Value;
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+static inline void W9825G6KH_Fast_Store16(uint32_t Offset, uint16_t Value)
+{
+    W9825G6KH_Fast_Check(Offset, 2U);
+    *(volatile uint16_t *)(W9825G6KH_BANK_ADDR + Offset) = Value;
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+static inline void W9825G6KH_Fast_Store32(uint32_t Offset, uint32_t Value)
+{
+    W9825G6KH_Fast_Check(Offset, 4U);
+    *(volatile uint32_t *)(W9825G6KH_BANK_ADDR + Offset) = Value;
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+static inline void W9825G6KH_Fast_Store64(uint32_t Offset, uint64_t Value)
+{
+    W9825G6KH_Fast_Check(Offset, 8U);
+    *(volatile uint64_t *)(W9825G6KH_BANK_ADDR + Offset) = Value;
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+/**
+  * @brief  Copies SDRAM to a buffer; no alignment requirement
+  */
+static inline void W9825G6KH_Fast_Read(void *pDst, uint32_t Offset, uint32_t Size)
+{
+    W9825G6KH_Fast_Check(Offset, Size);
+    memcpy(pDst, (const void *)(W9825G6KH_BANK_ADDR + Offset), Size);
+}
+
+/**
+  * @brief  Copies a buffer to SDRAM; no alignment requirement
+  */
+static inline void W9825G6KH_Fast_Write(uint32_t Offset, const void *pSrc, uint32_t Size)
+{
+    W9825G6KH_Fast_Check(Offset, Size);
+    memcpy((void *)(W9825G6KH_BANK_ADDR + Offset), pSrc, Size);
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+/**
+  * @brief  Copies within SDRAM; ranges may overlap
+  */
+static inline void W9825G6KH_Fast_Move(uint32_t DstOffset, uint32_t SrcOffset, uint32_t Size)
+{
+    W9825G6KH_Fast_Check(SrcOffset, Size);
+    W9825G6KH_Fast_Check(DstOffset, Size);
+    memmove((void *)(W9825G6KH_BANK_ADDR + DstOffset), (const void *)(W9825G6KH_BANK_ADDR + SrcOffset), Size);
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+/**
+  * @brief  Fills NumWords 32-bit words; Offset 4-byte aligned
+  */
+static inline void W9825G6KH_Fast_Fill32(uint32_t Offset, uint32_t NumWords, uint32_t Value)
+{
+    uint32_t *p = (uint32_t *)(W9825G6KH_BANK_ADDR + Offset);
+
+    W9825G6KH_Fast_Check(Offset, (NumWords > W9825G6KH_SIZE_BYTES / 4U) ? W9825G6KH_SIZE_BYTES + 1U : NumWords * 4U);
+    while (NumWords--) {
+        *p++ = Value;
+    }
+    W9825G6KH_Fast_StoreBarrier();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_FAST_H */
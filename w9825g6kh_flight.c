@@ -0,0 +1,334 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_flight.c
+  * @brief   Flight recorder ring in W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Producers claim a sequence number with one atomic add and write the
+  * record to slot (seq % W9825G6KH_FLIGHT_RECORDS); no lock is taken, so
+  * Log may be called from any task or ISR. The sequence number is stored
+  * last and each record carries a hash, so recovery can tell a complete
+  * record from a torn or stale one without trusting the header.
+  *
+  * Records go through the D-cache. The producer that fills the last slot of
+  * a line cleans the line, so at most one partial line (plus lines finished
+  * out of order by preempted producers) is lost on a reset. Call Flush from
+  * the watchdog early-wakeup interrupt or a fault handler to write those
+  * out and update the header cursor.
+  *
+  * SDRAM keeps its contents across a warm reset as long as the reset and
+  * re-initialization are short against the cell retention time; the JEDEC
+  * init sequence itself does not touch the array. Init must run right after
+  * W9825G6KH_Init, before any memory test or heap clear.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_flight.h"
+#include "w9825g6kh_atomic.h"
+#include "w9825g6kh_crc.h"
+#include "w9825g6kh_perf.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define FLIGHT_MASK                  (W9825G6KH_FLIGHT_RECORDS - 1U)
+#define FLIGHT_PER_LINE              (W9825G6KH_FLIGHT_LINE_BYTES / W9825G6KH_FLIGHT_RECORD_BYTES)
+#define FLIGHT_HEADER                ((volatile W9825G6KH_FlightHeaderTypeDef *)(W9825G6KH_BANK_ADDR + W9825G6KH_FLIGHT_OFFSET))
+#define FLIGHT_RING                  ((volatile W9825G6KH_FlightRecordTypeDef *)(W9825G6KH_BANK_ADDR + W9825G6KH_FLIGHT_OFFSET + \
+                                                                                W9825G6KH_FLIGHT_LINE_BYTES))
+
+#if (W9825G6KH_FLIGHT_RECORDS & (W9825G6KH_FLIGHT_RECORDS - 1U)) != 0U
+#error "W9825G6KH_FLIGHT_RECORDS must be a power of two"
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static volatile uint32_t flight_head = 0;       /* Next sequence number */
+static volatile uint32_t flight_active = 0;
+static volatile uint32_t flight_flush_busy = 0;
+static uint32_t flight_session = 0;              /* Sequence number of the boot record */
+static W9825G6KH_FlightInfoTypeDef flight_info;
+
+/* Private functions ---------------------------------------------------------*/
+
+static inline uint16_t W9825G6KH_Flight_Check(uint32_t seq, uint32_t ts, uint32_t id, uint32_t arg)
+{
+    uint32_t x = (seq ^ W9825G6KH_FLIGHT_MAGIC) * 0x9E3779B1U;
+
+    x = (x ^ ts) * 0x85EBCA6BU;
+    x = (x ^ id ^ (arg << 7) ^ (arg >> 25)) * 0xC2B2AE35U;
+    return (uint16_t)(x ^ (x >> 16));
+}
+
+static void W9825G6KH_Flight_CleanLines(volatile void *addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+static uint32_t W9825G6KH_Flight_Valid(uint32_t seq, W9825G6KH_FlightRecordTypeDef *out)
+{
+    volatile W9825G6KH_FlightRecordTypeDef *r = &FLIGHT_RING[seq & FLIGHT_MASK];
+    W9825G6KH_FlightRecordTypeDef rec;
+
+    rec.Seq = r->Seq;
+    rec.Timestamp = r->Timestamp;
+    rec.Id = r->Id;
+    rec.Check = r->Check;
+    rec.Arg = r->Arg;
+
+    if (rec.Seq != seq || rec.Check != W9825G6KH_Flight_Check(rec.Seq, rec.Timestamp, rec.Id, rec.Arg)) {
+        return 0U;
+    }
+    if (out != NULL) {
+        *out = rec;
+    }
+    return 1U;
+}
+
+static uint32_t W9825G6KH_Flight_HeaderCrc(const W9825G6KH_FlightHeaderTypeDef *hdr)
+{
+    return W9825G6KH_Crc32(0U, (const uint8_t *)hdr, (uint32_t)offsetof(W9825G6KH_FlightHeaderTypeDef, Crc));
+}
+
+/* Builds the header in SRAM and stores it as one line */
+static void W9825G6KH_Flight_WriteHeader(uint32_t cursor, uint32_t session)
+{
+    W9825G6KH_FlightHeaderTypeDef hdr;
+    volatile uint32_t *dst = (volatile uint32_t *)FLIGHT_HEADER;
+    const uint32_t *src = (const uint32_t *)&hdr;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.Magic = W9825G6KH_FLIGHT_MAGIC;
+    hdr.Boot = flight_info.Boot;
+    hdr.Records = W9825G6KH_FLIGHT_RECORDS;
+    hdr.Cursor = cursor;
+    hdr.SessionStart = session;
+    hdr.Crc = W9825G6KH_Flight_HeaderCrc(&hdr);
+
+    for (uint32_t i = 0; i < sizeof(hdr) / 4U; i++) {
+        dst[i] = src[i];
+    }
+    W9825G6KH_Flight_CleanLines(FLIGHT_HEADER, W9825G6KH_FLIGHT_LINE_BYTES);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Recovers the log left by the previous session and starts a new one
+  * @note   Call right after W9825G6KH_Init and before anything writes the
+  *         region. The previous tail stays readable through GetRecovered
+  *         and Dump until new records overwrite it.
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if SDRAM is not initialized
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Flight_Init(void)
+{
+    W9825G6KH_FlightHeaderTypeDef hdr;
+    volatile uint32_t *src = (volatile uint32_t *)FLIGHT_HEADER;
+    uint32_t *dst = (uint32_t *)&hdr;
+    uint32_t end, first, misses, count, seq;
+
+    if (!W9825G6KH_IsReady()) {
+        return W9825G6KH_ERROR;
+    }
+
+    flight_active = 0;
+    memset(&flight_info, 0, sizeof(flight_info));
+
+    for (uint32_t i = 0; i < sizeof(hdr) / 4U; i++) {
+        dst[i] = src[i];
+    }
+
+    if (hdr.Magic == W9825G6KH_FLIGHT_MAGIC && hdr.Records == W9825G6KH_FLIGHT_RECORDS &&
+        hdr.Crc == W9825G6KH_Flight_HeaderCrc(&hdr)) {
+        /* The header cursor lags by whatever was logged since the last
+         * flush, possibly more than a full ring: the end is one past the
+         * newest valid record at or after the cursor. */
+        end = hdr.Cursor;
+        for (uint32_t slot = 0; slot < W9825G6KH_FLIGHT_RECORDS; slot++) {
+            seq = FLIGHT_RING[slot].Seq;
+            if ((seq & FLIGHT_MASK) == slot && (seq - hdr.Cursor) < 0x80000000U &&
+                (seq - hdr.Cursor) >= (end - hdr.Cursor) && W9825G6KH_Flight_Valid(seq, NULL)) {
+                end = seq + 1U;
+            }
+        }
+
+        /* Then back to the oldest record still in the ring, allowing for
+         * records torn by producers the reset interrupted */
+        first = end;
+        count = 0;
+        misses = 0;
+        for (uint32_t n = 1; n <= W9825G6KH_FLIGHT_RECORDS; n++) {
+            seq = end - n;
+            if (W9825G6KH_Flight_Valid(seq, NULL)) {
+                first = seq;
+                count++;
+                misses = 0;
+            } else if (++misses > W9825G6KH_FLIGHT_MAX_PRODUCERS) {
+                break;
+            }
+        }
+
+        flight_info.HeaderValid = 1;
+        flight_info.Boot = hdr.Boot + 1U;
+        flight_info.RecoveredFirst = first;
+        flight_info.RecoveredEnd = end;
+        flight_info.Recovered = count;
+    } else {
+        /* Nothing usable: start at 0. Leftover contents cannot pass the
+         * sequence and hash check, so the ring needs no clearing. */
+        end = 0;
+        flight_info.Boot = 1;
+    }
+
+    flight_head = end;
+    flight_session = end;
+    W9825G6KH_Flight_WriteHeader(end, end);
+    flight_active = 1;
+
+    W9825G6KH_Flight_Log(W9825G6KH_FLIGHT_ID_BOOT, flight_info.Boot);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Appends one record; lock-free, callable from tasks and ISRs
+  * @param  Id: Event id (below 0xFF00)
+  * @param  Arg: Event argument
+  * @retval None
+  */
+void W9825G6KH_Flight_Log(uint16_t Id, uint32_t Arg)
+{
+    volatile W9825G6KH_FlightRecordTypeDef *r;
+    uint32_t seq, ts;
+
+    if (flight_active == 0U) {
+        return;
+    }
+
+    ts = W9825G6KH_Perf_GetCycles();
+    seq = W9825G6KH_AtomicAdd32(&flight_head, 1U);
+    r = &FLIGHT_RING[seq & FLIGHT_MASK];
+
+    r->Timestamp = ts;
+    r->Id = Id;
+    r->Arg = Arg;
+    r->Check = W9825G6KH_Flight_Check(seq, ts, Id, Arg);
+    r->Seq = seq;
+
+    if ((seq & (FLIGHT_PER_LINE - 1U)) == FLIGHT_PER_LINE - 1U) {
+        W9825G6KH_Flight_CleanLines(&FLIGHT_RING[(seq - (FLIGHT_PER_LINE - 1U)) & FLIGHT_MASK],
+                                    W9825G6KH_FLIGHT_LINE_BYTES);
+    }
+}
+
+/**
+  * @brief  Writes out the newest records and records the cursor in the header
+  * @note   For the watchdog early-wakeup interrupt, fault handlers and
+  *         orderly resets. Skipped if another context is flushing.
+  * @retval None
+  */
+void W9825G6KH_Flight_Flush(void)
+{
+    uint32_t expected = 0;
+    uint32_t head, lines, line;
+
+    if (flight_active == 0U || !W9825G6KH_AtomicCas32(&flight_flush_busy, &expected, 1U)) {
+        return;
+    }
+
+    /* Lines a preempted producer may have completed after its line was
+     * cleaned, plus the current partial line */
+    head = W9825G6KH_AtomicLoad32(&flight_head);
+    lines = (W9825G6KH_FLIGHT_MAX_PRODUCERS + FLIGHT_PER_LINE - 1U) / FLIGHT_PER_LINE + 1U;
+    line = (head / FLIGHT_PER_LINE) * FLIGHT_PER_LINE;
+    for (uint32_t i = 0; i < lines; i++) {
+        W9825G6KH_Flight_CleanLines(&FLIGHT_RING[line & FLIGHT_MASK], W9825G6KH_FLIGHT_LINE_BYTES);
+        line -= FLIGHT_PER_LINE;
+    }
+
+    W9825G6KH_Flight_WriteHeader(head, flight_session);
+
+    W9825G6KH_AtomicStore32(&flight_flush_busy, 0U);
+}
+
+uint32_t W9825G6KH_Flight_IsActive(void)
+{
+    return flight_active;
+}
+
+/**
+  * @brief  Reports the session and what Init recovered
+  * @param  info: Receives the information
+  * @retval None
+  */
+void W9825G6KH_Flight_GetInfo(W9825G6KH_FlightInfoTypeDef *info)
+{
+    if (info == NULL) {
+        return;
+    }
+    *info = flight_info;
+    info->Head = W9825G6KH_AtomicLoad32(&flight_head);
+}
+
+/**
+  * @brief  Reads a record of the previous session's tail
+  * @param  Index: 0 for the oldest recovered record
+  * @param  rec: Receives the record
+  * @retval W9825G6KH_OK, W9825G6KH_INVALID_PARAM past the tail, or
+  *         W9825G6KH_ERROR if the record was torn or has been overwritten
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Flight_GetRecovered(uint32_t Index, W9825G6KH_FlightRecordTypeDef *rec)
+{
+    if (rec == NULL || Index >= flight_info.RecoveredEnd - flight_info.RecoveredFirst) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    return W9825G6KH_Flight_Valid(flight_info.RecoveredFirst + Index, rec) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Prints the newest records of the previous session's tail
+  * @param  MaxRecords: Records to print (0 for all)
+  * @retval None
+  */
+void W9825G6KH_Flight_Dump(uint32_t MaxRecords)
+{
+    W9825G6KH_FlightRecordTypeDef rec;
+    uint32_t span = flight_info.RecoveredEnd - flight_info.RecoveredFirst;
+    uint32_t start = 0;
+
+    printf("Flight recorder: boot %lu, %s\r\n", (unsigned long)flight_info.Boot,
+           flight_info.HeaderValid ? "previous log found" : "no previous log");
+    if (!flight_info.HeaderValid || span == 0U) {
+        return;
+    }
+
+    printf("  Recovered %lu records, seq %lu..%lu\r\n", (unsigned long)flight_info.Recovered,
+           (unsigned long)flight_info.RecoveredFirst, (unsigned long)(flight_info.RecoveredEnd - 1U));
+
+    if (MaxRecords != 0U && MaxRecords < span) {
+        start = span - MaxRecords;
+    }
+
+    printf("  %10s %10s %6s %10s\r\n", "Seq", "Cycles", "Id", "Arg");
+    for (uint32_t i = start; i < span; i++) {
+        if (W9825G6KH_Flight_GetRecovered(i, &rec) == W9825G6KH_OK) {
+            printf("  %10lu %10lu 0x%04X 0x%08lX\r\n", (unsigned long)rec.Seq, (unsigned long)rec.Timestamp,
+                   (unsigned int)rec.Id, (unsigned long)rec.Arg);
+        } else {
+            printf("  %10lu <lost>\r\n", (unsigned long)(flight_info.RecoveredFirst + i));
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_flight.h
+  * @brief   Flight recorder: lock-free event ring in W9825G6KH SDRAM that
+  *          survives warm resets
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_FLIGHT_H
+#define __W9825G6KH_FLIGHT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Ring capacity in records (power of two). 65536 records = 1 MB. */
+#ifndef W9825G6KH_FLIGHT_RECORDS
+#define W9825G6KH_FLIGHT_RECORDS         65536U
+#endif
+
+/* Producers that can be mid-append at once (tasks + nested ISRs); recovery
+ * tolerates this many torn records in a row */
+#ifndef W9825G6KH_FLIGHT_MAX_PRODUCERS
+#define W9825G6KH_FLIGHT_MAX_PRODUCERS   8U
+#endif
+
+#define W9825G6KH_FLIGHT_MAGIC           0x464C5452U      /* "FLTR" */
+#define W9825G6KH_FLIGHT_LINE_BYTES      32U
+#define W9825G6KH_FLIGHT_RECORD_BYTES    16U
+
+/* Reserved region: one header line followed by the ring, at the top of
+ * SDRAM. Keep heaps, memory tests and diagnostics below OFFSET. */
+#define W9825G6KH_FLIGHT_BYTES           (W9825G6KH_FLIGHT_LINE_BYTES + \
+                                          W9825G6KH_FLIGHT_RECORDS * W9825G6KH_FLIGHT_RECORD_BYTES)
+#ifndef W9825G6KH_FLIGHT_OFFSET
+#define W9825G6KH_FLIGHT_OFFSET          (W9825G6KH_SIZE_BYTES - W9825G6KH_FLIGHT_BYTES)
+#endif
+
+/* Event ids >= 0xFF00 are used by the recorder itself */
+#define W9825G6KH_FLIGHT_ID_BOOT         0xFF00U          /* Arg: boot count */
+
+/* Exported types ------------------------------------------------------------*/
+/* Two records per D-cache line; a record never straddles a line */
+typedef struct {
+    uint32_t Seq;                /* Global sequence number, written last */
+    uint32_t Timestamp;          /* DWT cycle counter */
+    uint16_t Id;
+    uint16_t Check;              /* Hash of the other fields */
+    uint32_t Arg;
+} W9825G6KH_FlightRecordTypeDef;
+
+/* First line of the region */
+typedef struct {
+    uint32_t Magic;
+    uint32_t Boot;               /* Sessions started on this log */
+    uint32_t Records;            /* W9825G6KH_FLIGHT_RECORDS when written */
+    uint32_t Cursor;             /* Next sequence number as of the last flush */
+    uint32_t SessionStart;       /* Sequence number of the last boot record */
+    uint32_t Reserved[2];
+    uint32_t Crc;                /* CRC-32 of the fields above */
+} W9825G6KH_FlightHeaderTypeDef;
+
+typedef struct {
+    uint32_t Boot;
+    uint32_t Head;               /* Next sequence number */
+    uint32_t RecoveredFirst;     /* Previous session tail: [First, End) */
+    uint32_t RecoveredEnd;
+    uint32_t Recovered;          /* Valid records in that range */
+    uint32_t HeaderValid;        /* 0: no log found, region was formatted */
+} W9825G6KH_FlightInfoTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Flight_Init(void);
+void W9825G6KH_Flight_Log(uint16_t Id, uint32_t Arg);
+void W9825G6KH_Flight_Flush(void);
+uint32_t W9825G6KH_Flight_IsActive(void);
+void W9825G6KH_Flight_GetInfo(W9825G6KH_FlightInfoTypeDef *info);
+W9825G6KH_StatusTypeDef W9825G6KH_Flight_GetRecovered(uint32_t Index, W9825G6KH_FlightRecordTypeDef *rec);
+void W9825G6KH_Flight_Dump(uint32_t MaxRecords);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_FLIGHT_H */
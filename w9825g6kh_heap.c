@@ -0,0 +1,587 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_heap.c
+  * @brief   SDRAM-backed second heap with SRAM/SDRAM routing for malloc
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Small requests stay on the newlib heap in internal SRAM; requests at or
+  * above the threshold (or tagged SDRAM) are served from a region of SDRAM
+  * handed to W9825G6KH_Heap_Init. The SDRAM heap is a first-fit free list
+  * with boundary tags, so neighbouring free blocks coalesce on free. Block
+  * headers live in SDRAM and every block is 32-byte aligned, which keeps
+  * DMA buffers on whole D-cache lines.
+  *
+  * The newlib heap is left to newlib's own _sbrk: a single sbrk arena
+  * cannot be split by size, so routing happens one level up in malloc
+  * (see W9825G6KH_HEAP_WRAP_MALLOC).
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_heap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HEAP_MAGIC_USED              0x5D4A0C11U
+#define HEAP_MAGIC_FREE              0x5D4AF4EEU
+#define HEAP_ALIGN_UP(x)             (((x) + (W9825G6KH_HEAP_ALIGN - 1U)) & ~(W9825G6KH_HEAP_ALIGN - 1U))
+#define HEAP_HDR_SIZE                HEAP_ALIGN_UP((uint32_t)sizeof(W9825G6KH_HeapBlockTypeDef))
+#define HEAP_BLK_SIZE(b)             ((b)->Size & ~1U)
+#define HEAP_BLK_USED(b)             ((b)->Size & 1U)
+
+#if W9825G6KH_HEAP_WRAP_MALLOC
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+void *__real_realloc(void *ptr, size_t size);
+#define HEAP_SRAM_MALLOC(n)          __real_malloc(n)
+#define HEAP_SRAM_FREE(p)            __real_free(p)
+#define HEAP_SRAM_REALLOC(p, n)      __real_realloc((p), (n))
+#else
+#define HEAP_SRAM_MALLOC(n)          malloc(n)
+#define HEAP_SRAM_FREE(p)            free(p)
+#define HEAP_SRAM_REALLOC(p, n)      realloc((p), (n))
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct W9825G6KH_HeapBlock {
+    uint32_t Size;                          /* Incl. header; bit 0 = in use */
+    uint32_t PrevSize;                      /* Physically previous block, 0 if first */
+    uint32_t Magic;
+    struct W9825G6KH_HeapBlock *NextFree;
+    struct W9825G6KH_HeapBlock *PrevFree;
+} W9825G6KH_HeapBlockTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t *heap_start = NULL;
+static uint8_t *heap_end = NULL;
+static W9825G6KH_HeapBlockTypeDef *heap_free_list = NULL;
+static uint32_t heap_threshold = W9825G6KH_HEAP_SDRAM_THRESHOLD;
+static W9825G6KH_HeapStatsTypeDef heap_stats[2];   /* [0] SRAM, [1] SDRAM */
+static uint32_t heap_lock_nesting = 0;
+static uint32_t heap_lock_primask = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+static W9825G6KH_HeapStatsTypeDef* W9825G6KH_Heap_Stats(W9825G6KH_HeapTagTypeDef heap)
+{
+    return &heap_stats[(heap == W9825G6KH_HEAP_SDRAM) ? 1 : 0];
+}
+
+static void W9825G6KH_Heap_AccountAlloc(W9825G6KH_HeapTagTypeDef heap, uint32_t bytes)
+{
+    W9825G6KH_HeapStatsTypeDef *s = W9825G6KH_Heap_Stats(heap);
+
+    s->Allocations++;
+    s->UsedBytes += bytes;
+    if (s->UsedBytes > s->PeakUsedBytes) {
+        s->PeakUsedBytes = s->UsedBytes;
+    }
+}
+
+static void W9825G6KH_Heap_AccountFree(W9825G6KH_HeapTagTypeDef heap, uint32_t bytes)
+{
+    W9825G6KH_HeapStatsTypeDef *s = W9825G6KH_Heap_Stats(heap);
+
+    s->Frees++;
+    s->UsedBytes -= (bytes <= s->UsedBytes) ? bytes : s->UsedBytes;
+}
+
+static W9825G6KH_HeapBlockTypeDef* W9825G6KH_Heap_NextPhys(W9825G6KH_HeapBlockTypeDef *b)
+{
+    uint8_t *next = (uint8_t *)b + HEAP_BLK_SIZE(b);
+    return (next < heap_end) ? (W9825G6KH_HeapBlockTypeDef *)next : NULL;
+}
+
+static void W9825G6KH_Heap_ListRemove(W9825G6KH_HeapBlockTypeDef *b)
+{
+    if (b->PrevFree != NULL) {
+        b->PrevFree->NextFree = b->NextFree;
+    } else {
+        heap_free_list = b->NextFree;
+    }
+    if (b->NextFree != NULL) {
+        b->NextFree->PrevFree = b->PrevFree;
+    }
+}
+
+static void W9825G6KH_Heap_ListPush(W9825G6KH_HeapBlockTypeDef *b)
+{
+    b->PrevFree = NULL;
+    b->NextFree = heap_free_list;
+    if (heap_free_list != NULL) {
+        heap_free_list->PrevFree = b;
+    }
+    heap_free_list = b;
+}
+
+/**
+  * @brief  First-fit allocation from the SDRAM region (lock held)
+  */
+static void* W9825G6KH_Heap_SdramAlloc(size_t size)
+{
+    uint32_t need;
+
+    if (heap_start == NULL || size == 0 || size > (size_t)(heap_end - heap_start)) {
+        return NULL;
+    }
+    need = HEAP_ALIGN_UP((uint32_t)size) + HEAP_HDR_SIZE;
+
+    for (W9825G6KH_HeapBlockTypeDef *b = heap_free_list; b != NULL; b = b->NextFree) {
+        uint32_t have = HEAP_BLK_SIZE(b);
+        if (have < need) {
+            continue;
+        }
+
+        W9825G6KH_Heap_ListRemove(b);
+
+        if (have - need >= HEAP_HDR_SIZE + W9825G6KH_HEAP_ALIGN) {
+            W9825G6KH_HeapBlockTypeDef *rest = (W9825G6KH_HeapBlockTypeDef *)((uint8_t *)b + need);
+            W9825G6KH_HeapBlockTypeDef *after;
+
+            rest->Size = have - need;
+            rest->PrevSize = need;
+            rest->Magic = HEAP_MAGIC_FREE;
+            W9825G6KH_Heap_ListPush(rest);
+
+            after = W9825G6KH_Heap_NextPhys(rest);
+            if (after != NULL) {
+                after->PrevSize = rest->Size;
+            }
+            have = need;
+        }
+
+        b->Size = have | 1U;
+        b->Magic = HEAP_MAGIC_USED;
+        W9825G6KH_Heap_AccountAlloc(W9825G6KH_HEAP_SDRAM, have);
+        return (uint8_t *)b + HEAP_HDR_SIZE;
+    }
+
+    return NULL;
+}
+
+/**
+  * @brief  Returns a block to the SDRAM region and merges free neighbours
+  *         (lock held)
+  */
+static void W9825G6KH_Heap_SdramFree(void *ptr)
+{
+    W9825G6KH_HeapBlockTypeDef *b = (W9825G6KH_HeapBlockTypeDef *)((uint8_t *)ptr - HEAP_HDR_SIZE);
+    W9825G6KH_HeapBlockTypeDef *n;
+
+    if (b->Magic != HEAP_MAGIC_USED || !HEAP_BLK_USED(b)) {
+        return;  /* Double free or corrupted header: leak rather than corrupt */
+    }
+
+    W9825G6KH_Heap_AccountFree(W9825G6KH_HEAP_SDRAM, HEAP_BLK_SIZE(b));
+    b->Size &= ~1U;
+    b->Magic = HEAP_MAGIC_FREE;
+
+    n = W9825G6KH_Heap_NextPhys(b);
+    if (n != NULL && !HEAP_BLK_USED(n)) {
+        W9825G6KH_Heap_ListRemove(n);
+        n->Magic = 0;
+        b->Size += HEAP_BLK_SIZE(n);
+    }
+
+    if (b->PrevSize != 0) {
+        W9825G6KH_HeapBlockTypeDef *p = (W9825G6KH_HeapBlockTypeDef *)((uint8_t *)b - b->PrevSize);
+        if (!HEAP_BLK_USED(p)) {
+            W9825G6KH_Heap_ListRemove(p);
+            p->Size += HEAP_BLK_SIZE(b);
+            b->Magic = 0;
+            b = p;
+        }
+    }
+
+    n = W9825G6KH_Heap_NextPhys(b);
+    if (n != NULL) {
+        n->PrevSize = HEAP_BLK_SIZE(b);
+    }
+    W9825G6KH_Heap_ListPush(b);
+}
+
+static void* W9825G6KH_Heap_SramAlloc(size_t size)
+{
+    void *ptr = HEAP_SRAM_MALLOC(size);
+
+    W9825G6KH_Heap_Lock();
+    if (ptr != NULL) {
+        W9825G6KH_Heap_AccountAlloc(W9825G6KH_HEAP_SRAM, (uint32_t)malloc_usable_size(ptr));
+    } else {
+        W9825G6KH_Heap_Stats(W9825G6KH_HEAP_SRAM)->Failures++;
+    }
+    W9825G6KH_Heap_Unlock();
+
+    return ptr;
+}
+
+static uint32_t W9825G6KH_Heap_UsableSize(void *ptr)
+{
+    if (W9825G6KH_Heap_IsSdram(ptr)) {
+        W9825G6KH_HeapBlockTypeDef *b = (W9825G6KH_HeapBlockTypeDef *)((uint8_t *)ptr - HEAP_HDR_SIZE);
+        return HEAP_BLK_SIZE(b) - HEAP_HDR_SIZE;
+    }
+    return (uint32_t)malloc_usable_size(ptr);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Hands an SDRAM region to the SDRAM heap
+  * @note   Any previous SDRAM heap content is discarded
+  * @param  Offset: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Heap_Init(uint32_t Offset, uint32_t Size)
+{
+    uintptr_t start, end;
+
+    if (Size == 0 || Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    start = HEAP_ALIGN_UP((uintptr_t)W9825G6KH_BANK_ADDR + Offset);
+    end = ((uintptr_t)W9825G6KH_BANK_ADDR + Offset + Size) & ~(uintptr_t)(W9825G6KH_HEAP_ALIGN - 1U);
+    if (end <= start || end - start < 2U * HEAP_HDR_SIZE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_Heap_Lock();
+
+    heap_start = (uint8_t *)start;
+    heap_end = (uint8_t *)end;
+    heap_free_list = NULL;
+
+    W9825G6KH_HeapBlockTypeDef *b = (W9825G6KH_HeapBlockTypeDef *)heap_start;
+    b->Size = (uint32_t)(end - start);
+    b->PrevSize = 0;
+    b->Magic = HEAP_MAGIC_FREE;
+    W9825G6KH_Heap_ListPush(b);
+
+    memset(&heap_stats[1], 0, sizeof(heap_stats[1]));
+    heap_stats[1].TotalBytes = (uint32_t)(end - start);
+
+    W9825G6KH_Heap_Unlock();
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Allocates from the heap selected by tag
+  * @note   AUTO falls back to the other heap when the preferred one is full;
+  *         explicit tags do not
+  * @param  size: Bytes requested
+  * @param  tag: W9825G6KH_HEAP_AUTO, _SRAM or _SDRAM
+  * @retval Pointer to the block, NULL on failure
+  */
+void* W9825G6KH_Heap_Malloc(size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    W9825G6KH_HeapTagTypeDef target = tag;
+    void *ptr;
+
+    if (target == W9825G6KH_HEAP_AUTO) {
+        target = (size >= heap_threshold) ? W9825G6KH_HEAP_SDRAM : W9825G6KH_HEAP_SRAM;
+    }
+
+    if (target == W9825G6KH_HEAP_SDRAM) {
+        W9825G6KH_Heap_Lock();
+        ptr = W9825G6KH_Heap_SdramAlloc(size);
+        if (ptr == NULL) {
+            heap_stats[1].Failures++;
+        }
+        W9825G6KH_Heap_Unlock();
+
+        if (ptr != NULL || tag != W9825G6KH_HEAP_AUTO) {
+            return ptr;
+        }
+        return W9825G6KH_Heap_SramAlloc(size);
+    }
+
+    ptr = W9825G6KH_Heap_SramAlloc(size);
+    if (ptr == NULL && tag == W9825G6KH_HEAP_AUTO) {
+        W9825G6KH_Heap_Lock();
+        ptr = W9825G6KH_Heap_SdramAlloc(size);
+        W9825G6KH_Heap_Unlock();
+    }
+    return ptr;
+}
+
+/**
+  * @brief  Allocates and zeroes count * size bytes
+  * @retval Pointer to the block, NULL on failure or overflow
+  */
+void* W9825G6KH_Heap_Calloc(size_t count, size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    void *ptr;
+
+    if (size != 0 && count > (size_t)-1 / size) {
+        return NULL;
+    }
+
+    ptr = W9825G6KH_Heap_Malloc(count * size, tag);
+    if (ptr != NULL) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+/**
+  * @brief  Resizes a block, moving it between heaps if the tag demands it
+  * @retval Pointer to the resized block, NULL on failure (ptr stays valid)
+  */
+void* W9825G6KH_Heap_Realloc(void *ptr, size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    W9825G6KH_HeapTagTypeDef target = tag;
+    uint32_t usable;
+    void *moved;
+
+    if (ptr == NULL) {
+        return W9825G6KH_Heap_Malloc(size, tag);
+    }
+    if (size == 0) {
+        W9825G6KH_Heap_Free(ptr);
+        return NULL;
+    }
+
+    if (target == W9825G6KH_HEAP_AUTO) {
+        target = (size >= heap_threshold) ? W9825G6KH_HEAP_SDRAM : W9825G6KH_HEAP_SRAM;
+    }
+
+    usable = W9825G6KH_Heap_UsableSize(ptr);
+
+    if (W9825G6KH_Heap_IsSdram(ptr)) {
+        if (size <= usable && target == W9825G6KH_HEAP_SDRAM) {
+            return ptr;
+        }
+    } else if (target == W9825G6KH_HEAP_SRAM) {
+        moved = HEAP_SRAM_REALLOC(ptr, size);
+        if (moved != NULL) {
+            W9825G6KH_Heap_Lock();
+            heap_stats[0].UsedBytes -= (usable <= heap_stats[0].UsedBytes) ? usable : heap_stats[0].UsedBytes;
+            W9825G6KH_Heap_AccountAlloc(W9825G6KH_HEAP_SRAM, (uint32_t)malloc_usable_size(moved));
+            heap_stats[0].Allocations--;
+            W9825G6KH_Heap_Unlock();
+        }
+        return moved;
+    }
+
+    moved = W9825G6KH_Heap_Malloc(size, tag);
+    if (moved != NULL) {
+        memcpy(moved, ptr, (size < usable) ? size : usable);
+        W9825G6KH_Heap_Free(ptr);
+    }
+    return moved;
+}
+
+/**
+  * @brief  Frees a block from either heap
+  * @param  ptr: Block returned by this module (NULL is ignored)
+  */
+void W9825G6KH_Heap_Free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    if (W9825G6KH_Heap_IsSdram(ptr)) {
+        W9825G6KH_Heap_Lock();
+        W9825G6KH_Heap_SdramFree(ptr);
+        W9825G6KH_Heap_Unlock();
+        return;
+    }
+
+    W9825G6KH_Heap_Lock();
+    W9825G6KH_Heap_AccountFree(W9825G6KH_HEAP_SRAM, (uint32_t)malloc_usable_size(ptr));
+    W9825G6KH_Heap_Unlock();
+    HEAP_SRAM_FREE(ptr);
+}
+
+/**
+  * @brief  Permanently removes an SDRAM range from the heap (e.g. bad rows)
+  * @note   Call after W9825G6KH_Heap_Init and before allocating from the
+  *         range. The range must lie in one free block, at least one header
+  *         past its start, so that no block header lands inside it.
+  * @param  Offset: Range start (offset from SDRAM base)
+  * @param  Size: Range size in bytes
+  * @retval W9825G6KH_OK, W9825G6KH_BUSY if part of the range is allocated,
+  *         W9825G6KH_INVALID_PARAM if it is outside the heap
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Heap_Reserve(uint32_t Offset, uint32_t Size)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_BUSY;
+    uintptr_t s, e;
+
+    if (heap_start == NULL || Size == 0 || Offset >= W9825G6KH_SIZE_BYTES ||
+        Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    s = ((uintptr_t)W9825G6KH_BANK_ADDR + Offset) & ~(uintptr_t)(W9825G6KH_HEAP_ALIGN - 1U);
+    e = HEAP_ALIGN_UP((uintptr_t)W9825G6KH_BANK_ADDR + Offset + Size);
+    if (s < (uintptr_t)heap_start + HEAP_HDR_SIZE || e > (uintptr_t)heap_end) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_Heap_Lock();
+
+    for (W9825G6KH_HeapBlockTypeDef *b = heap_free_list; b != NULL; b = b->NextFree) {
+        uintptr_t bs = (uintptr_t)b;
+        uintptr_t be = bs + HEAP_BLK_SIZE(b);
+        uintptr_t rs = s - HEAP_HDR_SIZE;   /* Reserved block header */
+        uintptr_t re = e;
+        uint32_t prev_size = b->PrevSize;
+        W9825G6KH_HeapBlockTypeDef *r, *n;
+
+        if (rs < bs || e > be) {
+            continue;
+        }
+
+        W9825G6KH_Heap_ListRemove(b);
+
+        /* Leading remainder stays free if it can hold a block */
+        if (rs - bs >= HEAP_HDR_SIZE + W9825G6KH_HEAP_ALIGN) {
+            b->Size = (uint32_t)(rs - bs);
+            W9825G6KH_Heap_ListPush(b);
+            prev_size = b->Size;
+        } else {
+            rs = bs;
+        }
+
+        /* Trailing remainder likewise */
+        if (be - re >= HEAP_HDR_SIZE + W9825G6KH_HEAP_ALIGN) {
+            W9825G6KH_HeapBlockTypeDef *t = (W9825G6KH_HeapBlockTypeDef *)re;
+            t->Size = (uint32_t)(be - re);
+            t->PrevSize = (uint32_t)(re - rs);
+            t->Magic = HEAP_MAGIC_FREE;
+            W9825G6KH_Heap_ListPush(t);
+        } else {
+            re = be;
+        }
+
+        r = (W9825G6KH_HeapBlockTypeDef *)rs;
+        r->Size = (uint32_t)(re - rs) | 1U;
+        r->PrevSize = prev_size;
+        r->Magic = HEAP_MAGIC_USED;
+
+        n = W9825G6KH_Heap_NextPhys((re == be) ? r : (W9825G6KH_HeapBlockTypeDef *)re);
+        if (n != NULL) {
+            n->PrevSize = (re == be) ? HEAP_BLK_SIZE(r) : (uint32_t)(be - re);
+        }
+
+        heap_stats[1].ReservedBytes += (uint32_t)(re - rs);
+        status = W9825G6KH_OK;
+        break;
+    }
+
+    W9825G6KH_Heap_Unlock();
+
+    return status;
+}
+
+/**
+  * @brief  Tells whether a pointer belongs to the SDRAM heap
+  * @retval 1 if ptr lies inside the SDRAM heap region, 0 otherwise
+  */
+uint32_t W9825G6KH_Heap_IsSdram(const void *ptr)
+{
+    return ((const uint8_t *)ptr >= heap_start && (const uint8_t *)ptr < heap_end) ? 1U : 0U;
+}
+
+/**
+  * @brief  Sets the size at which AUTO requests move to SDRAM
+  * @param  bytes: New threshold
+  */
+void W9825G6KH_Heap_SetThreshold(uint32_t bytes)
+{
+    heap_threshold = bytes;
+}
+
+/**
+  * @brief  Copies the statistics of one heap
+  * @param  heap: W9825G6KH_HEAP_SRAM or W9825G6KH_HEAP_SDRAM
+  * @param  stats: Destination
+  */
+void W9825G6KH_Heap_GetStats(W9825G6KH_HeapTagTypeDef heap, W9825G6KH_HeapStatsTypeDef *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    W9825G6KH_Heap_Lock();
+    *stats = *W9825G6KH_Heap_Stats(heap);
+    W9825G6KH_Heap_Unlock();
+}
+
+/**
+  * @brief  Default heap lock: nested interrupt masking
+  */
+__weak void W9825G6KH_Heap_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (heap_lock_nesting++ == 0U) {
+        heap_lock_primask = primask;
+    }
+}
+
+/**
+  * @brief  Default heap unlock: restores the interrupt mask on the last exit
+  */
+__weak void W9825G6KH_Heap_Unlock(void)
+{
+    if (heap_lock_nesting > 0U && --heap_lock_nesting == 0U) {
+        __set_PRIMASK(heap_lock_primask);
+    }
+}
+
+/* newlib integration --------------------------------------------------------*/
+
+#if W9825G6KH_HEAP_WRAP_MALLOC
+void *__wrap_malloc(size_t size)
+{
+    return W9825G6KH_Heap_Malloc(size, W9825G6KH_HEAP_AUTO);
+}
+
+void __wrap_free(void *ptr)
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    return W9825G6KH_Heap_Calloc(count, size, W9825G6KH_HEAP_AUTO);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    return W9825G6KH_Heap_Realloc(ptr, size, W9825G6KH_HEAP_AUTO);
+}
+#endif /* W9825G6KH_HEAP_WRAP_MALLOC */
+
+#if W9825G6KH_HEAP_NEWLIB_LOCKS
+#include <reent.h>
+
+void __malloc_lock(struct _reent *r)
+{
+    (void)r;
+    W9825G6KH_Heap_Lock();
+}
+
+void __malloc_unlock(struct _reent *r)
+{
+    (void)r;
+    W9825G6KH_Heap_Unlock();
+}
+#endif /* W9825G6KH_HEAP_NEWLIB_LOCKS */
@@ -0,0 +1,104 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_heap.cpp
+  * @brief   C++ operator new/delete integration for the SDRAM heap
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Tagged new picks a heap explicitly: new (W9825G6KH_HEAP_SDRAM) T(...).
+  * With W9825G6KH_HEAP_OVERRIDE_NEW (off by default) the global operators
+  * route plain new by size and let delete release blocks from either heap.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_heap.h"
+
+/* Private functions ---------------------------------------------------------*/
+
+static void* W9825G6KH_Heap_NewOrFail(std::size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    void *ptr = W9825G6KH_Heap_Malloc((size != 0) ? size : 1, tag);
+
+    if (ptr == nullptr) {
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        Error_Handler();
+#endif
+    }
+    return ptr;
+}
+
+/* Tagged operators ----------------------------------------------------------*/
+
+void* operator new(std::size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    return W9825G6KH_Heap_NewOrFail(size, tag);
+}
+
+void* operator new[](std::size_t size, W9825G6KH_HeapTagTypeDef tag)
+{
+    return W9825G6KH_Heap_NewOrFail(size, tag);
+}
+
+/* Only called when a constructor throws during tagged new */
+void operator delete(void *ptr, W9825G6KH_HeapTagTypeDef) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+void operator delete[](void *ptr, W9825G6KH_HeapTagTypeDef) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+/* Global operators ----------------------------------------------------------*/
+
+#if W9825G6KH_HEAP_OVERRIDE_NEW
+void* operator new(std::size_t size)
+{
+    return W9825G6KH_Heap_NewOrFail(size, W9825G6KH_HEAP_AUTO);
+}
+
+void* operator new[](std::size_t size)
+{
+    return W9825G6KH_Heap_NewOrFail(size, W9825G6KH_HEAP_AUTO);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return W9825G6KH_Heap_Malloc((size != 0) ? size : 1, W9825G6KH_HEAP_AUTO);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return W9825G6KH_Heap_Malloc((size != 0) ? size : 1, W9825G6KH_HEAP_AUTO);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    W9825G6KH_Heap_Free(ptr);
+}
+#endif /* W9825G6KH_HEAP_OVERRIDE_NEW */
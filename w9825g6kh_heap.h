@@ -0,0 +1,105 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_heap.h
+  * @brief   SDRAM-backed second heap with SRAM/SDRAM routing for malloc and
+  *          C++ operator new
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_HEAP_H
+#define __W9825G6KH_HEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Requests of at least this many bytes go to SDRAM when tagged AUTO */
+#ifndef W9825G6KH_HEAP_SDRAM_THRESHOLD
+#define W9825G6KH_HEAP_SDRAM_THRESHOLD   4096U
+#endif
+
+/* SDRAM blocks are aligned to, and rounded up to, one D-cache line */
+#define W9825G6KH_HEAP_ALIGN             32U
+
+/* 1: provide __wrap_malloc/free/calloc/realloc so that plain malloc() is
+ * routed by size. Link with
+ * -Wl,--wrap=malloc,--wrap=free,--wrap=calloc,--wrap=realloc */
+#ifndef W9825G6KH_HEAP_WRAP_MALLOC
+#define W9825G6KH_HEAP_WRAP_MALLOC       0
+#endif
+
+/* 1: provide newlib's __malloc_lock/__malloc_unlock on top of
+ * W9825G6KH_Heap_Lock/Unlock. Leave 0 if the RTOS port already does. */
+#ifndef W9825G6KH_HEAP_NEWLIB_LOCKS
+#define W9825G6KH_HEAP_NEWLIB_LOCKS      0
+#endif
+
+/* 1: replace the global C++ operator new/delete so that plain new is routed
+ * by size and delete accepts SDRAM pointers (w9825g6kh_heap.cpp). Opt-in:
+ * it affects every C++ allocation in the image. Left at 0, objects from
+ * tagged new must be released with ~T() and W9825G6KH_Heap_Free, unless
+ * W9825G6KH_HEAP_WRAP_MALLOC already routes free. */
+#ifndef W9825G6KH_HEAP_OVERRIDE_NEW
+#define W9825G6KH_HEAP_OVERRIDE_NEW      0
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_HEAP_AUTO  = 0,    /* SDRAM at or above the threshold, else SRAM */
+    W9825G6KH_HEAP_SRAM,         /* newlib heap in internal SRAM */
+    W9825G6KH_HEAP_SDRAM         /* Driver-managed heap in SDRAM */
+} W9825G6KH_HeapTagTypeDef;
+
+typedef struct {
+    uint32_t TotalBytes;         /* Region size (0 for SRAM: owned by newlib) */
+    uint32_t UsedBytes;          /* Bytes currently allocated incl. overhead */
+    uint32_t PeakUsedBytes;      /* High-water mark of UsedBytes */
+    uint32_t Allocations;
+    uint32_t Frees;
+    uint32_t Failures;           /* Requests this heap could not satisfy */
+    uint32_t ReservedBytes;      /* Carved out with W9825G6KH_Heap_Reserve */
+} W9825G6KH_HeapStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Heap_Init(uint32_t Offset, uint32_t Size);
+void* W9825G6KH_Heap_Malloc(size_t size, W9825G6KH_HeapTagTypeDef tag);
+void* W9825G6KH_Heap_Calloc(size_t count, size_t size, W9825G6KH_HeapTagTypeDef tag);
+void* W9825G6KH_Heap_Realloc(void *ptr, size_t size, W9825G6KH_HeapTagTypeDef tag);
+void W9825G6KH_Heap_Free(void *ptr);
+W9825G6KH_StatusTypeDef W9825G6KH_Heap_Reserve(uint32_t Offset, uint32_t Size);
+uint32_t W9825G6KH_Heap_IsSdram(const void *ptr);
+void W9825G6KH_Heap_SetThreshold(uint32_t bytes);
+void W9825G6KH_Heap_GetStats(W9825G6KH_HeapTagTypeDef heap, W9825G6KH_HeapStatsTypeDef *stats);
+
+/* Lock hooks: weak, default masks interrupts with nesting. Override with a
+ * recursive RTOS mutex when allocating from several tasks. */
+void W9825G6KH_Heap_Lock(void);
+void W9825G6KH_Heap_Unlock(void);
+
+#ifdef __cplusplus
+}
+
+#include <new>
+
+/* Tagged allocation: new (W9825G6KH_HEAP_SDRAM) T(...) */
+void* operator new(std::size_t size, W9825G6KH_HeapTagTypeDef tag);
+void* operator new[](std::size_t size, W9825G6KH_HeapTagTypeDef tag);
+void operator delete(void *ptr, W9825G6KH_HeapTagTypeDef tag) noexcept;
+void operator delete[](void *ptr, W9825G6KH_HeapTagTypeDef tag) noexcept;
+#endif
+
+#endif /* __W9825G6KH_HEAP_H */
@@ -0,0 +1,548 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_kv.c
+  * @brief   Open-addressing hash table with buckets in W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Keys hash to a bucket of W9825G6KH_KV_BUCKET_BYTES, aligned to its size,
+  * so a bucket never straddles a cache line (32 B) or an SDRAM page
+  * (512 B) and a lookup costs one line fill or one row activation. A full
+  * bucket overflows into the next one (linear probing by bucket), which
+  * with 32-byte buckets usually stays in the same open row. Deleted slots
+  * become tombstones and are reused by later inserts. Once tombstones pass
+  * W9825G6KH_KV_TOMBSTONE_PCT of the slots, or an insert would push live
+  * keys plus tombstones over the load limit, the table is rehashed in
+  * place, which also keeps at least one empty slot to end every probe.
+  *
+  * GetBatch sorts a batch of probes by bank, then row, so consecutive
+  * probes hit an already open row or alternate banks instead of
+  * precharging the same bank back to back. Each table keeps a small
+  * direct-mapped SRAM directory of recently found keys in front of SDRAM.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_kv.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define KV_HOT_MASK                  (W9825G6KH_KV_HOT_ENTRIES - 1U)
+
+#if (W9825G6KH_KV_HOT_ENTRIES & (W9825G6KH_KV_HOT_ENTRIES - 1U)) != 0U
+#error "W9825G6KH_KV_HOT_ENTRIES must be a power of two"
+#endif
+#if W9825G6KH_KV_BATCH_MAX > 0x40000U
+#error "W9825G6KH_KV_BATCH_MAX must fit the 18-bit batch index"
+#endif
+#if W9825G6KH_KV_MAX_LOAD_PCT >= 100U
+#error "W9825G6KH_KV_MAX_LOAD_PCT must leave empty slots"
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/* murmur3 finalizer: a bijection, so distinct keys keep distinct hashes */
+static uint32_t W9825G6KH_KV_Hash(uint32_t key)
+{
+    key ^= key >> 16;
+    key *= 0x85EBCA6BU;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35U;
+    key ^= key >> 16;
+    return key;
+}
+
+static W9825G6KH_KvSlotTypeDef* W9825G6KH_KV_Bucket(const W9825G6KH_KvTypeDef *kv, uint32_t b)
+{
+    return (W9825G6KH_KvSlotTypeDef *)(W9825G6KH_BANK_ADDR + kv->Offset + b * W9825G6KH_KV_BUCKET_BYTES);
+}
+
+static uint32_t W9825G6KH_KV_KeyValid(uint32_t key)
+{
+    return (key != W9825G6KH_KV_KEY_EMPTY && key != W9825G6KH_KV_KEY_DELETED) ? 1U : 0U;
+}
+
+/**
+  * @brief  Probes from the home bucket for Key
+  * @param  pFree: If not NULL, receives the first reusable slot on the way
+  *         (tombstone or empty), or NULL if none was seen
+  * @retval Slot holding Key, or NULL
+  */
+static W9825G6KH_KvSlotTypeDef* W9825G6KH_KV_Find(W9825G6KH_KvTypeDef *kv, uint32_t key, uint32_t hash,
+                                                  W9825G6KH_KvSlotTypeDef **pFree)
+{
+    uint32_t mask = kv->BucketCount - 1U;
+    uint32_t b = hash & mask;
+
+    if (pFree != NULL) {
+        *pFree = NULL;
+    }
+
+    for (uint32_t step = 0; step < kv->BucketCount; step++) {
+        W9825G6KH_KvSlotTypeDef *slot = W9825G6KH_KV_Bucket(kv, b);
+
+        kv->Stats.BucketReads++;
+        for (uint32_t s = 0; s < W9825G6KH_KV_SLOTS_PER_BUCKET; s++) {
+            uint32_t k = slot[s].Key;
+
+            if (k == key) {
+                return &slot[s];
+            }
+            if (k == W9825G6KH_KV_KEY_EMPTY) {
+                if (pFree != NULL && *pFree == NULL) {
+                    *pFree = &slot[s];
+                }
+                return NULL;
+            }
+            if (k == W9825G6KH_KV_KEY_DELETED && pFree != NULL && *pFree == NULL) {
+                *pFree = &slot[s];
+            }
+        }
+        b = (b + 1U) & mask;
+    }
+
+    return NULL;
+}
+
+/**
+  * @brief  Drops every tombstone without moving the table
+  * @note   Tombstones become empty, then each live key is taken out and
+  *         put back at the first empty slot from its home. The walk starts
+  *         after a slot that was already empty, which no probe sequence
+  *         crosses, so every key still ahead of the walk stays reachable
+  *         and a key only ever moves back towards its home.
+  */
+static void W9825G6KH_KV_Rehash(W9825G6KH_KvTypeDef *kv)
+{
+    W9825G6KH_KvSlotTypeDef *slots = W9825G6KH_KV_Bucket(kv, 0);
+    uint32_t mask = kv->Capacity - 1U;
+    uint32_t start = kv->Capacity;
+
+    for (uint32_t i = 0; i < kv->Capacity; i++) {
+        if (slots[i].Key == W9825G6KH_KV_KEY_EMPTY && start == kv->Capacity) {
+            start = i;
+        } else if (slots[i].Key == W9825G6KH_KV_KEY_DELETED) {
+            slots[i].Key = W9825G6KH_KV_KEY_EMPTY;
+        }
+    }
+    if (start == kv->Capacity) {
+        start = 0;                  /* All slots were tombstones */
+    }
+
+    for (uint32_t n = 1; n <= kv->Capacity; n++) {
+        uint32_t i = (start + n) & mask;
+        uint32_t key = slots[i].Key;
+        uint32_t value = slots[i].Value;
+        uint32_t j;
+
+        if (key == W9825G6KH_KV_KEY_EMPTY) {
+            continue;
+        }
+
+        slots[i].Key = W9825G6KH_KV_KEY_EMPTY;
+        j = (W9825G6KH_KV_Hash(key) & (kv->BucketCount - 1U)) * W9825G6KH_KV_SLOTS_PER_BUCKET;
+        while (slots[j].Key != W9825G6KH_KV_KEY_EMPTY) {
+            j = (j + 1U) & mask;
+        }
+        slots[j].Value = value;
+        slots[j].Key = key;
+    }
+
+    kv->Tombstones = 0;
+    kv->Stats.Rehashes++;
+}
+
+/* Lookup of one key, hot directory first */
+static uint32_t W9825G6KH_KV_Lookup(W9825G6KH_KvTypeDef *kv, uint32_t key, uint32_t hash, uint32_t *pValue)
+{
+    W9825G6KH_KvSlotTypeDef *hot = &kv->Hot[(hash >> 16) & KV_HOT_MASK];
+    W9825G6KH_KvSlotTypeDef *slot;
+
+    kv->Stats.Lookups++;
+
+    if (hot->Key == key) {
+        *pValue = hot->Value;
+        kv->Stats.Hits++;
+        kv->Stats.HotHits++;
+        return 1U;
+    }
+
+    slot = W9825G6KH_KV_Find(kv, key, hash, NULL);
+    if (slot == NULL) {
+        return 0U;
+    }
+
+    *pValue = slot->Value;
+    hot->Key = key;
+    hot->Value = *pValue;
+    kv->Stats.Hits++;
+    return 1U;
+}
+
+/* Benchmark keys: distinct for distinct i, never a reserved value */
+static uint32_t W9825G6KH_KV_BenchKey(uint32_t i)
+{
+    uint32_t k = W9825G6KH_KV_Hash(i + 1U);
+    return (k == W9825G6KH_KV_KEY_DELETED) ? 0x7FFFFFFFU : k;
+}
+
+static uint32_t W9825G6KH_KV_PerSecond(uint32_t ops, uint32_t cycles)
+{
+    return (cycles != 0U) ? (uint32_t)((uint64_t)ops * SystemCoreClock / cycles) : 0U;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Creates an empty table over an SDRAM range
+  * @param  kv: Table handle (in SRAM)
+  * @param  Offset: Range start, aligned to W9825G6KH_KV_BUCKET_BYTES
+  * @param  Size: Range size; the largest power-of-two bucket count that
+  *         fits is used
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Create(W9825G6KH_KvTypeDef *kv, uint32_t Offset, uint32_t Size)
+{
+    uint32_t buckets = 1U;
+
+    if (kv == NULL || (Offset % W9825G6KH_KV_BUCKET_BYTES) != 0U ||
+        Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset ||
+        Size < 2U * W9825G6KH_KV_BUCKET_BYTES) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    while ((buckets * 2U) * W9825G6KH_KV_BUCKET_BYTES <= Size) {
+        buckets *= 2U;
+    }
+
+    kv->Offset = Offset;
+    kv->BucketCount = buckets;
+    kv->Capacity = buckets * W9825G6KH_KV_SLOTS_PER_BUCKET;
+
+    return W9825G6KH_KV_Clear(kv);
+}
+
+/**
+  * @brief  Removes every key
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Clear(W9825G6KH_KvTypeDef *kv)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (kv == NULL || kv->BucketCount == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_FillBuffer32(kv->Offset, kv->BucketCount * W9825G6KH_KV_BUCKET_BYTES / 4U,
+                                    W9825G6KH_KV_KEY_EMPTY);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    kv->Count = 0;
+    kv->Tombstones = 0;
+    memset(&kv->Stats, 0, sizeof(kv->Stats));
+    memset(kv->Hot, 0, sizeof(kv->Hot));
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Inserts a key or updates its value
+  * @note   May rehash the table in place to drop tombstones
+  * @retval W9825G6KH_OK, W9825G6KH_ERROR if the table is at its load
+  *         limit, W9825G6KH_INVALID_PARAM for a reserved key
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Put(W9825G6KH_KvTypeDef *kv, uint32_t Key, uint32_t Value)
+{
+    W9825G6KH_KvSlotTypeDef *slot;
+    W9825G6KH_KvSlotTypeDef *free_slot;
+    W9825G6KH_KvSlotTypeDef *hot;
+    uint32_t hash;
+
+    if (kv == NULL || kv->BucketCount == 0U || !W9825G6KH_KV_KeyValid(Key)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    hash = W9825G6KH_KV_Hash(Key);
+    hot = &kv->Hot[(hash >> 16) & KV_HOT_MASK];
+
+    slot = W9825G6KH_KV_Find(kv, Key, hash, &free_slot);
+    if (slot != NULL) {
+        slot->Value = Value;
+        if (hot->Key == Key) {
+            hot->Value = Value;
+        }
+        return W9825G6KH_OK;
+    }
+
+    if ((uint64_t)(kv->Count + 1U) * 100U > (uint64_t)kv->Capacity * W9825G6KH_KV_MAX_LOAD_PCT ||
+        free_slot == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    /* Taking an empty slot must leave tombstones plus keys under the limit */
+    if (free_slot->Key == W9825G6KH_KV_KEY_EMPTY &&
+        (uint64_t)(kv->Count + kv->Tombstones + 1U) * 100U > (uint64_t)kv->Capacity * W9825G6KH_KV_MAX_LOAD_PCT) {
+        W9825G6KH_KV_Rehash(kv);
+        (void)W9825G6KH_KV_Find(kv, Key, hash, &free_slot);
+    }
+
+    if (free_slot->Key == W9825G6KH_KV_KEY_DELETED) {
+        kv->Tombstones--;
+    }
+    free_slot->Value = Value;
+    free_slot->Key = Key;
+    kv->Count++;
+    kv->Stats.Inserts++;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Looks up one key
+  * @retval W9825G6KH_OK if found, W9825G6KH_ERROR if not
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Get(W9825G6KH_KvTypeDef *kv, uint32_t Key, uint32_t *pValue)
+{
+    if (kv == NULL || pValue == NULL || kv->BucketCount == 0U || !W9825G6KH_KV_KeyValid(Key)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    return W9825G6KH_KV_Lookup(kv, Key, W9825G6KH_KV_Hash(Key), pValue) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Removes a key
+  * @note   Rehashes the table in place once tombstones pass
+  *         W9825G6KH_KV_TOMBSTONE_PCT of the slots
+  * @retval W9825G6KH_OK if removed, W9825G6KH_ERROR if not present
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Delete(W9825G6KH_KvTypeDef *kv, uint32_t Key)
+{
+    W9825G6KH_KvSlotTypeDef *slot;
+    W9825G6KH_KvSlotTypeDef *hot;
+    uint32_t hash;
+
+    if (kv == NULL || kv->BucketCount == 0U || !W9825G6KH_KV_KeyValid(Key)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    hash = W9825G6KH_KV_Hash(Key);
+    slot = W9825G6KH_KV_Find(kv, Key, hash, NULL);
+    if (slot == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    slot->Key = W9825G6KH_KV_KEY_DELETED;
+    kv->Count--;
+    kv->Tombstones++;
+    kv->Stats.Deletes++;
+
+    hot = &kv->Hot[(hash >> 16) & KV_HOT_MASK];
+    if (hot->Key == Key) {
+        hot->Key = W9825G6KH_KV_KEY_EMPTY;
+    }
+
+    if ((uint64_t)kv->Tombstones * 100U > (uint64_t)kv->Capacity * W9825G6KH_KV_TOMBSTONE_PCT) {
+        W9825G6KH_KV_Rehash(kv);
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Looks up many keys, probing SDRAM in bank/row order
+  * @param  pKeys: Keys
+  * @param  pValues: Values of found keys (others left unchanged)
+  * @param  pFound: Per key 1 if found, 0 if not (may be NULL)
+  * @param  Count: Number of keys
+  * @retval Number of keys found
+  */
+uint32_t W9825G6KH_KV_GetBatch(W9825G6KH_KvTypeDef *kv, const uint32_t *pKeys, uint32_t *pValues,
+                               uint8_t *pFound, uint32_t Count)
+{
+    uint32_t found = 0;
+
+    if (kv == NULL || pKeys == NULL || pValues == NULL || kv->BucketCount == 0U) {
+        return 0U;
+    }
+
+    for (uint32_t base = 0; base < Count; base += W9825G6KH_KV_BATCH_MAX) {
+        uint32_t n = (Count - base < W9825G6KH_KV_BATCH_MAX) ? Count - base : W9825G6KH_KV_BATCH_MAX;
+        uint32_t pending = 0;
+
+        /* Hot directory first; the rest get a bank/row sort key */
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t key = pKeys[base + i];
+            uint32_t hash = W9825G6KH_KV_Hash(key);
+            W9825G6KH_KvSlotTypeDef *hot = &kv->Hot[(hash >> 16) & KV_HOT_MASK];
+            uint32_t hit = 0;
+
+            if (W9825G6KH_KV_KeyValid(key) && hot->Key == key) {
+                pValues[base + i] = hot->Value;
+                kv->Stats.Lookups++;
+                kv->Stats.Hits++;
+                kv->Stats.HotHits++;
+                hit = 1U;
+                found++;
+            } else if (W9825G6KH_KV_KeyValid(key)) {
+                uint32_t addr = kv->Offset + (hash & (kv->BucketCount - 1U)) * W9825G6KH_KV_BUCKET_BYTES;
+                uint32_t bank = W9825G6KH_ADDR_TO_BANK(addr);
+                uint32_t row = W9825G6KH_ADDR_TO_ROW(addr);
+                uint32_t sort = (bank << 30) | (row << 18) | i;
+                uint32_t j = pending++;
+
+                /* Insertion sort: batches are small */
+                while (j > 0U && kv->BatchOrder[j - 1U] > sort) {
+                    kv->BatchOrder[j] = kv->BatchOrder[j - 1U];
+                    j--;
+                }
+                kv->BatchOrder[j] = sort;
+            }
+            if (pFound != NULL) {
+                pFound[base + i] = (uint8_t)hit;
+            }
+        }
+
+        for (uint32_t p = 0; p < pending; p++) {
+            uint32_t i = kv->BatchOrder[p] & 0x3FFFFU;
+            uint32_t key = pKeys[base + i];
+
+            if (W9825G6KH_KV_Lookup(kv, key, W9825G6KH_KV_Hash(key), &pValues[base + i])) {
+                if (pFound != NULL) {
+                    pFound[base + i] = 1U;
+                }
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+  * @brief  Live keys as a percentage of slots
+  */
+uint32_t W9825G6KH_KV_LoadPercent(const W9825G6KH_KvTypeDef *kv)
+{
+    if (kv == NULL || kv->Capacity == 0U) {
+        return 0U;
+    }
+    return (uint32_t)((uint64_t)kv->Count * 100U / kv->Capacity);
+}
+
+void W9825G6KH_KV_GetStats(const W9825G6KH_KvTypeDef *kv, W9825G6KH_KvStatsTypeDef *stats)
+{
+    if (kv != NULL && stats != NULL) {
+        *stats = kv->Stats;
+    }
+}
+
+/**
+  * @brief  Measures lookups per second at 25/50/75/90 % load
+  * @note   Destroys the contents of [Offset, Offset+Size)
+  * @param  Offset: Table range start
+  * @param  Size: Table range size
+  * @param  Lookups: Lookups per measurement
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Benchmark(uint32_t Offset, uint32_t Size, uint32_t Lookups)
+{
+    static const uint32_t loads[4] = { 25U, 50U, 75U, 90U };
+    static W9825G6KH_KvTypeDef kv;
+    static uint32_t keys[W9825G6KH_KV_BATCH_MAX];
+    static uint32_t values[W9825G6KH_KV_BATCH_MAX];
+    W9825G6KH_StatusTypeDef status;
+    uint32_t rng = 0x2545F491U;
+    uint32_t value;
+
+    if (Lookups == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_KV_Create(&kv, Offset, Size);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    printf("=== SDRAM KV Benchmark: %lu buckets x %u B, %lu slots ===\n",
+           kv.BucketCount, (unsigned)W9825G6KH_KV_BUCKET_BYTES, kv.Capacity);
+    printf("  %5s %9s %12s %12s %12s %12s %8s\n",
+           "Load%", "Keys", "Put/s", "GetHit/s", "GetMiss/s", "Batch/s", "Bkt/get");
+
+    for (uint32_t l = 0; l < 4U; l++) {
+        uint32_t target = (uint32_t)((uint64_t)kv.Capacity * loads[l] / 100U);
+        uint32_t first = kv.Count;
+        uint32_t t0, put_cycles, hit_cycles, miss_cycles, batch_cycles;
+        uint32_t reads;
+
+        if (loads[l] > W9825G6KH_KV_MAX_LOAD_PCT) {
+            break;
+        }
+
+        /* Grow the same table to the next load factor */
+        t0 = W9825G6KH_Perf_GetCycles();
+        for (uint32_t i = first; i < target; i++) {
+            if (W9825G6KH_KV_Put(&kv, W9825G6KH_KV_BenchKey(i), i) != W9825G6KH_OK) {
+                printf("  Put failed at %lu keys\n", i);
+                return W9825G6KH_ERROR;
+            }
+        }
+        put_cycles = W9825G6KH_Perf_GetCycles() - t0;
+        memset(kv.Hot, 0, sizeof(kv.Hot));
+
+        reads = kv.Stats.BucketReads;
+        t0 = W9825G6KH_Perf_GetCycles();
+        for (uint32_t n = 0; n < Lookups; n++) {
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            if (W9825G6KH_KV_Get(&kv, W9825G6KH_KV_BenchKey(rng % target), &value) != W9825G6KH_OK) {
+                printf("  Lookup miss on an inserted key\n");
+                return W9825G6KH_ERROR;
+            }
+        }
+        hit_cycles = W9825G6KH_Perf_GetCycles() - t0;
+        reads = kv.Stats.BucketReads - reads;
+
+        t0 = W9825G6KH_Perf_GetCycles();
+        for (uint32_t n = 0; n < Lookups; n++) {
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            (void)W9825G6KH_KV_Get(&kv, W9825G6KH_KV_BenchKey(target + (rng & 0x0FFFFFFFU)), &value);
+        }
+        miss_cycles = W9825G6KH_Perf_GetCycles() - t0;
+
+        memset(kv.Hot, 0, sizeof(kv.Hot));
+        t0 = W9825G6KH_Perf_GetCycles();
+        for (uint32_t n = 0; n < Lookups; n += W9825G6KH_KV_BATCH_MAX) {
+            for (uint32_t i = 0; i < W9825G6KH_KV_BATCH_MAX; i++) {
+                rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+                keys[i] = W9825G6KH_KV_BenchKey(rng % target);
+            }
+            if (W9825G6KH_KV_GetBatch(&kv, keys, values, NULL, W9825G6KH_KV_BATCH_MAX) != W9825G6KH_KV_BATCH_MAX) {
+                printf("  Batch lookup missed an inserted key\n");
+                return W9825G6KH_ERROR;
+            }
+        }
+        batch_cycles = W9825G6KH_Perf_GetCycles() - t0;
+
+        printf("  %5lu %9lu %12lu %12lu %12lu %12lu %5lu.%02lu\n",
+               loads[l], kv.Count,
+               W9825G6KH_KV_PerSecond(target - first, put_cycles),
+               W9825G6KH_KV_PerSecond(Lookups, hit_cycles),
+               W9825G6KH_KV_PerSecond(Lookups, miss_cycles),
+               W9825G6KH_KV_PerSecond((Lookups + W9825G6KH_KV_BATCH_MAX - 1U) / W9825G6KH_KV_BATCH_MAX * W9825G6KH_KV_BATCH_MAX,
+                                      batch_cycles),
+               reads / Lookups, (reads % Lookups) * 100U / Lookups);
+    }
+
+    return W9825G6KH_OK;
+}
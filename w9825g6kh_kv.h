@@ -0,0 +1,104 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_kv.h
+  * @brief   Open-addressing hash table with buckets in W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_KV_H
+#define __W9825G6KH_KV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Bucket size: 32 (one D-cache line, 4 slots) or 512 (one SDRAM page, 64
+ * slots). A lookup reads one bucket unless it has overflowed. */
+#ifndef W9825G6KH_KV_BUCKET_BYTES
+#define W9825G6KH_KV_BUCKET_BYTES        32U
+#endif
+
+/* Hot-key directory in SRAM (per table, direct mapped, power of two) */
+#ifndef W9825G6KH_KV_HOT_ENTRIES
+#define W9825G6KH_KV_HOT_ENTRIES         256U
+#endif
+
+/* Keys per batch pass in W9825G6KH_KV_GetBatch */
+#ifndef W9825G6KH_KV_BATCH_MAX
+#define W9825G6KH_KV_BATCH_MAX           64U
+#endif
+
+/* Put fails beyond this load factor (percent) */
+#ifndef W9825G6KH_KV_MAX_LOAD_PCT
+#define W9825G6KH_KV_MAX_LOAD_PCT        90U
+#endif
+
+/* Delete rehashes the table in place beyond this share of tombstones (percent) */
+#ifndef W9825G6KH_KV_TOMBSTONE_PCT
+#define W9825G6KH_KV_TOMBSTONE_PCT       20U
+#endif
+
+/* Reserved key values */
+#define W9825G6KH_KV_KEY_EMPTY           0x00000000U
+#define W9825G6KH_KV_KEY_DELETED         0xFFFFFFFFU
+
+#define W9825G6KH_KV_SLOTS_PER_BUCKET    (W9825G6KH_KV_BUCKET_BYTES / sizeof(W9825G6KH_KvSlotTypeDef))
+
+/* Exported types ------------------------------------------------------------*/
+/* Value is a 32-bit payload, typically an SDRAM offset of the record blob */
+typedef struct {
+    uint32_t Key;
+    uint32_t Value;
+} W9825G6KH_KvSlotTypeDef;
+
+typedef struct {
+    uint32_t Lookups;
+    uint32_t Hits;
+    uint32_t HotHits;            /* Served from the SRAM directory */
+    uint32_t BucketReads;        /* SDRAM buckets scanned by lookups */
+    uint32_t Inserts;
+    uint32_t Deletes;
+    uint32_t Rehashes;           /* In-place rehashes that dropped tombstones */
+} W9825G6KH_KvStatsTypeDef;
+
+typedef struct {
+    uint32_t Offset;             /* Bucket array (offset from SDRAM base) */
+    uint32_t BucketCount;        /* Power of two */
+    uint32_t Count;              /* Live keys */
+    uint32_t Tombstones;
+    uint32_t Capacity;           /* Slots */
+    W9825G6KH_KvStatsTypeDef Stats;
+    W9825G6KH_KvSlotTypeDef Hot[W9825G6KH_KV_HOT_ENTRIES];
+    uint32_t BatchOrder[W9825G6KH_KV_BATCH_MAX];   /* GetBatch probe order */
+} W9825G6KH_KvTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Create(W9825G6KH_KvTypeDef *kv, uint32_t Offset, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Clear(W9825G6KH_KvTypeDef *kv);
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Put(W9825G6KH_KvTypeDef *kv, uint32_t Key, uint32_t Value);
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Get(W9825G6KH_KvTypeDef *kv, uint32_t Key, uint32_t *pValue);
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Delete(W9825G6KH_KvTypeDef *kv, uint32_t Key);
+uint32_t W9825G6KH_KV_GetBatch(W9825G6KH_KvTypeDef *kv, const uint32_t *pKeys, uint32_t *pValues,
+                               uint8_t *pFound, uint32_t Count);
+uint32_t W9825G6KH_KV_LoadPercent(const W9825G6KH_KvTypeDef *kv);
+void W9825G6KH_KV_GetStats(const W9825G6KH_KvTypeDef *kv, W9825G6KH_KvStatsTypeDef *stats);
+W9825G6KH_StatusTypeDef W9825G6KH_KV_Benchmark(uint32_t Offset, uint32_t Size, uint32_t Lookups);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_KV_H */
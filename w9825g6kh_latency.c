@@ -0,0 +1,444 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_latency.c
+  * @brief   Worst-case access latency characterization for W9825G6KH
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Each sample is one 32-bit access timed with DWT->CYCCNT with interrupts
+  * masked, so the spread comes from the SDRAM side only: the row state left
+  * by the previous access and any auto-refresh the FMC slots in ahead of
+  * it. Reads invalidate the cache line first so every sample reaches
+  * SDRAM (and includes the 32-byte line fill). Writes are only meaningful
+  * if the MPU maps the window non-cacheable or write-through; otherwise
+  * they measure the D-cache.
+  *
+  * Address mapping (bank-row-column): each bank is a contiguous 8 MB block
+  * and a row is a 512-byte page inside it. ROW_HIT walks the lines of one
+  * page, ROW_MISS steps one page (same bank, next row), BANK_CONFLICT steps
+  * 8 MB (next bank) and moves to the next row after every round of banks.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_latency.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define LAT_WINDOW_PAGES             (W9825G6KH_LATENCY_WINDOW_BYTES / W9825G6KH_PAGE_SIZE_BYTES)
+#define LAT_LINE_BYTES               32U
+#define LAT_DMA2D_LOAD_LINES         256U    /* 256 x 4 KB = 1 MB per job */
+#define LAT_DMA2D_LOAD_BYTES         (LAT_DMA2D_LOAD_LINES * 4096U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t lat_hist[W9825G6KH_LATENCY_BINS];
+static uint32_t lat_overflows = 0;
+static volatile uint32_t lat_sink;
+#if W9825G6KH_LATENCY_USE_DMA2D
+static W9825G6KH_Dma2dJobTypeDef lat_dma_job;
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Offset of sample i */
+static uint32_t W9825G6KH_Latency_Addr(const W9825G6KH_LatencyConfigTypeDef *Config, uint32_t i)
+{
+    uint32_t bank = W9825G6KH_ADDR_TO_BANK(Config->Offset);
+    uint32_t base = Config->Offset - bank * W9825G6KH_BANK_SIZE_BYTES;
+
+    switch (Config->Pattern) {
+        case W9825G6KH_LAT_ROW_MISS:
+            return Config->Offset + (i % LAT_WINDOW_PAGES) * W9825G6KH_PAGE_SIZE_BYTES;
+        case W9825G6KH_LAT_BANK_CONFLICT:
+            return ((bank + i) % W9825G6KH_BANK_COUNT) * W9825G6KH_BANK_SIZE_BYTES + base +
+                   ((i / W9825G6KH_BANK_COUNT) % LAT_WINDOW_PAGES) * W9825G6KH_PAGE_SIZE_BYTES;
+        case W9825G6KH_LAT_ROW_HIT:
+        default:
+            return Config->Offset + (i * LAT_LINE_BYTES) % W9825G6KH_PAGE_SIZE_BYTES;
+    }
+}
+
+/* Tells whether [Start, Start + Size) overlaps the window of any bank the
+ * run touches */
+static uint32_t W9825G6KH_Latency_Overlaps(const W9825G6KH_LatencyConfigTypeDef *Config, uint32_t Start, uint32_t Size)
+{
+    uint32_t bank = W9825G6KH_ADDR_TO_BANK(Config->Offset);
+    uint32_t base = Config->Offset - bank * W9825G6KH_BANK_SIZE_BYTES;
+    uint32_t banks = (Config->Pattern == W9825G6KH_LAT_BANK_CONFLICT) ? W9825G6KH_BANK_COUNT : 1U;
+
+    for (uint32_t b = 0; b < banks; b++) {
+        uint32_t w = ((bank + b) % W9825G6KH_BANK_COUNT) * W9825G6KH_BANK_SIZE_BYTES + base;
+
+        if (Start < w + W9825G6KH_LATENCY_WINDOW_BYTES && w < Start + Size) {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/* Smallest cost of an empty timing window */
+static uint32_t W9825G6KH_Latency_Overhead(void)
+{
+    uint32_t best = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        uint32_t t0 = W9825G6KH_Perf_GetCycles();
+        __DSB();
+        uint32_t t1 = W9825G6KH_Perf_GetCycles();
+        __set_PRIMASK(primask);
+
+        if (t1 - t0 < best) {
+            best = t1 - t0;
+        }
+    }
+    return best;
+}
+
+/* Cycles at which a fraction num/den of the samples are at or below */
+static uint32_t W9825G6KH_Latency_Percentile(uint32_t samples, uint32_t num, uint32_t den, uint32_t max)
+{
+    uint32_t target = (uint32_t)(((uint64_t)samples * num + den - 1U) / den);
+    uint32_t seen = 0;
+
+    if (target == 0U) {
+        target = 1U;
+    }
+    for (uint32_t b = 0; b < W9825G6KH_LATENCY_BINS; b++) {
+        seen += lat_hist[b];
+        if (seen >= target) {
+            return b;
+        }
+    }
+    return max;     /* Lands in the overflow bin */
+}
+
+#if W9825G6KH_LATENCY_USE_DMA2D
+/* Starts (or restarts, once finished) a DMA2D fill of the load window */
+static void W9825G6KH_Latency_Dma2dPump(uint32_t LoadOffset, uint32_t start)
+{
+    if (!start && W9825G6KH_Dma2d_Poll(&lat_dma_job, 0U) == W9825G6KH_BUSY) {
+        return;
+    }
+    if (W9825G6KH_Dma2d_Acquire(start ? W9825G6KH_CMD_TIMEOUT : 0U) != W9825G6KH_OK) {
+        return;
+    }
+
+    DMA2D->CR = DMA2D_CR_MODE;
+    DMA2D->OPFCCR = 0U;
+    DMA2D->OCOLR = 0x5A5A5A5AU;
+    DMA2D->OMAR = W9825G6KH_BANK_ADDR + LoadOffset;
+    DMA2D->OOR = 0U;
+    DMA2D->NLR = (1024U << DMA2D_NLR_PL_Pos) | LAT_DMA2D_LOAD_LINES;
+    DMA2D->CR |= DMA2D_CR_START;
+    W9825G6KH_Dma2d_Release(&lat_dma_job);
+}
+#endif
+
+static W9825G6KH_StatusTypeDef W9825G6KH_Latency_LoadBegin(const W9825G6KH_LatencyConfigTypeDef *Config)
+{
+    switch (Config->Load) {
+        case W9825G6KH_LAT_LOAD_NONE:
+            return W9825G6KH_OK;
+        case W9825G6KH_LAT_LOAD_USER:
+            W9825G6KH_Latency_LoadStart();
+            return W9825G6KH_OK;
+        case W9825G6KH_LAT_LOAD_DMA2D:
+#if W9825G6KH_LATENCY_USE_DMA2D
+        {
+            if (Config->LoadOffset > W9825G6KH_SIZE_BYTES - LAT_DMA2D_LOAD_BYTES ||
+                W9825G6KH_Latency_Overlaps(Config, Config->LoadOffset, LAT_DMA2D_LOAD_BYTES)) {
+                return W9825G6KH_INVALID_PARAM;
+            }
+            lat_dma_job.State = W9825G6KH_DMA2D_JOB_IDLE;
+            W9825G6KH_Latency_Dma2dPump(Config->LoadOffset, 1U);
+            return W9825G6KH_OK;
+        }
+#endif
+        default:
+            return W9825G6KH_INVALID_PARAM;
+    }
+}
+
+static void W9825G6KH_Latency_LoadEnd(const W9825G6KH_LatencyConfigTypeDef *Config)
+{
+    if (Config->Load == W9825G6KH_LAT_LOAD_USER) {
+        W9825G6KH_Latency_LoadStop();
+    }
+#if W9825G6KH_LATENCY_USE_DMA2D
+    if (Config->Load == W9825G6KH_LAT_LOAD_DMA2D && lat_dma_job.State != W9825G6KH_DMA2D_JOB_IDLE) {
+        (void)W9825G6KH_Dma2d_Poll(&lat_dma_job, 1U);
+    }
+#endif
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Times single accesses under one set of conditions
+  * @note   Refresh rate and CAS latency are changed for the run only and
+  *         restored afterwards. The refresh rate may only be lowered (more
+  *         frequent refresh); a longer interval would risk data retention.
+  *         Do not run with code or stack in SDRAM when changing CAS.
+  * @param  Config: Pattern, access type and conditions
+  * @param  Result: Percentiles in core cycles
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Latency_Run(const W9825G6KH_LatencyConfigTypeDef *Config,
+                                              W9825G6KH_LatencyResultTypeDef *Result)
+{
+    W9825G6KH_InitTypeDef saved;
+    W9825G6KH_StatusTypeDef status;
+    uint64_t total = 0;
+    uint32_t overhead;
+    uint32_t min = 0xFFFFFFFFU;
+    uint32_t max = 0;
+
+    if (Config == NULL || Result == NULL || Config->Samples == 0U ||
+        (uint32_t)Config->Pattern >= W9825G6KH_LAT_PATTERN_COUNT ||
+        (Config->Offset & 0xFFFU) != 0U || Config->Offset >= W9825G6KH_SIZE_BYTES ||
+        Config->Offset % W9825G6KH_BANK_SIZE_BYTES > W9825G6KH_BANK_SIZE_BYTES - W9825G6KH_LATENCY_WINDOW_BYTES) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_GetConfig(&saved);
+    if (status != W9825G6KH_OK || !W9825G6KH_IsReady()) {
+        return W9825G6KH_ERROR;
+    }
+    if (Config->RefreshRate > saved.RefreshRate) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (Config->RefreshRate != 0U && Config->RefreshRate != saved.RefreshRate) {
+        status = W9825G6KH_SetRefreshRate(Config->RefreshRate);
+    }
+    if (status == W9825G6KH_OK && Config->CASLatency != 0U && Config->CASLatency != saved.CASLatency) {
+        status = W9825G6KH_SetCASLatency(Config->CASLatency);
+    }
+    if (status == W9825G6KH_OK) {
+        status = W9825G6KH_Latency_LoadBegin(Config);
+    }
+
+    if (status == W9825G6KH_OK) {
+        memset(lat_hist, 0, sizeof(lat_hist));
+        lat_overflows = 0;
+        overhead = W9825G6KH_Latency_Overhead();
+
+        for (uint32_t i = 0; i < Config->Samples; i++) {
+            volatile uint32_t *p = (volatile uint32_t *)(W9825G6KH_BANK_ADDR + W9825G6KH_Latency_Addr(Config, i));
+            uint32_t primask;
+            uint32_t t0, t1, cycles;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+            SCB_InvalidateDCache_by_Addr((uint32_t *)p, (int32_t)LAT_LINE_BYTES);
+#endif
+            primask = __get_PRIMASK();
+            __disable_irq();
+            t0 = W9825G6KH_Perf_GetCycles();
+            if (Config->Access == W9825G6KH_ACCESS_WRITE) {
+                *p = i;
+            } else {
+                lat_sink = *p;
+            }
+            __DSB();
+            t1 = W9825G6KH_Perf_GetCycles();
+            __set_PRIMASK(primask);
+
+            cycles = t1 - t0;
+            cycles = (cycles > overhead) ? cycles - overhead : 0U;
+
+            if (cycles < W9825G6KH_LATENCY_BINS) {
+                lat_hist[cycles]++;
+            } else {
+                lat_overflows++;
+            }
+            total += cycles;
+            if (cycles < min) {
+                min = cycles;
+            }
+            if (cycles > max) {
+                max = cycles;
+            }
+
+#if W9825G6KH_LATENCY_USE_DMA2D
+            if (Config->Load == W9825G6KH_LAT_LOAD_DMA2D) {
+                W9825G6KH_Latency_Dma2dPump(Config->LoadOffset, 0U);
+            }
+#endif
+        }
+
+        W9825G6KH_Latency_LoadEnd(Config);
+
+        Result->Samples = Config->Samples;
+        Result->OverheadCycles = overhead;
+        Result->Min = min;
+        Result->P50 = W9825G6KH_Latency_Percentile(Config->Samples, 50U, 100U, max);
+        Result->P90 = W9825G6KH_Latency_Percentile(Config->Samples, 90U, 100U, max);
+        Result->P99 = W9825G6KH_Latency_Percentile(Config->Samples, 99U, 100U, max);
+        Result->P999 = W9825G6KH_Latency_Percentile(Config->Samples, 999U, 1000U, max);
+        Result->Max = max;
+        Result->Mean = (uint32_t)(total / Config->Samples);
+        Result->Overflows = lat_overflows;
+        Result->RefreshRate = (Config->RefreshRate != 0U) ? Config->RefreshRate : saved.RefreshRate;
+        Result->CASLatency = (Config->CASLatency != 0U) ? Config->CASLatency : saved.CASLatency;
+        Result->Load = Config->Load;
+    }
+
+    /* Restore the operating conditions */
+    if (Config->CASLatency != 0U && Config->CASLatency != saved.CASLatency) {
+        (void)W9825G6KH_SetCASLatency(saved.CASLatency);
+    }
+    if (Config->RefreshRate != 0U && Config->RefreshRate != saved.RefreshRate) {
+        (void)W9825G6KH_SetRefreshRate(saved.RefreshRate);
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Runs every pattern, reads and writes, at CAS 2 and 3 and at the
+  *         configured and doubled refresh frequency, and prints one line each
+  * @param  Offset: Test window (4 KB aligned, W9825G6KH_LATENCY_WINDOW_BYTES
+  *         inside one bank)
+  * @param  Samples: Samples per run
+  * @param  Load: Background load for all runs
+  * @retval W9825G6KH status of the first failing run, else W9825G6KH_OK
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Latency_Sweep(uint32_t Offset, uint32_t Samples, W9825G6KH_LatencyLoadTypeDef Load)
+{
+    static const uint32_t cas[2] = { W9825G6KH_MR_CAS_LATENCY_2, W9825G6KH_MR_CAS_LATENCY_3 };
+    W9825G6KH_LatencyConfigTypeDef cfg;
+    W9825G6KH_LatencyResultTypeDef res;
+    W9825G6KH_InitTypeDef current;
+    W9825G6KH_StatusTypeDef status;
+
+    if (W9825G6KH_GetConfig(&current) != W9825G6KH_OK) {
+        return W9825G6KH_ERROR;
+    }
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.Offset = Offset;
+    cfg.Samples = Samples;
+    cfg.Load = Load;
+    /* Load in the next bank, beside the window bank-conflict runs use there */
+    cfg.LoadOffset = ((W9825G6KH_ADDR_TO_BANK(Offset) + 1U) % W9825G6KH_BANK_COUNT) * W9825G6KH_BANK_SIZE_BYTES;
+    if (Offset % W9825G6KH_BANK_SIZE_BYTES + W9825G6KH_LATENCY_WINDOW_BYTES + LAT_DMA2D_LOAD_BYTES <=
+        W9825G6KH_BANK_SIZE_BYTES) {
+        cfg.LoadOffset += Offset % W9825G6KH_BANK_SIZE_BYTES + W9825G6KH_LATENCY_WINDOW_BYTES;
+    }
+
+    printf("=== SDRAM Latency Sweep (%lu samples, cycles @ %lu MHz) ===\n",
+           Samples, SystemCoreClock / 1000000U);
+    printf("  %-14s %-5s %3s %7s %5s %6s %6s %6s %6s %6s %6s\n",
+           "Pattern", "Acc", "CAS", "Refresh", "Load", "Min", "P50", "P90", "P99", "P99.9", "Max");
+
+    for (uint32_t c = 0; c < 2U; c++) {
+        for (uint32_t r = 0; r < 2U; r++) {
+            for (uint32_t p = 0; p < W9825G6KH_LAT_PATTERN_COUNT; p++) {
+                for (uint32_t a = 0; a < 2U; a++) {
+                    cfg.CASLatency = cas[c];
+                    cfg.RefreshRate = (r == 0U) ? current.RefreshRate : (current.RefreshRate / 2U) & ~1UL;
+                    cfg.Pattern = (W9825G6KH_LatencyPatternTypeDef)p;
+                    cfg.Access = (a == 0U) ? W9825G6KH_ACCESS_READ : W9825G6KH_ACCESS_WRITE;
+
+                    status = W9825G6KH_Latency_Run(&cfg, &res);
+                    if (status != W9825G6KH_OK) {
+                        printf("  Run failed: %s\n", W9825G6KH_StatusToString(status));
+                        return status;
+                    }
+                    W9825G6KH_Latency_PrintResult(&cfg, &res);
+                }
+            }
+        }
+    }
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Prints one result line (see W9825G6KH_Latency_Sweep header)
+  */
+void W9825G6KH_Latency_PrintResult(const W9825G6KH_LatencyConfigTypeDef *Config,
+                                   const W9825G6KH_LatencyResultTypeDef *Result)
+{
+    static const char *loads[3] = { "none", "dma2d", "user" };
+
+    if (Config == NULL || Result == NULL) {
+        return;
+    }
+
+    printf("  %-14s %-5s %3lu %7lu %5s %6lu %6lu %6lu %6lu %6lu %6lu%s\n",
+           W9825G6KH_Latency_PatternName(Config->Pattern),
+           (Config->Access == W9825G6KH_ACCESS_WRITE) ? "write" : "read",
+           (Result->CASLatency >> W9825G6KH_MR_CAS_LATENCY_POS) & 0x7U,
+           Result->RefreshRate,
+           ((uint32_t)Result->Load < 3U) ? loads[Result->Load] : "?",
+           Result->Min, Result->P50, Result->P90, Result->P99, Result->P999, Result->Max,
+           (Result->Overflows != 0U) ? " (overflow)" : "");
+}
+
+/**
+  * @brief  Prints the per-cycle histogram of the last run with cumulative
+  *         percentages
+  */
+void W9825G6KH_Latency_PrintHistogram(void)
+{
+    uint32_t samples = lat_overflows;
+    uint32_t seen = 0;
+
+    for (uint32_t b = 0; b < W9825G6KH_LATENCY_BINS; b++) {
+        samples += lat_hist[b];
+    }
+    if (samples == 0U) {
+        printf("  No samples\n");
+        return;
+    }
+
+    printf("  %6s %8s %7s\n", "Cycles", "Count", "Cum%");
+    for (uint32_t b = 0; b < W9825G6KH_LATENCY_BINS; b++) {
+        if (lat_hist[b] != 0U) {
+            seen += lat_hist[b];
+            printf("  %6lu %8lu %6lu.%lu\n", b, lat_hist[b],
+                   (uint32_t)((uint64_t)seen * 100U / samples),
+                   (uint32_t)((uint64_t)seen * 1000U / samples % 10U));
+        }
+    }
+    if (lat_overflows != 0U) {
+        printf("  >=%4u %8lu  100.0\n", (unsigned)W9825G6KH_LATENCY_BINS, lat_overflows);
+    }
+}
+
+const char* W9825G6KH_Latency_PatternName(W9825G6KH_LatencyPatternTypeDef Pattern)
+{
+    switch (Pattern) {
+        case W9825G6KH_LAT_ROW_HIT:       return "row-hit";
+        case W9825G6KH_LAT_ROW_MISS:      return "row-miss";
+        case W9825G6KH_LAT_BANK_CONFLICT: return "bank-conflict";
+        default:                          return "unknown";
+    }
+}
+
+/**
+  * @brief  Starts the application's background load (W9825G6KH_LAT_LOAD_USER)
+  * @note   This function should not be modified; when the callback is
+  *         needed, implement it in the user file.
+  */
+__weak void W9825G6KH_Latency_LoadStart(void)
+{
+}
+
+/**
+  * @brief  Stops the application's background load
+  */
+__weak void W9825G6KH_Latency_LoadStop(void)
+{
+}
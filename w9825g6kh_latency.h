@@ -0,0 +1,103 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_latency.h
+  * @brief   Worst-case access latency characterization for W9825G6KH:
+  *          row-hit / row-miss / bank-conflict patterns, percentiles
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_LATENCY_H
+#define __W9825G6KH_LATENCY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Histogram resolution: one bin per core cycle below this, one overflow bin */
+#ifndef W9825G6KH_LATENCY_BINS
+#define W9825G6KH_LATENCY_BINS           512U
+#endif
+
+/* Span a run walks through inside each bank it touches (must fit in one
+ * bank); write runs overwrite it */
+#define W9825G6KH_LATENCY_WINDOW_BYTES   (4UL * 1024UL * 1024UL)
+
+/* 1: W9825G6KH_LAT_LOAD_DMA2D keeps DMA2D filling a second window */
+#ifndef W9825G6KH_LATENCY_USE_DMA2D
+#define W9825G6KH_LATENCY_USE_DMA2D      0
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_LAT_ROW_HIT = 0,       /* Same open row, new column each time */
+    W9825G6KH_LAT_ROW_MISS,          /* New row in the same bank each time */
+    W9825G6KH_LAT_BANK_CONFLICT,     /* Next bank (8 MB stride) each time, new row in it */
+    W9825G6KH_LAT_PATTERN_COUNT
+} W9825G6KH_LatencyPatternTypeDef;
+
+typedef enum {
+    W9825G6KH_LAT_LOAD_NONE = 0,
+    W9825G6KH_LAT_LOAD_DMA2D,        /* Built-in, needs W9825G6KH_LATENCY_USE_DMA2D */
+    W9825G6KH_LAT_LOAD_USER          /* W9825G6KH_Latency_LoadStart/Stop hooks */
+} W9825G6KH_LatencyLoadTypeDef;
+
+typedef struct {
+    W9825G6KH_LatencyPatternTypeDef Pattern;
+    uint32_t Access;             /* W9825G6KH_ACCESS_READ or W9825G6KH_ACCESS_WRITE */
+    uint32_t Samples;
+    uint32_t Offset;             /* Window start, 4 KB aligned; the window may not cross
+                                    a bank and bank-conflict runs repeat it in every bank */
+    uint32_t RefreshRate;        /* 0: keep; else only values <= the current one */
+    uint32_t CASLatency;         /* 0: keep; W9825G6KH_MR_CAS_LATENCY_2/3 */
+    W9825G6KH_LatencyLoadTypeDef Load;
+    uint32_t LoadOffset;         /* DMA2D load window (must not overlap) */
+} W9825G6KH_LatencyConfigTypeDef;
+
+typedef struct {
+    uint32_t Samples;
+    uint32_t OverheadCycles;     /* Empty timing window, already subtracted */
+    uint32_t Min;
+    uint32_t P50;
+    uint32_t P90;
+    uint32_t P99;
+    uint32_t P999;
+    uint32_t Max;
+    uint32_t Mean;
+    uint32_t Overflows;          /* Samples >= W9825G6KH_LATENCY_BINS cycles */
+    uint32_t RefreshRate;        /* Conditions the run used */
+    uint32_t CASLatency;
+    W9825G6KH_LatencyLoadTypeDef Load;
+} W9825G6KH_LatencyResultTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Latency_Run(const W9825G6KH_LatencyConfigTypeDef *Config,
+                                              W9825G6KH_LatencyResultTypeDef *Result);
+W9825G6KH_StatusTypeDef W9825G6KH_Latency_Sweep(uint32_t Offset, uint32_t Samples, W9825G6KH_LatencyLoadTypeDef Load);
+void W9825G6KH_Latency_PrintHistogram(void);
+void W9825G6KH_Latency_PrintResult(const W9825G6KH_LatencyConfigTypeDef *Config,
+                                   const W9825G6KH_LatencyResultTypeDef *Result);
+const char* W9825G6KH_Latency_PatternName(W9825G6KH_LatencyPatternTypeDef Pattern);
+
+/* Background load hooks for W9825G6KH_LAT_LOAD_USER: weak, empty. Start a
+ * circular DMA stream to or from SDRAM (outside the test window). */
+void W9825G6KH_Latency_LoadStart(void);
+void W9825G6KH_Latency_LoadStop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_LATENCY_H */
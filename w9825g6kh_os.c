@@ -0,0 +1,347 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_os.c
+  * @brief   FreeRTOS / CMSIS-RTOS2 / pthreads backends of the W9825G6KH OS
+  *          abstraction
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Select the backend with W9825G6KH_OS. Semaphore give is safe from
+  * interrupt context on the RTOS backends; mutexes are task-only.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_os.h"
+
+#if (W9825G6KH_OS == W9825G6KH_OS_FREERTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+#elif (W9825G6KH_OS == W9825G6KH_OS_CMSIS_RTOS2)
+#include "cmsis_os2.h"
+#elif (W9825G6KH_OS == W9825G6KH_OS_PTHREAD)
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#endif
+
+#if (W9825G6KH_OS == W9825G6KH_OS_FREERTOS) /*-----------------------------------*/
+
+W9825G6KH_OS_MutexTypeDef W9825G6KH_OS_MutexCreate(void)
+{
+    return (W9825G6KH_OS_MutexTypeDef)xSemaphoreCreateRecursiveMutex();
+}
+
+void W9825G6KH_OS_MutexLock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    xSemaphoreTakeRecursive((SemaphoreHandle_t)mutex, portMAX_DELAY);
+}
+
+void W9825G6KH_OS_MutexUnlock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    xSemaphoreGiveRecursive((SemaphoreHandle_t)mutex);
+}
+
+W9825G6KH_OS_SemTypeDef W9825G6KH_OS_SemCreate(uint32_t max_count, uint32_t initial_count)
+{
+    return (W9825G6KH_OS_SemTypeDef)xSemaphoreCreateCounting(max_count, initial_count);
+}
+
+uint32_t W9825G6KH_OS_SemTake(W9825G6KH_OS_SemTypeDef sem, uint32_t timeout_ms)
+{
+    TickType_t ticks = (timeout_ms == W9825G6KH_OS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return (xSemaphoreTake((SemaphoreHandle_t)sem, ticks) == pdTRUE) ? 1U : 0U;
+}
+
+void W9825G6KH_OS_SemGive(W9825G6KH_OS_SemTypeDef sem)
+{
+    if (__get_IPSR() != 0U) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR((SemaphoreHandle_t)sem, &woken);
+        portYIELD_FROM_ISR(woken);
+    } else {
+        xSemaphoreGive((SemaphoreHandle_t)sem);
+    }
+}
+
+W9825G6KH_StatusTypeDef W9825G6KH_OS_ThreadCreate(W9825G6KH_OS_ThreadFuncTypeDef func, void *arg,
+                                                  const char *name, uint32_t stack_bytes,
+                                                  uint32_t priority)
+{
+    if (xTaskCreate(func, name, (configSTACK_DEPTH_TYPE)(stack_bytes / sizeof(StackType_t)),
+                    arg, (UBaseType_t)priority, NULL) != pdPASS) {
+        return W9825G6KH_ERROR;
+    }
+    return W9825G6KH_OK;
+}
+
+void* W9825G6KH_OS_CurrentThread(void)
+{
+    return (void *)xTaskGetCurrentTaskHandle();
+}
+
+#elif (W9825G6KH_OS == W9825G6KH_OS_CMSIS_RTOS2) /*------------------------------*/
+
+static uint32_t W9825G6KH_OS_MsToTicks(uint32_t timeout_ms)
+{
+    if (timeout_ms == W9825G6KH_OS_WAIT_FOREVER) {
+        return osWaitForever;
+    }
+    return (uint32_t)(((uint64_t)timeout_ms * osKernelGetTickFreq() + 999U) / 1000U);
+}
+
+W9825G6KH_OS_MutexTypeDef W9825G6KH_OS_MutexCreate(void)
+{
+    const osMutexAttr_t attr = {
+        .name = "w9825g6kh",
+        .attr_bits = osMutexRecursive | osMutexPrioInherit,
+    };
+    return (W9825G6KH_OS_MutexTypeDef)osMutexNew(&attr);
+}
+
+void W9825G6KH_OS_MutexLock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    osMutexAcquire((osMutexId_t)mutex, osWaitForever);
+}
+
+void W9825G6KH_OS_MutexUnlock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    osMutexRelease((osMutexId_t)mutex);
+}
+
+W9825G6KH_OS_SemTypeDef W9825G6KH_OS_SemCreate(uint32_t max_count, uint32_t initial_count)
+{
+    return (W9825G6KH_OS_SemTypeDef)osSemaphoreNew(max_count, initial_count, NULL);
+}
+
+uint32_t W9825G6KH_OS_SemTake(W9825G6KH_OS_SemTypeDef sem, uint32_t timeout_ms)
+{
+    return (osSemaphoreAcquire((osSemaphoreId_t)sem, W9825G6KH_OS_MsToTicks(timeout_ms)) == osOK) ? 1U : 0U;
+}
+
+void W9825G6KH_OS_SemGive(W9825G6KH_OS_SemTypeDef sem)
+{
+    osSemaphoreRelease((osSemaphoreId_t)sem);
+}
+
+W9825G6KH_StatusTypeDef W9825G6KH_OS_ThreadCreate(W9825G6KH_OS_ThreadFuncTypeDef func, void *arg,
+                                                  const char *name, uint32_t stack_bytes,
+                                                  uint32_t priority)
+{
+    const osThreadAttr_t attr = {
+        .name = name,
+        .stack_size = stack_bytes,
+        .priority = (osPriority_t)priority,
+    };
+    return (osThreadNew(func, arg, &attr) != NULL) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+void* W9825G6KH_OS_CurrentThread(void)
+{
+    return (void *)osThreadGetId();
+}
+
+#elif (W9825G6KH_OS == W9825G6KH_OS_PTHREAD) /*----------------------------------*/
+
+typedef struct {
+    W9825G6KH_OS_ThreadFuncTypeDef Func;
+    void *Arg;
+} W9825G6KH_OS_ThreadStartTypeDef;
+
+static void* W9825G6KH_OS_ThreadTrampoline(void *p)
+{
+    W9825G6KH_OS_ThreadStartTypeDef start = *(W9825G6KH_OS_ThreadStartTypeDef *)p;
+    free(p);
+    start.Func(start.Arg);
+    return NULL;
+}
+
+W9825G6KH_OS_MutexTypeDef W9825G6KH_OS_MutexCreate(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutex_t *m = malloc(sizeof(pthread_mutex_t));
+
+    if (m == NULL) {
+        return NULL;
+    }
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(m, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return (W9825G6KH_OS_MutexTypeDef)m;
+}
+
+void W9825G6KH_OS_MutexLock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    pthread_mutex_lock((pthread_mutex_t *)mutex);
+}
+
+void W9825G6KH_OS_MutexUnlock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    pthread_mutex_unlock((pthread_mutex_t *)mutex);
+}
+
+W9825G6KH_OS_SemTypeDef W9825G6KH_OS_SemCreate(uint32_t max_count, uint32_t initial_count)
+{
+    sem_t *s = malloc(sizeof(sem_t));
+
+    (void)max_count;
+    if (s == NULL) {
+        return NULL;
+    }
+    sem_init(s, 0, initial_count);
+    return (W9825G6KH_OS_SemTypeDef)s;
+}
+
+uint32_t W9825G6KH_OS_SemTake(W9825G6KH_OS_SemTypeDef sem, uint32_t timeout_ms)
+{
+    struct timespec ts;
+    int rc;
+
+    if (timeout_ms == W9825G6KH_OS_WAIT_FOREVER) {
+        while ((rc = sem_wait((sem_t *)sem)) != 0 && errno == EINTR) {
+        }
+        return (rc == 0) ? 1U : 0U;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += timeout_ms / 1000U;
+    ts.tv_nsec += (long)(timeout_ms % 1000U) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    while ((rc = sem_timedwait((sem_t *)sem, &ts)) != 0 && errno == EINTR) {
+    }
+    return (rc == 0) ? 1U : 0U;
+}
+
+void W9825G6KH_OS_SemGive(W9825G6KH_OS_SemTypeDef sem)
+{
+    sem_post((sem_t *)sem);
+}
+
+W9825G6KH_StatusTypeDef W9825G6KH_OS_ThreadCreate(W9825G6KH_OS_ThreadFuncTypeDef func, void *arg,
+                                                  const char *name, uint32_t stack_bytes,
+                                                  uint32_t priority)
+{
+    W9825G6KH_OS_ThreadStartTypeDef *start = malloc(sizeof(*start));
+    pthread_t thread;
+
+    (void)name;
+    (void)stack_bytes;
+    (void)priority;
+
+    if (start == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    start->Func = func;
+    start->Arg = arg;
+
+    if (pthread_create(&thread, NULL, W9825G6KH_OS_ThreadTrampoline, start) != 0) {
+        free(start);
+        return W9825G6KH_ERROR;
+    }
+    pthread_detach(thread);
+    return W9825G6KH_OK;
+}
+
+void* W9825G6KH_OS_CurrentThread(void)
+{
+    return (void *)pthread_self();
+}
+
+#else /* W9825G6KH_OS_NONE -------------------------------------------------------*/
+
+/* Single context: locks are no-ops and semaphores are plain counters */
+typedef struct {
+    volatile uint32_t Count;
+} W9825G6KH_OS_BareSemTypeDef;
+
+static W9825G6KH_OS_BareSemTypeDef os_bare_sems[4];
+static uint32_t os_bare_sem_used = 0;
+
+W9825G6KH_OS_MutexTypeDef W9825G6KH_OS_MutexCreate(void)
+{
+    return (W9825G6KH_OS_MutexTypeDef)&os_bare_sem_used;
+}
+
+void W9825G6KH_OS_MutexLock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    (void)mutex;
+}
+
+void W9825G6KH_OS_MutexUnlock(W9825G6KH_OS_MutexTypeDef mutex)
+{
+    (void)mutex;
+}
+
+W9825G6KH_OS_SemTypeDef W9825G6KH_OS_SemCreate(uint32_t max_count, uint32_t initial_count)
+{
+    (void)max_count;
+    if (os_bare_sem_used >= sizeof(os_bare_sems) / sizeof(os_bare_sems[0])) {
+        return NULL;
+    }
+    os_bare_sems[os_bare_sem_used].Count = initial_count;
+    return (W9825G6KH_OS_SemTypeDef)&os_bare_sems[os_bare_sem_used++];
+}
+
+uint32_t W9825G6KH_OS_SemTake(W9825G6KH_OS_SemTypeDef sem, uint32_t timeout_ms)
+{
+    W9825G6KH_OS_BareSemTypeDef *s = (W9825G6KH_OS_BareSemTypeDef *)sem;
+    uint32_t start = HAL_GetTick();
+
+    for (;;) {
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+        if (s->Count != 0U) {
+            s->Count--;
+            __set_PRIMASK(primask);
+            return 1U;
+        }
+        __set_PRIMASK(primask);
+
+        if (timeout_ms != W9825G6KH_OS_WAIT_FOREVER && (HAL_GetTick() - start) >= timeout_ms) {
+            return 0U;
+        }
+    }
+}
+
+void W9825G6KH_OS_SemGive(W9825G6KH_OS_SemTypeDef sem)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    ((W9825G6KH_OS_BareSemTypeDef *)sem)->Count++;
+    __set_PRIMASK(primask);
+}
+
+W9825G6KH_StatusTypeDef W9825G6KH_OS_ThreadCreate(W9825G6KH_OS_ThreadFuncTypeDef func, void *arg,
+                                                  const char *name, uint32_t stack_bytes,
+                                                  uint32_t priority)
+{
+    (void)func;
+    (void)arg;
+    (void)name;
+    (void)stack_bytes;
+    (void)priority;
+    return W9825G6KH_ERROR;
+}
+
+void* W9825G6KH_OS_CurrentThread(void)
+{
+    return NULL;
+}
+
+#endif /* W9825G6KH_OS */
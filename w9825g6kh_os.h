@@ -0,0 +1,62 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_os.h
+  * @brief   Minimal OS abstraction used by the W9825G6KH concurrency layer
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_OS_H
+#define __W9825G6KH_OS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define W9825G6KH_OS_NONE                0       /* Bare metal: no task, no locks */
+#define W9825G6KH_OS_FREERTOS            1
+#define W9825G6KH_OS_CMSIS_RTOS2         2
+#define W9825G6KH_OS_PTHREAD             3       /* Host builds and tests */
+
+#ifndef W9825G6KH_OS
+#define W9825G6KH_OS                     W9825G6KH_OS_NONE
+#endif
+
+#define W9825G6KH_OS_WAIT_FOREVER        0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef void* W9825G6KH_OS_MutexTypeDef;    /* Recursive, priority inheriting */
+typedef void* W9825G6KH_OS_SemTypeDef;      /* Counting semaphore */
+typedef void (*W9825G6KH_OS_ThreadFuncTypeDef)(void *arg);
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_OS_MutexTypeDef W9825G6KH_OS_MutexCreate(void);
+void W9825G6KH_OS_MutexLock(W9825G6KH_OS_MutexTypeDef mutex);
+void W9825G6KH_OS_MutexUnlock(W9825G6KH_OS_MutexTypeDef mutex);
+
+W9825G6KH_OS_SemTypeDef W9825G6KH_OS_SemCreate(uint32_t max_count, uint32_t initial_count);
+uint32_t W9825G6KH_OS_SemTake(W9825G6KH_OS_SemTypeDef sem, uint32_t timeout_ms);
+void W9825G6KH_OS_SemGive(W9825G6KH_OS_SemTypeDef sem);
+
+W9825G6KH_StatusTypeDef W9825G6KH_OS_ThreadCreate(W9825G6KH_OS_ThreadFuncTypeDef func, void *arg,
+                                                  const char *name, uint32_t stack_bytes,
+                                                  uint32_t priority);
+void* W9825G6KH_OS_CurrentThread(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_OS_H */
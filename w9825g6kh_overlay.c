@@ -0,0 +1,647 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_overlay.c
+  * @brief   Overlay manager for W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Overlays are blobs kept in SDRAM (DSP kernels, coefficient tables).
+  * The application hands over fixed fast-memory buffers as slots; Acquire
+  * makes an overlay resident in a slot and pins it, Release unpins it but
+  * leaves it resident until the slot is needed again. A slot is chosen
+  * among those large enough: an empty one first (smallest fit), otherwise
+  * the least recently acquired unpinned one.
+  *
+  * SetNext chains overlays that run in sequence: acquiring one starts
+  * loading the next into another slot. With W9825G6KH_OVERLAY_USE_DMA2D the
+  * load runs on DMA2D while the current kernel executes; Acquire of an
+  * overlay still in flight waits only for the rest of the transfer.
+  *
+  * Code overlays must be linked to run at their slot address (or be
+  * position independent); call through (address | 1) for Thumb.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_overlay.h"
+#include "w9825g6kh_os.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+/* Tightly-coupled memories DMA2D has no path to */
+#define OVERLAY_ITCM_END             0x00010000U
+#define OVERLAY_DTCM_BASE            0x20000000U
+#define OVERLAY_DTCM_END             0x20020000U
+
+/* DMA2D copies whole lines of ARGB8888 pixels; the remainder goes by CPU */
+#define OVERLAY_DMA_LINE_WORDS       256U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint8_t *Base;
+    uint32_t Size;
+    uint32_t Owner;              /* Overlay id or W9825G6KH_OVERLAY_NONE */
+    uint32_t DmaReachable;
+} W9825G6KH_Overlay_SlotTypeDef;
+
+typedef struct {
+    W9825G6KH_OverlayInfoTypeDef Info;
+    uint32_t Next;               /* Prefetched when this one is acquired */
+    uint32_t LastUse;
+    uint32_t Prefetched;         /* Loaded ahead of time, not acquired yet */
+} W9825G6KH_Overlay_EntryTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_Overlay_SlotTypeDef overlay_slots[W9825G6KH_OVERLAY_SLOTS];
+static W9825G6KH_Overlay_EntryTypeDef overlays[W9825G6KH_OVERLAY_MAX];
+static uint32_t overlay_slot_count = 0;
+static uint32_t overlay_count = 0;
+static uint32_t overlay_tick = 0;
+static W9825G6KH_OverlayStatsTypeDef overlay_stats;
+static W9825G6KH_OS_MutexTypeDef overlay_mutex = NULL;
+
+#if W9825G6KH_OVERLAY_USE_DMA2D
+static W9825G6KH_Dma2dJobTypeDef overlay_dma_job;
+static uint32_t overlay_dma_id = W9825G6KH_OVERLAY_NONE;    /* Overlay being loaded */
+static uint32_t overlay_dma_bytes = 0;
+static uint32_t overlay_dma_start = 0;
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint8_t* W9825G6KH_Overlay_SdramAddr(const W9825G6KH_Overlay_EntryTypeDef *ov)
+{
+    return (uint8_t *)(W9825G6KH_BANK_ADDR + ov->Info.Offset);
+}
+
+/**
+  * @brief  Completes a load: code fix-up and timing
+  * @note   Caller holds overlay_mutex
+  */
+static void W9825G6KH_Overlay_LoadDone(uint32_t id, uint32_t start_cycles)
+{
+    W9825G6KH_Overlay_EntryTypeDef *ov = &overlays[id];
+    uint32_t cycles = W9825G6KH_Perf_GetCycles() - start_cycles;
+
+    if ((ov->Info.Flags & W9825G6KH_OVERLAY_CODE) != 0U) {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_CleanDCache_by_Addr((uint32_t *)overlay_slots[ov->Info.Slot].Base, (int32_t)ov->Info.Size);
+#endif
+#if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+        SCB_InvalidateICache();
+#endif
+    }
+
+    overlay_stats.Loads++;
+    overlay_stats.BytesLoaded += ov->Info.Size;
+    overlay_stats.LoadCycles += cycles;
+    if (cycles > overlay_stats.MaxLoadCycles) {
+        overlay_stats.MaxLoadCycles = cycles;
+    }
+}
+
+#if W9825G6KH_OVERLAY_USE_DMA2D
+/**
+  * @brief  Completes the DMA2D load if it has finished (or always, if wait)
+  * @note   Caller holds overlay_mutex. If the load failed, or was aborted
+  *         after W9825G6KH_DMA2D_TIMEOUT_US, the CPU copies the overlay.
+  * @retval 1 if no load is in flight on return
+  */
+static uint32_t W9825G6KH_Overlay_DmaPoll(uint32_t wait)
+{
+    W9825G6KH_Overlay_EntryTypeDef *ov;
+    W9825G6KH_StatusTypeDef status;
+    uint8_t *dst;
+
+    if (overlay_dma_id == W9825G6KH_OVERLAY_NONE) {
+        return 1U;
+    }
+
+    status = W9825G6KH_Dma2d_Poll(&overlay_dma_job, wait);
+    if (status == W9825G6KH_BUSY) {
+        return 0U;
+    }
+
+    ov = &overlays[overlay_dma_id];
+    dst = overlay_slots[ov->Info.Slot].Base;
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)overlay_dma_bytes);
+#endif
+    if (status != W9825G6KH_OK) {
+        memcpy(dst, W9825G6KH_Overlay_SdramAddr(ov), overlay_dma_bytes);
+    }
+
+    W9825G6KH_Overlay_LoadDone(overlay_dma_id, overlay_dma_start);
+    overlay_dma_id = W9825G6KH_OVERLAY_NONE;
+
+    return 1U;
+}
+
+/**
+  * @brief  Starts loading an overlay into its slot on DMA2D
+  * @note   Caller holds overlay_mutex and has retired the previous job
+  * @retval 1 if started, 0 if another user is programming DMA2D
+  */
+static uint32_t W9825G6KH_Overlay_DmaStart(uint32_t id)
+{
+    W9825G6KH_Overlay_EntryTypeDef *ov = &overlays[id];
+    uint8_t *src = W9825G6KH_Overlay_SdramAddr(ov);
+    uint8_t *dst = overlay_slots[ov->Info.Slot].Base;
+    uint32_t words = ov->Info.Size / 4U;
+    uint32_t pl = (words < OVERLAY_DMA_LINE_WORDS) ? words : OVERLAY_DMA_LINE_WORDS;
+    uint32_t nl = words / pl;
+    uint32_t bytes = pl * nl * 4U;
+
+    if (W9825G6KH_Dma2d_Acquire(0U) != W9825G6KH_OK) {
+        return 0U;
+    }
+
+    overlay_dma_start = W9825G6KH_Perf_GetCycles();
+
+    /* The tail that does not fill a line is short; copy it now */
+    memcpy(dst + bytes, src + bytes, ov->Info.Size - bytes);
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* DMA2D sees memory, not the D-cache */
+    SCB_CleanDCache_by_Addr((uint32_t *)src, (int32_t)bytes);
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)bytes);
+#endif
+
+    DMA2D->CR = 0U;                                  /* Memory to memory */
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = 0U;
+    DMA2D->FGPFCCR = 0U;                             /* ARGB8888 */
+    DMA2D->OPFCCR = 0U;
+    DMA2D->OMAR = (uint32_t)dst;
+    DMA2D->OOR = 0U;
+    DMA2D->NLR = (pl << DMA2D_NLR_PL_Pos) | nl;
+
+    overlay_dma_id = id;
+    overlay_dma_bytes = bytes;
+
+    DMA2D->CR |= DMA2D_CR_START;
+    W9825G6KH_Dma2d_Release(&overlay_dma_job);
+
+    return 1U;
+}
+#endif /* W9825G6KH_OVERLAY_USE_DMA2D */
+
+static uint32_t W9825G6KH_Overlay_Loading(uint32_t id)
+{
+#if W9825G6KH_OVERLAY_USE_DMA2D
+    return (overlay_dma_id == id) ? 1U : 0U;
+#else
+    (void)id;
+    return 0U;
+#endif
+}
+
+/**
+  * @brief  Picks the slot for an overlay of the given size
+  * @note   Caller holds overlay_mutex
+  * @retval Slot index or W9825G6KH_OVERLAY_NONE
+  */
+static uint32_t W9825G6KH_Overlay_PickSlot(uint32_t size)
+{
+    uint32_t best = W9825G6KH_OVERLAY_NONE;
+    uint32_t best_empty = 0;
+    uint32_t best_use = 0;
+
+    for (uint32_t s = 0; s < overlay_slot_count; s++) {
+        W9825G6KH_Overlay_SlotTypeDef *slot = &overlay_slots[s];
+        uint32_t empty = (slot->Owner == W9825G6KH_OVERLAY_NONE) ? 1U : 0U;
+        uint32_t use = 0;
+
+        if (slot->Size < size) {
+            continue;
+        }
+        if (!empty) {
+            if (overlays[slot->Owner].Info.Refs != 0U || W9825G6KH_Overlay_Loading(slot->Owner)) {
+                continue;
+            }
+            use = overlays[slot->Owner].LastUse;
+        }
+
+        if (best == W9825G6KH_OVERLAY_NONE ||
+            (empty && !best_empty) ||
+            (empty && best_empty && slot->Size < overlay_slots[best].Size) ||
+            (!empty && !best_empty && (overlay_tick - use) > (overlay_tick - best_use))) {
+            best = s;
+            best_empty = empty;
+            best_use = use;
+        }
+    }
+
+    return best;
+}
+
+/* Caller holds overlay_mutex */
+static void W9825G6KH_Overlay_Evict(uint32_t s)
+{
+    W9825G6KH_Overlay_SlotTypeDef *slot = &overlay_slots[s];
+    W9825G6KH_Overlay_EntryTypeDef *ov = &overlays[slot->Owner];
+
+    if ((ov->Info.Flags & W9825G6KH_OVERLAY_WRITEBACK) != 0U) {
+        memcpy(W9825G6KH_Overlay_SdramAddr(ov), slot->Base, ov->Info.Size);
+        overlay_stats.WriteBacks++;
+    }
+
+    ov->Info.Slot = W9825G6KH_OVERLAY_NONE;
+    ov->Prefetched = 0;
+    slot->Owner = W9825G6KH_OVERLAY_NONE;
+    overlay_stats.Evictions++;
+}
+
+/**
+  * @brief  Makes an overlay resident; async allows a DMA2D load
+  * @note   Caller holds overlay_mutex
+  * @retval W9825G6KH_OK, or W9825G6KH_BUSY if no slot can take it
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Load(uint32_t id, uint32_t async)
+{
+    W9825G6KH_Overlay_EntryTypeDef *ov = &overlays[id];
+    uint32_t s = W9825G6KH_Overlay_PickSlot(ov->Info.Size);
+    uint32_t t0;
+
+    if (s == W9825G6KH_OVERLAY_NONE) {
+        return W9825G6KH_BUSY;
+    }
+    if (overlay_slots[s].Owner != W9825G6KH_OVERLAY_NONE) {
+        W9825G6KH_Overlay_Evict(s);
+    }
+    overlay_slots[s].Owner = id;
+    ov->Info.Slot = s;
+
+#if W9825G6KH_OVERLAY_USE_DMA2D
+    if (async && overlay_slots[s].DmaReachable && (ov->Info.Size & 3U) == 0U) {
+        (void)W9825G6KH_Overlay_DmaPoll(1U);
+        if (W9825G6KH_Overlay_DmaStart(id)) {
+            return W9825G6KH_OK;
+        }
+    }
+#else
+    (void)async;
+#endif
+
+    t0 = W9825G6KH_Perf_GetCycles();
+    memcpy(overlay_slots[s].Base, W9825G6KH_Overlay_SdramAddr(ov), ov->Info.Size);
+    W9825G6KH_Overlay_LoadDone(id, t0);
+
+    return W9825G6KH_OK;
+}
+
+/* Caller holds overlay_mutex */
+static W9825G6KH_StatusTypeDef W9825G6KH_Overlay_StartPrefetch(uint32_t id)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (overlays[id].Info.Slot != W9825G6KH_OVERLAY_NONE) {
+        return W9825G6KH_OK;
+    }
+
+    status = W9825G6KH_Overlay_Load(id, 1U);
+    if (status == W9825G6KH_OK) {
+        overlays[id].Prefetched = 1;
+        overlay_stats.Prefetches++;
+    }
+    return status;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Drops all slots and overlays; call once before use
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if no mutex could be created
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Init(void)
+{
+    if (overlay_mutex == NULL) {
+        overlay_mutex = W9825G6KH_OS_MutexCreate();
+        if (overlay_mutex == NULL) {
+            return W9825G6KH_ERROR;
+        }
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+#if W9825G6KH_OVERLAY_USE_DMA2D
+    (void)W9825G6KH_Overlay_DmaPoll(1U);
+#endif
+    memset(overlay_slots, 0, sizeof(overlay_slots));
+    memset(overlays, 0, sizeof(overlays));
+    memset(&overlay_stats, 0, sizeof(overlay_stats));
+    overlay_slot_count = 0;
+    overlay_count = 0;
+    overlay_tick = 0;
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Adds a fast-memory buffer as a slot
+  * @param  Base: Slot memory (DTCM, ITCM for code, or AXI/SRAM), 32-byte
+  *         aligned for the cache maintenance on DMA2D loads
+  * @param  Size: Slot size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_AddSlot(void *Base, uint32_t Size)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)Base;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (Base == NULL || Size == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    if (overlay_slot_count >= W9825G6KH_OVERLAY_SLOTS) {
+        status = W9825G6KH_ERROR;
+    } else {
+        W9825G6KH_Overlay_SlotTypeDef *slot = &overlay_slots[overlay_slot_count++];
+
+        slot->Base = (uint8_t *)Base;
+        slot->Size = Size;
+        slot->Owner = W9825G6KH_OVERLAY_NONE;
+        slot->DmaReachable = (addr >= OVERLAY_ITCM_END &&
+                              !(addr >= OVERLAY_DTCM_BASE && addr < OVERLAY_DTCM_END) &&
+                              (addr & 31U) == 0U) ? 1U : 0U;
+    }
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return status;
+}
+
+/**
+  * @brief  Registers a blob stored in SDRAM
+  * @param  Name: Name for Find and PrintStats (kept by reference)
+  * @param  Offset: Blob start (offset from SDRAM base)
+  * @param  Size: Blob size in bytes
+  * @param  Flags: W9825G6KH_OVERLAY_DATA / _CODE, optionally | _WRITEBACK
+  * @param  pId: Receives the overlay id
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Register(const char *Name, uint32_t Offset, uint32_t Size,
+                                                   uint32_t Flags, uint32_t *pId)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (Name == NULL || pId == NULL || Size == 0U ||
+        Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    if (overlay_count >= W9825G6KH_OVERLAY_MAX) {
+        status = W9825G6KH_ERROR;
+    } else {
+        W9825G6KH_Overlay_EntryTypeDef *ov = &overlays[overlay_count];
+
+        memset(ov, 0, sizeof(*ov));
+        ov->Info.Name = Name;
+        ov->Info.Offset = Offset;
+        ov->Info.Size = Size;
+        ov->Info.Flags = Flags;
+        ov->Info.Slot = W9825G6KH_OVERLAY_NONE;
+        ov->Next = W9825G6KH_OVERLAY_NONE;
+        *pId = overlay_count++;
+    }
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return status;
+}
+
+/**
+  * @brief  Looks up an overlay by name
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if not registered
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Find(const char *Name, uint32_t *pId)
+{
+    if (Name == NULL || pId == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < overlay_count; i++) {
+        if (strcmp(overlays[i].Info.Name, Name) == 0) {
+            *pId = i;
+            return W9825G6KH_OK;
+        }
+    }
+    return W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Sets the overlay prefetched whenever Id is acquired
+  * @param  NextId: Successor, or W9825G6KH_OVERLAY_NONE to clear
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_SetNext(uint32_t Id, uint32_t NextId)
+{
+    if (Id >= overlay_count || NextId == Id ||
+        (NextId != W9825G6KH_OVERLAY_NONE && NextId >= overlay_count)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    overlays[Id].Next = NextId;
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Makes an overlay resident and pins it until Release
+  * @param  Id: Overlay id
+  * @param  ppAddr: Receives the slot address
+  * @retval W9825G6KH_OK, W9825G6KH_BUSY if every fitting slot is pinned,
+  *         or W9825G6KH_INVALID_PARAM
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Acquire(uint32_t Id, void **ppAddr)
+{
+    W9825G6KH_Overlay_EntryTypeDef *ov;
+    uint32_t t0;
+
+    if (Id >= overlay_count || ppAddr == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    ov = &overlays[Id];
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+
+    overlay_stats.Acquires++;
+    ov->Info.Acquires++;
+    t0 = W9825G6KH_Perf_GetCycles();
+
+    if (ov->Info.Slot != W9825G6KH_OVERLAY_NONE) {
+#if W9825G6KH_OVERLAY_USE_DMA2D
+        if (overlay_dma_id == Id) {
+            (void)W9825G6KH_Overlay_DmaPoll(1U);
+            overlay_stats.StallCycles += W9825G6KH_Perf_GetCycles() - t0;
+        }
+#endif
+        if (ov->Prefetched) {
+            overlay_stats.PrefetchHits++;
+        }
+        overlay_stats.Hits++;
+        ov->Info.Hits++;
+    } else {
+        overlay_stats.Misses++;
+        if (W9825G6KH_Overlay_Load(Id, 0U) != W9825G6KH_OK) {
+            overlay_stats.Refused++;
+            W9825G6KH_OS_MutexUnlock(overlay_mutex);
+            return W9825G6KH_BUSY;
+        }
+        overlay_stats.StallCycles += W9825G6KH_Perf_GetCycles() - t0;
+    }
+
+    ov->Prefetched = 0;
+    ov->Info.Refs++;
+    ov->LastUse = ++overlay_tick;
+    *ppAddr = overlay_slots[ov->Info.Slot].Base;
+
+    if (ov->Next != W9825G6KH_OVERLAY_NONE) {
+        (void)W9825G6KH_Overlay_StartPrefetch(ov->Next);
+    }
+
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Unpins an overlay; it stays resident until its slot is reused
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if it was not acquired
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Release(uint32_t Id)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (Id >= overlay_count) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    if (overlays[Id].Info.Refs == 0U) {
+        status = W9825G6KH_ERROR;
+    } else {
+        overlays[Id].Info.Refs--;
+    }
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return status;
+}
+
+/**
+  * @brief  Starts loading an overlay ahead of its Acquire
+  * @note   Returns once the DMA2D job is started; without DMA2D (or for
+  *         TCM slots) the CPU copies it before returning
+  * @retval W9825G6KH_OK, or W9825G6KH_BUSY if no slot can take it
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Prefetch(uint32_t Id)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (Id >= overlay_count) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    status = W9825G6KH_Overlay_StartPrefetch(Id);
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return status;
+}
+
+/**
+  * @brief  Retires a finished DMA2D load; call from the main loop or idle
+  *         task so load times are measured close to completion
+  * @retval None
+  */
+void W9825G6KH_Overlay_Poll(void)
+{
+#if W9825G6KH_OVERLAY_USE_DMA2D
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    (void)W9825G6KH_Overlay_DmaPoll(0U);
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+#endif
+}
+
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_GetInfo(uint32_t Id, W9825G6KH_OverlayInfoTypeDef *info)
+{
+    if (Id >= overlay_count || info == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    *info = overlays[Id].Info;
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+
+    return W9825G6KH_OK;
+}
+
+void W9825G6KH_Overlay_GetStats(W9825G6KH_OverlayStatsTypeDef *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    *stats = overlay_stats;
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+}
+
+void W9825G6KH_Overlay_ResetStats(void)
+{
+    W9825G6KH_OS_MutexLock(overlay_mutex);
+    memset(&overlay_stats, 0, sizeof(overlay_stats));
+    for (uint32_t i = 0; i < overlay_count; i++) {
+        overlays[i].Info.Acquires = 0;
+        overlays[i].Info.Hits = 0;
+    }
+    W9825G6KH_OS_MutexUnlock(overlay_mutex);
+}
+
+/**
+  * @brief  Prints hit rates and load times
+  * @retval None
+  */
+void W9825G6KH_Overlay_PrintStats(void)
+{
+    W9825G6KH_OverlayStatsTypeDef s;
+    W9825G6KH_OverlayInfoTypeDef info;
+
+    W9825G6KH_Overlay_GetStats(&s);
+
+    printf("\r\n=== SDRAM Overlays ===\r\n");
+    printf("Acquires: %lu, hits: %lu (%lu%%), prefetch hits: %lu, misses: %lu, refused: %lu\r\n",
+           (unsigned long)s.Acquires, (unsigned long)s.Hits,
+           (unsigned long)(s.Acquires ? (uint32_t)((uint64_t)s.Hits * 100U / s.Acquires) : 0U),
+           (unsigned long)s.PrefetchHits, (unsigned long)s.Misses, (unsigned long)s.Refused);
+    printf("Loads: %lu (%lu bytes), avg %lu cycles, max %lu cycles, stalled %lu cycles\r\n",
+           (unsigned long)s.Loads, (unsigned long)s.BytesLoaded,
+           (unsigned long)(s.Loads ? s.LoadCycles / s.Loads : 0U),
+           (unsigned long)s.MaxLoadCycles, (unsigned long)s.StallCycles);
+    printf("Prefetches: %lu, evictions: %lu, write-backs: %lu\r\n",
+           (unsigned long)s.Prefetches, (unsigned long)s.Evictions, (unsigned long)s.WriteBacks);
+
+    printf("%-16s %8s %8s %8s %5s %5s\r\n", "Overlay", "Size", "Acquire", "Hit%", "Slot", "Refs");
+    for (uint32_t i = 0; i < overlay_count; i++) {
+        if (W9825G6KH_Overlay_GetInfo(i, &info) != W9825G6KH_OK) {
+            continue;
+        }
+        printf("%-16s %8lu %8lu %8lu ", info.Name, (unsigned long)info.Size, (unsigned long)info.Acquires,
+               (unsigned long)(info.Acquires ? (uint32_t)((uint64_t)info.Hits * 100U / info.Acquires) : 0U));
+        if (info.Slot == W9825G6KH_OVERLAY_NONE) {
+            printf("%5s %5lu\r\n", "-", (unsigned long)info.Refs);
+        } else {
+            printf("%5lu %5lu\r\n", (unsigned long)info.Slot, (unsigned long)info.Refs);
+        }
+    }
+}
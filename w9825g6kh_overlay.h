@@ -0,0 +1,101 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_overlay.h
+  * @brief   Overlay manager: pages code and data blobs stored in W9825G6KH
+  *          SDRAM into fixed TCM / AXI SRAM slots on demand
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_OVERLAY_H
+#define __W9825G6KH_OVERLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef W9825G6KH_OVERLAY_MAX
+#define W9825G6KH_OVERLAY_MAX            32U
+#endif
+
+#ifndef W9825G6KH_OVERLAY_SLOTS
+#define W9825G6KH_OVERLAY_SLOTS          8U
+#endif
+
+/* 1: loads into AXI/SRAM slots run on DMA2D (memory-to-memory), so
+ * Prefetch returns at once. DMA2D cannot reach DTCM/ITCM; those slots are
+ * always filled by the CPU, as is a load that finds DMA2D taken by another
+ * user (W9825G6KH_Dma2d_Acquire) or that fails or overruns
+ * W9825G6KH_DMA2D_TIMEOUT_US. */
+#ifndef W9825G6KH_OVERLAY_USE_DMA2D
+#define W9825G6KH_OVERLAY_USE_DMA2D      0
+#endif
+
+#define W9825G6KH_OVERLAY_NONE           0xFFFFFFFFU
+
+/* Register() flags */
+#define W9825G6KH_OVERLAY_DATA           0x00U
+#define W9825G6KH_OVERLAY_CODE           0x01U    /* I-cache invalidated after a load */
+#define W9825G6KH_OVERLAY_WRITEBACK      0x02U    /* Copied back to SDRAM when evicted */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t Acquires;
+    uint32_t Hits;               /* Already resident */
+    uint32_t PrefetchHits;       /* Resident or in flight thanks to a prefetch */
+    uint32_t Misses;             /* Loaded synchronously by Acquire */
+    uint32_t Prefetches;         /* Loads started by Prefetch or the Next chain */
+    uint32_t Evictions;
+    uint32_t WriteBacks;
+    uint32_t Refused;            /* Acquire found no slot (all pinned or too small) */
+    uint32_t BytesLoaded;
+    uint32_t LoadCycles;         /* Sum over completed loads, start to finish */
+    uint32_t MaxLoadCycles;
+    uint32_t StallCycles;        /* Time Acquire spent waiting for loads */
+    uint32_t Loads;
+} W9825G6KH_OverlayStatsTypeDef;
+
+typedef struct {
+    const char *Name;
+    uint32_t Offset;             /* Blob in SDRAM (offset from base) */
+    uint32_t Size;
+    uint32_t Flags;
+    uint32_t Slot;               /* W9825G6KH_OVERLAY_NONE when not resident */
+    uint32_t Refs;
+    uint32_t Acquires;
+    uint32_t Hits;
+} W9825G6KH_OverlayInfoTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Init(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_AddSlot(void *Base, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Register(const char *Name, uint32_t Offset, uint32_t Size,
+                                                   uint32_t Flags, uint32_t *pId);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Find(const char *Name, uint32_t *pId);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_SetNext(uint32_t Id, uint32_t NextId);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Acquire(uint32_t Id, void **ppAddr);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Release(uint32_t Id);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_Prefetch(uint32_t Id);
+void W9825G6KH_Overlay_Poll(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Overlay_GetInfo(uint32_t Id, W9825G6KH_OverlayInfoTypeDef *info);
+void W9825G6KH_Overlay_GetStats(W9825G6KH_OverlayStatsTypeDef *stats);
+void W9825G6KH_Overlay_ResetStats(void);
+void W9825G6KH_Overlay_PrintStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_OVERLAY_H */
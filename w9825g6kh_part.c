@@ -0,0 +1,355 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_part.c
+  * @brief   Compile-time SDRAM partition map for W9825G6KH: layout checks,
+  *          runtime registry and per-partition traffic accounting
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * The layout itself is the per-bank structs in w9825g6kh_part.h;
+  * this file rejects a bad table at compile time and keeps the counters.
+  *
+  * Traffic through the checked driver API is attributed automatically via
+  * an access hook. DMA and direct-pointer traffic is not seen by the driver;
+  * report it with W9825G6KH_Part_Account so the bandwidth figures cover it.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_part.h"
+#include "w9825g6kh_atomic.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Compile-time checks -------------------------------------------------------*/
+#define W9825G6KH_PART_CHECK_(name, size, align, bank, cache)                                          \
+    _Static_assert((size) > 0U, "SDRAM partition " #name ": size is zero");                            \
+    _Static_assert((align) != 0U && ((align) & ((align) - 1U)) == 0U,                                  \
+                   "SDRAM partition " #name ": alignment must be a power of two");                     \
+    _Static_assert((bank) == W9825G6KH_PART_BANK_ANY || (bank) < W9825G6KH_BANK_COUNT,                 \
+                   "SDRAM partition " #name ": no such bank");                                         \
+    _Static_assert((bank) == W9825G6KH_PART_BANK_ANY ||                                                \
+                   (W9825G6KH_ADDR_TO_BANK(W9825G6KH_PART_OFFSET(name)) == (bank) &&                   \
+                    W9825G6KH_ADDR_TO_BANK(W9825G6KH_PART_END(name) - 1U) == (bank)),                  \
+                   "SDRAM partition " #name ": does not fit in its preferred bank");                   \
+    _Static_assert(W9825G6KH_PART_HOME(bank) == 0U ||                                                  \
+                   W9825G6KH_PART_OFFSET(name) >= sizeof(W9825G6KH_PartBank0TypeDef),                  \
+                   "SDRAM partition " #name ": bank 0 and unbanked partitions run into its bank");     \
+    _Static_assert(W9825G6KH_PART_END(name) <= W9825G6KH_PART_LIMIT,                                   \
+                   "SDRAM partition " #name ": past the end of SDRAM or into the flight recorder");    \
+    _Static_assert((cache) <= W9825G6KH_PART_CACHE_NC, "SDRAM partition " #name ": bad cache policy"); \
+    _Static_assert((cache) == W9825G6KH_PART_CACHE_DEFAULT ||                                          \
+                   (W9825G6KH_PART_SIZE(name) >= 32U &&                                                \
+                    (W9825G6KH_PART_SIZE(name) & (W9825G6KH_PART_SIZE(name) - 1U)) == 0U &&            \
+                    (W9825G6KH_PART_OFFSET(name) & (W9825G6KH_PART_SIZE(name) - 1U)) == 0U),           \
+                   "SDRAM partition " #name ": a cache policy needs a power-of-two size aligned to itself");
+
+W9825G6KH_PARTITIONS(W9825G6KH_PART_CHECK_)
+
+#define W9825G6KH_PART_MPU_COUNT_(name, size, align, bank, cache) \
+    + (((cache) != W9825G6KH_PART_CACHE_DEFAULT) ? 1 : 0)
+
+_Static_assert(W9825G6KH_PART_MPU_REGION_BASE + (0 W9825G6KH_PARTITIONS(W9825G6KH_PART_MPU_COUNT_)) <= 16U,
+               "SDRAM partitions: more cache policies than free MPU regions");
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    W9825G6KH_Counter64TypeDef ReadBytes;
+    W9825G6KH_Counter64TypeDef WriteBytes;
+    volatile uint32_t Reads;
+    volatile uint32_t Writes;
+    volatile uint32_t UsedBytes;
+    volatile uint32_t PeakUsedBytes;
+} W9825G6KH_Part_CountersTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+#define W9825G6KH_PART_INFO_(name, size, align, bank, cache) \
+    { #name, W9825G6KH_PART_OFFSET(name), W9825G6KH_PART_SIZE(name), W9825G6KH_PART_ALIGN(align, bank), (bank), (cache) },
+
+static const W9825G6KH_PartInfoTypeDef part_table[W9825G6KH_PART_COUNT] = {
+    W9825G6KH_PARTITIONS(W9825G6KH_PART_INFO_)
+};
+
+/* Last entry: traffic outside every partition */
+static W9825G6KH_Part_CountersTypeDef part_counters[W9825G6KH_PART_COUNT + 1];
+static uint32_t part_start_tick = 0;
+
+static const char * const part_cache_names[] = { "default", "WB", "WT", "NC" };
+
+/* Private functions ---------------------------------------------------------*/
+
+static void W9825G6KH_Part_Count(uint32_t id, uint32_t bytes, uint32_t access)
+{
+    W9825G6KH_Part_CountersTypeDef *c = &part_counters[id];
+
+    if (access == W9825G6KH_ACCESS_WRITE) {
+        W9825G6KH_AtomicAdd64(&c->WriteBytes, bytes);
+        (void)W9825G6KH_AtomicAdd32(&c->Writes, 1U);
+    } else {
+        W9825G6KH_AtomicAdd64(&c->ReadBytes, bytes);
+        (void)W9825G6KH_AtomicAdd32(&c->Reads, 1U);
+    }
+}
+
+static uint32_t W9825G6KH_Part_KBps(uint64_t bytes, uint32_t ms)
+{
+    return (ms != 0U) ? (uint32_t)((bytes * 1000U) / ((uint64_t)ms * 1024U)) : 0U;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Clears the counters and starts attributing driver traffic
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Part_Init(void)
+{
+    memset(part_counters, 0, sizeof(part_counters));
+    part_start_tick = HAL_GetTick();
+
+    return W9825G6KH_RegisterAccessHook(W9825G6KH_Part_Account);
+}
+
+/**
+  * @brief  Returns a partition's placement
+  * @param  Id: W9825G6KH_PART_ID(NAME) or 0 .. W9825G6KH_PART_COUNT - 1
+  * @retval Entry, or NULL
+  */
+const W9825G6KH_PartInfoTypeDef* W9825G6KH_Part_Get(uint32_t Id)
+{
+    return (Id < W9825G6KH_PART_COUNT) ? &part_table[Id] : NULL;
+}
+
+/**
+  * @brief  Looks a partition up by name
+  * @retval Id, or W9825G6KH_PART_NONE
+  */
+uint32_t W9825G6KH_Part_Find(const char *Name)
+{
+    if (Name != NULL) {
+        for (uint32_t i = 0; i < W9825G6KH_PART_COUNT; i++) {
+            if (strcmp(part_table[i].Name, Name) == 0) {
+                return i;
+            }
+        }
+    }
+
+    return W9825G6KH_PART_NONE;
+}
+
+/**
+  * @brief  Finds the partition holding an SDRAM offset
+  * @retval Id, or W9825G6KH_PART_NONE
+  */
+uint32_t W9825G6KH_Part_Lookup(uint32_t Offset)
+{
+    /* Table order is address order only within a bank */
+    for (uint32_t i = 0; i < W9825G6KH_PART_COUNT; i++) {
+        if (Offset >= part_table[i].Offset && Offset - part_table[i].Offset < part_table[i].Size) {
+            return i;
+        }
+    }
+
+    return W9825G6KH_PART_NONE;
+}
+
+/**
+  * @brief  Attributes an access to the partitions it touches
+  * @note   Registered as a driver access hook by Init; call it directly for
+  *         DMA and direct-pointer traffic. Safe from any context.
+  * @param  Offset: Start (offset from SDRAM base)
+  * @param  Size: Bytes
+  * @param  Access: W9825G6KH_ACCESS_READ or W9825G6KH_ACCESS_WRITE
+  * @retval None
+  */
+void W9825G6KH_Part_Account(uint32_t Offset, uint32_t Size, uint32_t Access)
+{
+    uint32_t counted = 0;
+    uint32_t end;
+
+    if (Offset >= W9825G6KH_SIZE_BYTES || Size == 0U) {
+        return;
+    }
+    end = (Size > W9825G6KH_SIZE_BYTES - Offset) ? W9825G6KH_SIZE_BYTES : Offset + Size;
+
+    for (uint32_t i = 0; i < W9825G6KH_PART_COUNT; i++) {
+        uint32_t start = part_table[i].Offset;
+        uint32_t stop = start + part_table[i].Size;
+
+        if (start < end && stop > Offset) {
+            uint32_t bytes = ((stop < end) ? stop : end) - ((start > Offset) ? start : Offset);
+
+            W9825G6KH_Part_Count(i, bytes, Access);
+            counted += bytes;
+        }
+    }
+
+    if (counted < end - Offset) {
+        W9825G6KH_Part_Count(W9825G6KH_PART_COUNT, end - Offset - counted, Access);
+    }
+}
+
+/**
+  * @brief  Records how much of a partition its owner is using
+  * @param  Id: Partition
+  * @param  Bytes: Bytes in use (at most the partition size)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Part_SetUsed(uint32_t Id, uint32_t Bytes)
+{
+    if (Id >= W9825G6KH_PART_COUNT || Bytes > part_table[Id].Size) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_AtomicStore32(&part_counters[Id].UsedBytes, Bytes);
+    W9825G6KH_AtomicMax32(&part_counters[Id].PeakUsedBytes, Bytes);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Reads a partition's counters
+  * @param  Id: Partition, or W9825G6KH_PART_COUNT for traffic outside all
+  *         partitions
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Part_GetStats(uint32_t Id, W9825G6KH_PartStatsTypeDef *stats)
+{
+    W9825G6KH_Part_CountersTypeDef *c;
+    uint32_t ms;
+
+    if (Id > W9825G6KH_PART_COUNT || stats == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    c = &part_counters[Id];
+
+    stats->ReadBytes = W9825G6KH_AtomicLoad64(&c->ReadBytes);
+    stats->WriteBytes = W9825G6KH_AtomicLoad64(&c->WriteBytes);
+    stats->Reads = W9825G6KH_AtomicLoad32(&c->Reads);
+    stats->Writes = W9825G6KH_AtomicLoad32(&c->Writes);
+    stats->UsedBytes = W9825G6KH_AtomicLoad32(&c->UsedBytes);
+    stats->PeakUsedBytes = W9825G6KH_AtomicLoad32(&c->PeakUsedBytes);
+
+    ms = HAL_GetTick() - part_start_tick;
+    stats->ReadKBps = W9825G6KH_Part_KBps(stats->ReadBytes, ms);
+    stats->WriteKBps = W9825G6KH_Part_KBps(stats->WriteBytes, ms);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Clears the traffic counters and restarts the bandwidth window;
+  *         used bytes are kept, the peaks restart from them
+  */
+void W9825G6KH_Part_ResetStats(void)
+{
+    for (uint32_t i = 0; i <= W9825G6KH_PART_COUNT; i++) {
+        W9825G6KH_Part_CountersTypeDef *c = &part_counters[i];
+
+        W9825G6KH_AtomicStore64(&c->ReadBytes, 0U);
+        W9825G6KH_AtomicStore64(&c->WriteBytes, 0U);
+        W9825G6KH_AtomicStore32(&c->Reads, 0U);
+        W9825G6KH_AtomicStore32(&c->Writes, 0U);
+        W9825G6KH_AtomicStore32(&c->PeakUsedBytes, W9825G6KH_AtomicLoad32(&c->UsedBytes));
+    }
+    part_start_tick = HAL_GetTick();
+}
+
+/**
+  * @brief  Programs one MPU region per partition with a cache policy
+  * @note   Regions W9825G6KH_PART_MPU_REGION_BASE upwards are overwritten.
+  *         Higher-numbered regions win, so these override a background
+  *         region covering all of SDRAM set up with a lower number.
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Part_ApplyCachePolicy(void)
+{
+    MPU_Region_InitTypeDef region = {0};
+    uint32_t number = W9825G6KH_PART_MPU_REGION_BASE;
+
+    HAL_MPU_Disable();
+
+    for (uint32_t i = 0; i < W9825G6KH_PART_COUNT; i++) {
+        const W9825G6KH_PartInfoTypeDef *p = &part_table[i];
+
+        if (p->Cache == W9825G6KH_PART_CACHE_DEFAULT) {
+            continue;
+        }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        /* Nothing dirty may be left behind under the old attributes */
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(W9825G6KH_BANK_ADDR + p->Offset), (int32_t)p->Size);
+#endif
+
+        region.Enable = MPU_REGION_ENABLE;
+        region.Number = number++;
+        region.BaseAddress = W9825G6KH_BANK_ADDR + p->Offset;
+        region.Size = (uint8_t)(__builtin_ctz(p->Size) - 1);   /* MPU_REGION_SIZE_x encoding */
+        region.SubRegionDisable = 0x00;
+        region.AccessPermission = MPU_REGION_FULL_ACCESS;
+        region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+        region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+
+        switch (p->Cache) {
+            case W9825G6KH_PART_CACHE_WB:
+                region.TypeExtField = MPU_TEX_LEVEL1;
+                region.IsCacheable = MPU_ACCESS_CACHEABLE;
+                region.IsBufferable = MPU_ACCESS_BUFFERABLE;
+                break;
+            case W9825G6KH_PART_CACHE_WT:
+                region.TypeExtField = MPU_TEX_LEVEL0;
+                region.IsCacheable = MPU_ACCESS_CACHEABLE;
+                region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+                break;
+            default:
+                region.TypeExtField = MPU_TEX_LEVEL1;
+                region.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+                region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+                break;
+        }
+
+        HAL_MPU_ConfigRegion(&region);
+    }
+
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Prints the partition map with usage and bandwidth
+  */
+void W9825G6KH_Part_PrintMap(void)
+{
+    W9825G6KH_PartStatsTypeDef s;
+    uint32_t last = 0;
+
+    printf("\r\n=== SDRAM Partitions (limit 0x%08lX) ===\r\n", (unsigned long)W9825G6KH_PART_LIMIT);
+    printf("%-16s %10s %10s %4s %7s %10s %10s %10s %10s\r\n",
+           "Name", "Offset", "Size", "Bank", "Cache", "Used", "Peak", "Rd KB/s", "Wr KB/s");
+
+    for (uint32_t i = 0; i < W9825G6KH_PART_COUNT; i++) {
+        const W9825G6KH_PartInfoTypeDef *p = &part_table[i];
+
+        (void)W9825G6KH_Part_GetStats(i, &s);
+        printf("%-16s 0x%08lX %10lu %4lu %7s %10lu %10lu %10lu %10lu\r\n",
+               p->Name, (unsigned long)p->Offset, (unsigned long)p->Size,
+               (unsigned long)W9825G6KH_ADDR_TO_BANK(p->Offset),
+               part_cache_names[p->Cache], (unsigned long)s.UsedBytes, (unsigned long)s.PeakUsedBytes,
+               (unsigned long)s.ReadKBps, (unsigned long)s.WriteKBps);
+        if (p->Offset + p->Size > last) {
+            last = p->Offset + p->Size;
+        }
+    }
+
+    (void)W9825G6KH_Part_GetStats(W9825G6KH_PART_COUNT, &s);
+    printf("%-16s 0x%08lX %10lu %4s %7s %10s %10s %10lu %10lu\r\n",
+           "(unpartitioned)", (unsigned long)last, (unsigned long)(W9825G6KH_PART_LIMIT - last),
+           "-", "-", "-", "-", (unsigned long)s.ReadKBps, (unsigned long)s.WriteKBps);
+}
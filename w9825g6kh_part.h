@@ -0,0 +1,182 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_part.h
+  * @brief   Compile-time SDRAM partition map for W9825G6KH with per-partition
+  *          traffic accounting
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Partitions are declared once, in W9825G6KH_PARTITIONS, and laid out by
+  * the compiler as the members of one layout struct per internal bank
+  * (W9825G6KH_PartBank0TypeDef .. 3): in table order, each on its
+  * alignment, never overlapping. A partition with a preferred bank is a
+  * member of that bank's struct, placed from the bank's 8 MB boundary;
+  * the others share bank 0's struct from offset 0. The layout is checked
+  * with static assertions in w9825g6kh_part.c (fits below the flight
+  * recorder, inside its bank, alignments and MPU-able cache policies).
+  *
+  * Use W9825G6KH_PART_OFFSET(NAME) / W9825G6KH_PART_SIZE(NAME) instead of
+  * hard-coded offsets. To add partitions, define W9825G6KH_PARTITIONS in
+  * main.h (keep the SELFTEST entries, fmc.c uses them), e.g.:
+  *
+  *   #define W9825G6KH_PARTITIONS(P) \
+  *       P(SELFTEST,     4096U,   512U,        W9825G6KH_PART_BANK_ANY, W9825G6KH_PART_CACHE_DEFAULT) \
+  *       P(SELFTEST_EXT, 4096U,   0x100000U,   W9825G6KH_PART_BANK_ANY, W9825G6KH_PART_CACHE_DEFAULT) \
+  *       P(FRAMEBUF,     0x96000U, 512U,       0U,                      W9825G6KH_PART_CACHE_DEFAULT) \
+  *       P(CAMERA,       0x96000U, 512U,       2U,                      W9825G6KH_PART_CACHE_DEFAULT) \
+  *       P(DMABUF,       0x10000U, 0x10000U,   W9825G6KH_PART_BANK_ANY, W9825G6KH_PART_CACHE_NC)
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_PART_H
+#define __W9825G6KH_PART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include "w9825g6kh_flight.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Preferred bank: the internal bank holding the whole partition. The FMC
+ * maps addresses bank-row-column, so bank n is the 8 MB block from
+ * n * W9825G6KH_BANK_SIZE_BYTES; streaming partitions in different banks
+ * keep their rows open side by side instead of reopening rows in one. */
+#define W9825G6KH_PART_BANK_ANY          0xFFU
+
+/* Cache policy, applied by W9825G6KH_Part_ApplyCachePolicy as MPU regions.
+ * Anything but DEFAULT needs a power-of-two size, at least 32 bytes, and
+ * an offset aligned to the size. */
+#define W9825G6KH_PART_CACHE_DEFAULT     0U      /* Left to the application's MPU setup */
+#define W9825G6KH_PART_CACHE_WB          1U      /* Write-back, read/write allocate */
+#define W9825G6KH_PART_CACHE_WT          2U      /* Write-through, no write allocate */
+#define W9825G6KH_PART_CACHE_NC          3U      /* Normal memory, not cached (DMA buffers) */
+
+/* Partitions never end above this offset */
+#ifndef W9825G6KH_PART_LIMIT
+#define W9825G6KH_PART_LIMIT             W9825G6KH_FLIGHT_OFFSET
+#endif
+
+/* First MPU region number used for partitions with a cache policy */
+#ifndef W9825G6KH_PART_MPU_REGION_BASE
+#define W9825G6KH_PART_MPU_REGION_BASE   8U
+#endif
+
+/* P(NAME, Size, Align, Bank, Cache); sizes are rounded up to whole pages
+ * and every partition starts on at least a page boundary */
+#ifndef W9825G6KH_PARTITIONS
+#define W9825G6KH_PARTITIONS(P) \
+    P(SELFTEST,     4096U, W9825G6KH_PAGE_SIZE_BYTES, W9825G6KH_PART_BANK_ANY, W9825G6KH_PART_CACHE_DEFAULT) \
+    P(SELFTEST_EXT, 4096U, 0x00100000U,               W9825G6KH_PART_BANK_ANY, W9825G6KH_PART_CACHE_DEFAULT)
+#endif
+
+#define W9825G6KH_PART_NONE              0xFFFFFFFFU
+
+/* Layout helpers; a row is one 512-byte page of a bank */
+#define W9825G6KH_PART_ROW_BYTES         W9825G6KH_PAGE_SIZE_BYTES
+#define W9825G6KH_PART_ROUND(size)       (((size) + W9825G6KH_PAGE_SIZE_BYTES - 1U) & ~(W9825G6KH_PAGE_SIZE_BYTES - 1U))
+#define W9825G6KH_PART_MAX(a, b)         (((a) > (b)) ? (a) : (b))
+#define W9825G6KH_PART_HOME(bank)        (((bank) == W9825G6KH_PART_BANK_ANY) ? 0U : (bank))
+#define W9825G6KH_PART_ALIGN(align, bank) W9825G6KH_PART_MAX((align), W9825G6KH_PART_ROW_BYTES)
+
+#if W9825G6KH_BANK_COUNT != 4U
+#error "w9825g6kh_part.h lays out exactly four banks"
+#endif
+
+#ifdef __cplusplus
+#define W9825G6KH_PART_ALIGNAS(a)        alignas(a)
+#else
+#define W9825G6KH_PART_ALIGNAS(a)        _Alignas(a)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Every bank struct has a member per partition: the partition itself in
+ * its home bank, an empty array (GCC/Clang/armclang extension) in the
+ * others, so each bank's layout starts at its own boundary */
+#define W9825G6KH_PART_SLOT_(b, name, size, align, bank) \
+    W9825G6KH_PART_ALIGNAS((W9825G6KH_PART_HOME(bank) == (b)) ? W9825G6KH_PART_ALIGN(align, bank) : 1U) \
+    uint8_t name[(W9825G6KH_PART_HOME(bank) == (b)) ? W9825G6KH_PART_ROUND(size) : 0U];
+#define W9825G6KH_PART_MEMBER0_(name, size, align, bank, cache) W9825G6KH_PART_SLOT_(0U, name, size, align, bank)
+#define W9825G6KH_PART_MEMBER1_(name, size, align, bank, cache) W9825G6KH_PART_SLOT_(1U, name, size, align, bank)
+#define W9825G6KH_PART_MEMBER2_(name, size, align, bank, cache) W9825G6KH_PART_SLOT_(2U, name, size, align, bank)
+#define W9825G6KH_PART_MEMBER3_(name, size, align, bank, cache) W9825G6KH_PART_SLOT_(3U, name, size, align, bank)
+#define W9825G6KH_PART_ID_(name, size, align, bank, cache) \
+    W9825G6KH_PART_ID_##name,
+#define W9825G6KH_PART_CONST_(name, size, align, bank, cache) \
+    W9825G6KH_PART_HOME_##name = W9825G6KH_PART_HOME(bank), \
+    W9825G6KH_PART_SIZE_##name = W9825G6KH_PART_ROUND(size),
+
+typedef struct { W9825G6KH_PARTITIONS(W9825G6KH_PART_MEMBER0_) } W9825G6KH_PartBank0TypeDef;
+typedef struct { W9825G6KH_PARTITIONS(W9825G6KH_PART_MEMBER1_) } W9825G6KH_PartBank1TypeDef;
+typedef struct { W9825G6KH_PARTITIONS(W9825G6KH_PART_MEMBER2_) } W9825G6KH_PartBank2TypeDef;
+typedef struct { W9825G6KH_PARTITIONS(W9825G6KH_PART_MEMBER3_) } W9825G6KH_PartBank3TypeDef;
+
+enum {
+    W9825G6KH_PARTITIONS(W9825G6KH_PART_ID_)
+    W9825G6KH_PART_COUNT
+};
+
+enum {
+    W9825G6KH_PARTITIONS(W9825G6KH_PART_CONST_)
+    W9825G6KH_PART_CONST_END_
+};
+
+/* Compile-time placement of a partition */
+#define W9825G6KH_PART_OFFSET(name) \
+    ((uint32_t)W9825G6KH_PART_HOME_##name * W9825G6KH_BANK_SIZE_BYTES + \
+     (uint32_t)((W9825G6KH_PART_HOME_##name == 0) ? offsetof(W9825G6KH_PartBank0TypeDef, name) : \
+                (W9825G6KH_PART_HOME_##name == 1) ? offsetof(W9825G6KH_PartBank1TypeDef, name) : \
+                (W9825G6KH_PART_HOME_##name == 2) ? offsetof(W9825G6KH_PartBank2TypeDef, name) : \
+                                                    offsetof(W9825G6KH_PartBank3TypeDef, name)))
+#define W9825G6KH_PART_SIZE(name)        ((uint32_t)W9825G6KH_PART_SIZE_##name)
+#define W9825G6KH_PART_END(name)         (W9825G6KH_PART_OFFSET(name) + W9825G6KH_PART_SIZE(name))
+#define W9825G6KH_PART_PTR(name)         ((void *)(W9825G6KH_BANK_ADDR + W9825G6KH_PART_OFFSET(name)))
+#define W9825G6KH_PART_ID(name)          ((uint32_t)W9825G6KH_PART_ID_##name)
+
+typedef struct {
+    const char *Name;
+    uint32_t Offset;
+    uint32_t Size;
+    uint32_t Align;
+    uint32_t Bank;               /* W9825G6KH_PART_BANK_ANY or 0 .. 3 */
+    uint32_t Cache;              /* W9825G6KH_PART_CACHE_x */
+} W9825G6KH_PartInfoTypeDef;
+
+typedef struct {
+    uint64_t ReadBytes;
+    uint64_t WriteBytes;
+    uint32_t Reads;              /* Accesses seen */
+    uint32_t Writes;
+    uint32_t UsedBytes;          /* Reported by the owner (W9825G6KH_Part_SetUsed) */
+    uint32_t PeakUsedBytes;
+    uint32_t ReadKBps;           /* Averages since ResetStats */
+    uint32_t WriteKBps;
+} W9825G6KH_PartStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Part_Init(void);
+const W9825G6KH_PartInfoTypeDef* W9825G6KH_Part_Get(uint32_t Id);
+uint32_t W9825G6KH_Part_Find(const char *Name);
+uint32_t W9825G6KH_Part_Lookup(uint32_t Offset);
+void W9825G6KH_Part_Account(uint32_t Offset, uint32_t Size, uint32_t Access);
+W9825G6KH_StatusTypeDef W9825G6KH_Part_SetUsed(uint32_t Id, uint32_t Bytes);
+W9825G6KH_StatusTypeDef W9825G6KH_Part_GetStats(uint32_t Id, W9825G6KH_PartStatsTypeDef *stats);
+void W9825G6KH_Part_ResetStats(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Part_ApplyCachePolicy(void);
+void W9825G6KH_Part_PrintMap(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_PART_H */
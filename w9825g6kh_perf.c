@@ -0,0 +1,166 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_perf.c
+  * @brief   Per-API call counters and log2 latency histograms for the
+  *          W9825G6KH driver
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Counters are updated with LDREX/STREX atomics only, so recording is
+  * lock-free and may be done from any interrupt priority. A snapshot taken
+  * while calls are in flight is consistent per field, not across fields.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_perf.h"
+#include "w9825g6kh_atomic.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    volatile uint32_t Calls;
+    W9825G6KH_Counter64TypeDef Bytes;
+    W9825G6KH_Counter64TypeDef TotalCycles;
+    volatile uint32_t MinCycles;
+    volatile uint32_t MaxCycles;
+    volatile uint32_t Histogram[W9825G6KH_PERF_HIST_BINS];
+} W9825G6KH_PerfSlotTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_PerfSlotTypeDef perf_slots[W9825G6KH_PERF_API_COUNT];
+
+static const char* const perf_api_names[W9825G6KH_PERF_API_COUNT] = {
+    "Write", "Read", "Fill", "MemoryTest", "SendCommand"
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint32_t W9825G6KH_Perf_Log2(uint32_t value)
+{
+    return (value == 0U) ? 0U : (31U - (uint32_t)__builtin_clz(value));
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Enables the DWT cycle counter and clears all counters
+  * @note   CYCCNT is shared with RTOS profilers and application timing:
+  *         it is only switched on if needed, never reset
+  */
+void W9825G6KH_Perf_Init(void)
+{
+    if ((CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) == 0U) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    }
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    W9825G6KH_Perf_Reset();
+}
+
+/**
+  * @brief  Records one completed call
+  * @param  api: Entry point the call belongs to
+  * @param  bytes: Bytes transferred by the call
+  * @param  start_cycles: W9825G6KH_Perf_GetCycles() taken at call entry
+  */
+void W9825G6KH_Perf_Record(W9825G6KH_PerfApiTypeDef api, uint32_t bytes, uint32_t start_cycles)
+{
+    W9825G6KH_PerfSlotTypeDef *slot;
+    uint32_t cycles = W9825G6KH_Perf_GetCycles() - start_cycles;
+
+    if ((uint32_t)api >= W9825G6KH_PERF_API_COUNT) {
+        return;
+    }
+    slot = &perf_slots[api];
+
+    W9825G6KH_AtomicAdd32(&slot->Calls, 1U);
+    W9825G6KH_AtomicAdd64(&slot->Bytes, bytes);
+    W9825G6KH_AtomicAdd64(&slot->TotalCycles, cycles);
+    W9825G6KH_AtomicMin32(&slot->MinCycles, cycles);
+    W9825G6KH_AtomicMax32(&slot->MaxCycles, cycles);
+    W9825G6KH_AtomicAdd32(&slot->Histogram[W9825G6KH_Perf_Log2(cycles)], 1U);
+}
+
+/**
+  * @brief  Copies the current counters into a caller-owned snapshot
+  * @param  snapshot: Destination
+  */
+void W9825G6KH_Perf_GetSnapshot(W9825G6KH_PerfSnapshotTypeDef *snapshot)
+{
+    if (snapshot == NULL) {
+        return;
+    }
+
+    snapshot->CoreClockHz = SystemCoreClock;
+
+    for (uint32_t a = 0; a < W9825G6KH_PERF_API_COUNT; a++) {
+        W9825G6KH_PerfSlotTypeDef *slot = &perf_slots[a];
+        W9825G6KH_PerfCounterTypeDef *out = &snapshot->Api[a];
+
+        out->Calls = W9825G6KH_AtomicLoad32(&slot->Calls);
+        out->Bytes = W9825G6KH_AtomicLoad64(&slot->Bytes);
+        out->TotalCycles = W9825G6KH_AtomicLoad64(&slot->TotalCycles);
+        out->MinCycles = W9825G6KH_AtomicLoad32(&slot->MinCycles);
+        out->MaxCycles = W9825G6KH_AtomicLoad32(&slot->MaxCycles);
+        for (uint32_t b = 0; b < W9825G6KH_PERF_HIST_BINS; b++) {
+            out->Histogram[b] = W9825G6KH_AtomicLoad32(&slot->Histogram[b]);
+        }
+    }
+}
+
+/**
+  * @brief  Clears all counters
+  * @note   Calls recorded concurrently with a reset may be partially kept
+  */
+void W9825G6KH_Perf_Reset(void)
+{
+    for (uint32_t a = 0; a < W9825G6KH_PERF_API_COUNT; a++) {
+        W9825G6KH_PerfSlotTypeDef *slot = &perf_slots[a];
+
+        W9825G6KH_AtomicStore32(&slot->Calls, 0U);
+        W9825G6KH_AtomicStore64(&slot->Bytes, 0U);
+        W9825G6KH_AtomicStore64(&slot->TotalCycles, 0U);
+        W9825G6KH_AtomicStore32(&slot->MinCycles, 0xFFFFFFFFU);
+        W9825G6KH_AtomicStore32(&slot->MaxCycles, 0U);
+        for (uint32_t b = 0; b < W9825G6KH_PERF_HIST_BINS; b++) {
+            W9825G6KH_AtomicStore32(&slot->Histogram[b], 0U);
+        }
+    }
+}
+
+/**
+  * @brief  Average throughput of a counter
+  * @param  counter: Counter from a snapshot
+  * @param  core_clock_hz: Clock the cycle counts refer to
+  * @retval Throughput in kilobytes (1000 B) per second, 0 if nothing recorded
+  */
+uint32_t W9825G6KH_Perf_ThroughputKBps(const W9825G6KH_PerfCounterTypeDef *counter, uint32_t core_clock_hz)
+{
+    if (counter == NULL || counter->TotalCycles == 0U) {
+        return 0;
+    }
+
+    /* bytes / (cycles / hz) / 1000 */
+    return (uint32_t)((counter->Bytes * (uint64_t)(core_clock_hz / 1000U)) / counter->TotalCycles);
+}
+
+/**
+  * @brief  Printable name of an API slot
+  */
+const char* W9825G6KH_Perf_ApiName(W9825G6KH_PerfApiTypeDef api)
+{
+    if ((uint32_t)api >= W9825G6KH_PERF_API_COUNT) {
+        return "Unknown";
+    }
+    return perf_api_names[api];
+}
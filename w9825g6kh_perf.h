@@ -0,0 +1,77 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_perf.h
+  * @brief   DWT cycle-counter based performance counters for the W9825G6KH
+  *          driver entry points
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_PERF_H
+#define __W9825G6KH_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Bin n counts calls that took [2^n, 2^(n+1)) cycles; bin 0 also holds 0 */
+#define W9825G6KH_PERF_HIST_BINS         32
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_PERF_WRITE   = 0,  /* WriteBuffer / WriteBuffer16 / WriteBuffer32 */
+    W9825G6KH_PERF_READ,         /* ReadBuffer / ReadBuffer16 / ReadBuffer32 */
+    W9825G6KH_PERF_FILL,         /* FillBuffer / FillBuffer16 / FillBuffer32 */
+    W9825G6KH_PERF_MEMTEST,      /* MemoryTest */
+    W9825G6KH_PERF_COMMAND,      /* SendCommand */
+    W9825G6KH_PERF_API_COUNT
+} W9825G6KH_PerfApiTypeDef;
+
+typedef struct {
+    uint32_t Calls;              /* Completed calls */
+    uint64_t Bytes;              /* Bytes moved by those calls */
+    uint64_t TotalCycles;        /* Sum of per-call cycle counts */
+    uint32_t MinCycles;          /* 0xFFFFFFFF if no call recorded */
+    uint32_t MaxCycles;
+    uint32_t Histogram[W9825G6KH_PERF_HIST_BINS];
+} W9825G6KH_PerfCounterTypeDef;
+
+typedef struct {
+    uint32_t CoreClockHz;        /* Clock the cycle counts refer to */
+    W9825G6KH_PerfCounterTypeDef Api[W9825G6KH_PERF_API_COUNT];
+} W9825G6KH_PerfSnapshotTypeDef;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Current DWT cycle count (wraps every 2^32 cycles)
+  */
+static inline uint32_t W9825G6KH_Perf_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+void W9825G6KH_Perf_Init(void);
+void W9825G6KH_Perf_Record(W9825G6KH_PerfApiTypeDef api, uint32_t bytes, uint32_t start_cycles);
+void W9825G6KH_Perf_GetSnapshot(W9825G6KH_PerfSnapshotTypeDef *snapshot);
+void W9825G6KH_Perf_Reset(void);
+uint32_t W9825G6KH_Perf_ThroughputKBps(const W9825G6KH_PerfCounterTypeDef *counter, uint32_t core_clock_hz);
+const char* W9825G6KH_Perf_ApiName(W9825G6KH_PerfApiTypeDef api);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_PERF_H */
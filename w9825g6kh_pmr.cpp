@@ -0,0 +1,280 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_pmr.cpp
+  * @brief   std::pmr::memory_resource over SDRAM: heap, monotonic and pool
+  *          modes
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * HEAP mode forwards to the SDRAM heap and can free individual blocks.
+  * MONOTONIC and POOL modes own a caller-chosen SDRAM range (which must not
+  * overlap the heap region): MONOTONIC bumps a pointer and only frees on
+  * Release(); POOL keeps one free list per power-of-two size class and
+  * refills a class by carving a slab from the range. Pool blocks larger
+  * than W9825G6KH_PMR_POOL_MAX_BLOCK come from the SDRAM heap and are not
+  * reclaimed by Release().
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_pmr.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define PMR_MIN_CLASS_SHIFT          5U     /* 32 B, one D-cache line */
+
+/* Private functions ---------------------------------------------------------*/
+
+static uintptr_t W9825G6KH_Pmr_AlignUp(uintptr_t value, std::size_t alignment)
+{
+    return (value + (alignment - 1U)) & ~(uintptr_t)(alignment - 1U);
+}
+
+static std::size_t W9825G6KH_Pmr_Alignment(std::size_t alignment)
+{
+    return (alignment > W9825G6KH_HEAP_ALIGN) ? alignment : W9825G6KH_HEAP_ALIGN;
+}
+
+static void W9825G6KH_Pmr_Fail()
+{
+#if defined(__cpp_exceptions)
+    throw std::bad_alloc();
+#else
+    Error_Handler();
+#endif
+}
+
+/* Construction --------------------------------------------------------------*/
+
+W9825G6KH_SdramResource::W9825G6KH_SdramResource() noexcept
+    : mode(W9825G6KH_PMR_HEAP), region_start(nullptr), region_end(nullptr),
+      region_next(nullptr), pool_free(), stats()
+{
+}
+
+W9825G6KH_SdramResource::W9825G6KH_SdramResource(uint32_t Offset, uint32_t Size, W9825G6KH_PmrModeTypeDef Mode) noexcept
+    : mode(Mode), region_start(nullptr), region_end(nullptr),
+      region_next(nullptr), pool_free(), stats()
+{
+    if (Mode == W9825G6KH_PMR_HEAP || Size == 0 || Offset >= W9825G6KH_SIZE_BYTES ||
+        Size > W9825G6KH_SIZE_BYTES - Offset) {
+        /* Invalid region: every allocation fails (counted in Failures) */
+        return;
+    }
+
+    uintptr_t start = W9825G6KH_Pmr_AlignUp((uintptr_t)W9825G6KH_BANK_ADDR + Offset, W9825G6KH_HEAP_ALIGN);
+    uintptr_t end = (uintptr_t)W9825G6KH_BANK_ADDR + Offset + Size;
+
+    if (end > start) {
+        region_start = reinterpret_cast<uint8_t*>(start);
+        region_end = reinterpret_cast<uint8_t*>(end);
+        region_next = region_start;
+        stats.CapacityBytes = (uint32_t)(end - start);
+    }
+}
+
+W9825G6KH_SdramResource::~W9825G6KH_SdramResource()
+{
+}
+
+/* Private members -----------------------------------------------------------*/
+
+/* Bump allocation from the region; caller holds the heap lock */
+void* W9825G6KH_SdramResource::Carve(std::size_t bytes, std::size_t alignment) noexcept
+{
+    if (region_next == nullptr) {
+        return nullptr;
+    }
+
+    uintptr_t p = W9825G6KH_Pmr_AlignUp((uintptr_t)region_next, W9825G6KH_Pmr_Alignment(alignment));
+    if (p > (uintptr_t)region_end || bytes > (uintptr_t)region_end - p) {
+        return nullptr;
+    }
+
+    region_next = reinterpret_cast<uint8_t*>(p + bytes);
+    stats.RegionUsedBytes = (uint32_t)(region_next - region_start);
+    return reinterpret_cast<void*>(p);
+}
+
+/* The SDRAM heap aligns to W9825G6KH_HEAP_ALIGN; stronger alignment
+ * over-allocates and keeps the raw pointer in the word below the block */
+void* W9825G6KH_SdramResource::HeapAllocate(std::size_t bytes, std::size_t alignment) noexcept
+{
+    if (alignment <= W9825G6KH_HEAP_ALIGN) {
+        return W9825G6KH_Heap_Malloc(bytes, W9825G6KH_HEAP_SDRAM);
+    }
+
+    void *raw = W9825G6KH_Heap_Malloc(bytes + alignment, W9825G6KH_HEAP_SDRAM);
+    if (raw == nullptr) {
+        return nullptr;
+    }
+
+    uintptr_t p = W9825G6KH_Pmr_AlignUp((uintptr_t)raw + 1U, alignment);
+    reinterpret_cast<void**>(p)[-1] = raw;
+    return reinterpret_cast<void*>(p);
+}
+
+void W9825G6KH_SdramResource::HeapDeallocate(void *p, std::size_t alignment) noexcept
+{
+    if (alignment <= W9825G6KH_HEAP_ALIGN) {
+        W9825G6KH_Heap_Free(p);
+    } else {
+        W9825G6KH_Heap_Free(reinterpret_cast<void**>(p)[-1]);
+    }
+}
+
+/* Size class index, or W9825G6KH_PMR_POOL_CLASSES if too large to pool */
+uint32_t W9825G6KH_SdramResource::PoolClass(std::size_t bytes, std::size_t alignment) noexcept
+{
+    std::size_t need = (bytes > alignment) ? bytes : alignment;
+    uint32_t cls = 0;
+
+    while (cls < W9825G6KH_PMR_POOL_CLASSES && ((std::size_t)1U << (cls + PMR_MIN_CLASS_SHIFT)) < need) {
+        cls++;
+    }
+    if (((std::size_t)1U << (cls + PMR_MIN_CLASS_SHIFT)) > W9825G6KH_PMR_POOL_MAX_BLOCK) {
+        return W9825G6KH_PMR_POOL_CLASSES;
+    }
+    return cls;
+}
+
+/* memory_resource interface -------------------------------------------------*/
+
+void* W9825G6KH_SdramResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    void *p = nullptr;
+    std::size_t charged = (std::size_t)W9825G6KH_Pmr_AlignUp((bytes != 0) ? bytes : 1U, W9825G6KH_HEAP_ALIGN);
+
+    W9825G6KH_Heap_Lock();
+
+    if (mode == W9825G6KH_PMR_MONOTONIC) {
+        p = Carve(charged, alignment);
+    } else if (mode == W9825G6KH_PMR_POOL && region_next != nullptr) {
+        uint32_t cls = PoolClass(bytes, alignment);
+
+        if (cls >= W9825G6KH_PMR_POOL_CLASSES) {
+            p = HeapAllocate(charged, alignment);
+        } else {
+            std::size_t block = (std::size_t)1U << (cls + PMR_MIN_CLASS_SHIFT);
+
+            if (pool_free[cls] == nullptr) {
+                /* Slabs are aligned to the class size, so every block in a
+                 * class satisfies any alignment that maps to it */
+                std::size_t slab = (block > W9825G6KH_PMR_POOL_SLAB_BYTES) ? block : W9825G6KH_PMR_POOL_SLAB_BYTES;
+                uint8_t *base = static_cast<uint8_t*>(Carve(slab, block));
+
+                if (base == nullptr) {
+                    slab = block;
+                    base = static_cast<uint8_t*>(Carve(slab, block));
+                }
+                for (std::size_t off = 0; base != nullptr && off < slab; off += block) {
+                    FreeBlock *fb = reinterpret_cast<FreeBlock*>(base + off);
+                    fb->Next = pool_free[cls];
+                    pool_free[cls] = fb;
+                }
+            }
+
+            if (pool_free[cls] != nullptr) {
+                p = pool_free[cls];
+                pool_free[cls] = pool_free[cls]->Next;
+                charged = block;
+            }
+        }
+    } else if (mode == W9825G6KH_PMR_HEAP) {
+        p = HeapAllocate(charged, alignment);
+    }
+
+    if (p != nullptr) {
+        stats.Allocations++;
+        stats.UsedBytes += (uint32_t)charged;
+        if (stats.UsedBytes > stats.PeakUsedBytes) {
+            stats.PeakUsedBytes = stats.UsedBytes;
+        }
+    } else {
+        stats.Failures++;
+    }
+
+    W9825G6KH_Heap_Unlock();
+
+    if (p == nullptr) {
+        W9825G6KH_Pmr_Fail();
+    }
+    return p;
+}
+
+void W9825G6KH_SdramResource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+    std::size_t charged = (std::size_t)W9825G6KH_Pmr_AlignUp((bytes != 0) ? bytes : 1U, W9825G6KH_HEAP_ALIGN);
+
+    if (p == nullptr) {
+        return;
+    }
+
+    W9825G6KH_Heap_Lock();
+
+    if (mode == W9825G6KH_PMR_POOL) {
+        uint32_t cls = PoolClass(bytes, alignment);
+
+        if (cls >= W9825G6KH_PMR_POOL_CLASSES) {
+            HeapDeallocate(p, alignment);
+        } else {
+            FreeBlock *fb = static_cast<FreeBlock*>(p);
+            fb->Next = pool_free[cls];
+            pool_free[cls] = fb;
+            charged = (std::size_t)1U << (cls + PMR_MIN_CLASS_SHIFT);
+        }
+    } else if (mode == W9825G6KH_PMR_HEAP) {
+        HeapDeallocate(p, alignment);
+    }
+    /* MONOTONIC: storage comes back on Release() */
+
+    stats.Deallocations++;
+    stats.UsedBytes = (stats.UsedBytes > charged) ? stats.UsedBytes - (uint32_t)charged : 0U;
+
+    W9825G6KH_Heap_Unlock();
+}
+
+bool W9825G6KH_SdramResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+/* Public members ------------------------------------------------------------*/
+
+void W9825G6KH_SdramResource::Release() noexcept
+{
+    if (mode == W9825G6KH_PMR_HEAP || region_start == nullptr) {
+        return;
+    }
+
+    W9825G6KH_Heap_Lock();
+    region_next = region_start;
+    for (uint32_t i = 0; i < W9825G6KH_PMR_POOL_CLASSES; i++) {
+        pool_free[i] = nullptr;
+    }
+    stats.UsedBytes = 0;
+    stats.RegionUsedBytes = 0;
+    W9825G6KH_Heap_Unlock();
+}
+
+void W9825G6KH_SdramResource::GetStats(W9825G6KH_PmrStatsTypeDef *out) const noexcept
+{
+    if (out == nullptr) {
+        return;
+    }
+
+    W9825G6KH_Heap_Lock();
+    *out = stats;
+    W9825G6KH_Heap_Unlock();
+}
+
+W9825G6KH_SdramResource* W9825G6KH_Pmr_Default() noexcept
+{
+    static W9825G6KH_SdramResource resource;
+    return &resource;
+}
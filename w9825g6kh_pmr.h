@@ -0,0 +1,145 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_pmr.h
+  * @brief   C++ memory resource and STL allocator placing container storage
+  *          in SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Moving a container to SDRAM is a one-line change:
+  *
+  *   W9825G6KH_SdramVector<int16_t> samples;                 // typed allocator
+  *   std::pmr::vector<Frame> frames(W9825G6KH_Pmr_Default()); // pmr
+  *
+  *   static W9825G6KH_SdramResource arena(0x00800000, 0x00100000, W9825G6KH_PMR_MONOTONIC);
+  *   std::pmr::deque<Msg> log(&arena);
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_PMR_H
+#define __W9825G6KH_PMR_H
+
+#ifndef __cplusplus
+#error "w9825g6kh_pmr.h is C++ only"
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_heap.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+/* Exported constants --------------------------------------------------------*/
+/* Pool mode: power-of-two size classes from the cache line up to this size;
+ * larger requests go to the SDRAM heap */
+#ifndef W9825G6KH_PMR_POOL_MAX_BLOCK
+#define W9825G6KH_PMR_POOL_MAX_BLOCK     4096U
+#endif
+
+/* Pool mode: bytes carved from the region whenever a size class runs dry */
+#ifndef W9825G6KH_PMR_POOL_SLAB_BYTES
+#define W9825G6KH_PMR_POOL_SLAB_BYTES    4096U
+#endif
+
+#define W9825G6KH_PMR_POOL_CLASSES       8U   /* 32 B .. 4 KB */
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_PMR_HEAP = 0,      /* General purpose: SDRAM heap (W9825G6KH_Heap_Init) */
+    W9825G6KH_PMR_MONOTONIC,     /* Bump arena; deallocate is a no-op, Release() frees all */
+    W9825G6KH_PMR_POOL           /* Size-class free lists carved from the region */
+} W9825G6KH_PmrModeTypeDef;
+
+typedef struct {
+    uint32_t CapacityBytes;      /* Region size (0 in HEAP mode) */
+    uint32_t UsedBytes;          /* Bytes handed out, after rounding */
+    uint32_t PeakUsedBytes;
+    uint32_t RegionUsedBytes;    /* Region consumed so far (MONOTONIC/POOL) */
+    uint32_t Allocations;
+    uint32_t Deallocations;
+    uint32_t Failures;
+} W9825G6KH_PmrStatsTypeDef;
+
+/* std::pmr::memory_resource over SDRAM. Allocations are aligned to at least
+ * one D-cache line (W9825G6KH_HEAP_ALIGN). Synchronised with
+ * W9825G6KH_Heap_Lock/Unlock. */
+class W9825G6KH_SdramResource : public std::pmr::memory_resource {
+public:
+    W9825G6KH_SdramResource() noexcept;
+    W9825G6KH_SdramResource(uint32_t Offset, uint32_t Size, W9825G6KH_PmrModeTypeDef Mode) noexcept;
+    ~W9825G6KH_SdramResource() override;
+
+    W9825G6KH_SdramResource(const W9825G6KH_SdramResource&) = delete;
+    W9825G6KH_SdramResource& operator=(const W9825G6KH_SdramResource&) = delete;
+
+    /* Returns every block to the region (MONOTONIC/POOL). Outstanding
+     * pointers become invalid. */
+    void Release() noexcept;
+    void GetStats(W9825G6KH_PmrStatsTypeDef *stats) const noexcept;
+    W9825G6KH_PmrModeTypeDef Mode() const noexcept { return mode; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+private:
+    struct FreeBlock { FreeBlock *Next; };
+
+    void* Carve(std::size_t bytes, std::size_t alignment) noexcept;
+    void* HeapAllocate(std::size_t bytes, std::size_t alignment) noexcept;
+    void HeapDeallocate(void *p, std::size_t alignment) noexcept;
+    static uint32_t PoolClass(std::size_t bytes, std::size_t alignment) noexcept;
+
+    W9825G6KH_PmrModeTypeDef mode;
+    uint8_t *region_start;
+    uint8_t *region_end;
+    uint8_t *region_next;
+    FreeBlock *pool_free[W9825G6KH_PMR_POOL_CLASSES];
+    W9825G6KH_PmrStatsTypeDef stats;
+};
+
+/* Shared HEAP-mode resource for std::pmr containers */
+W9825G6KH_SdramResource* W9825G6KH_Pmr_Default() noexcept;
+
+/* Stateless typed allocator over the SDRAM heap, for containers that are
+ * not pmr-aware */
+template <typename T>
+struct W9825G6KH_SdramAllocator {
+    using value_type = T;
+
+    W9825G6KH_SdramAllocator() noexcept = default;
+    template <typename U>
+    W9825G6KH_SdramAllocator(const W9825G6KH_SdramAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(W9825G6KH_Pmr_Default()->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+        W9825G6KH_Pmr_Default()->deallocate(p, n * sizeof(T), alignof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const W9825G6KH_SdramAllocator<T>&, const W9825G6KH_SdramAllocator<U>&) noexcept { return true; }
+template <typename T, typename U>
+bool operator!=(const W9825G6KH_SdramAllocator<T>&, const W9825G6KH_SdramAllocator<U>&) noexcept { return false; }
+
+template <typename T>
+using W9825G6KH_SdramVector = std::vector<T, W9825G6KH_SdramAllocator<T>>;
+template <typename T>
+using W9825G6KH_SdramDeque = std::deque<T, W9825G6KH_SdramAllocator<T>>;
+
+#endif /* __W9825G6KH_PMR_H */
@@ -0,0 +1,413 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_qos.c
+  * @brief   Bandwidth QoS scheduler for W9825G6KH SDRAM transfers
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Submissions queue per class (FIFO within a class, so a stream's bursts
+  * stay in order). Run cuts the chosen request into bursts that do not
+  * cross a W9825G6KH_QOS_BURST_BYTES boundary on the SDRAM side and issues
+  * them one at a time, so a bulk copy gives up the bus every page.
+  *
+  * WFQ: each class has a virtual clock advanced by burst bytes / weight;
+  * the backlogged class with the smallest clock goes next, so over time
+  * classes get bandwidth in proportion to their weights. A class that was
+  * idle restarts at the current virtual time instead of spending credit.
+  *
+  * EDF: the class whose head request has the earliest deadline goes next;
+  * requests without a deadline are served by WFQ when no deadline is
+  * pending.
+  *
+  * Submit may be called from ISRs (short critical sections); Run from one
+  * task or the main loop.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_qos.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define QOS_NONE                     0xFFFFFFFFU
+#define QOS_WEIGHT_SCALE             256U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    W9825G6KH_QoSRequestTypeDef Req;
+    uint32_t Done;               /* Bytes issued */
+    uint32_t Next;               /* Class FIFO or free list */
+} W9825G6KH_QoS_EntryTypeDef;
+
+typedef struct {
+    uint32_t Head;
+    uint32_t Tail;
+    uint32_t VTime;
+    W9825G6KH_QoSClassStatsTypeDef Stats;
+} W9825G6KH_QoS_ClassTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_QoS_EntryTypeDef qos_entries[W9825G6KH_QOS_MAX_REQUESTS];
+static W9825G6KH_QoS_ClassTypeDef qos_classes[W9825G6KH_QOS_CLASSES];
+static uint32_t qos_free = QOS_NONE;
+static uint32_t qos_vnow = 0;                   /* Virtual time of the last pick */
+static uint32_t qos_stats_start = 0;
+static volatile uint32_t qos_pending = 0;
+static W9825G6KH_QoSPolicyTypeDef qos_policy = W9825G6KH_QOS_POLICY_WFQ;
+
+/* Private functions ---------------------------------------------------------*/
+
+static inline uint32_t W9825G6KH_QoS_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    return primask;
+}
+
+static inline void W9825G6KH_QoS_Unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/* a before b on a wrapping clock */
+static inline uint32_t W9825G6KH_QoS_Before(uint32_t a, uint32_t b)
+{
+    return ((int32_t)(a - b) < 0) ? 1U : 0U;
+}
+
+static uint32_t W9825G6KH_QoS_InSdram(const void *p)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)p;
+
+    return (addr >= W9825G6KH_BANK_ADDR && addr <= W9825G6KH_END_ADDR) ? 1U : 0U;
+}
+
+/**
+  * @brief  Picks the class to serve next; caller holds the lock
+  * @retval Class, or QOS_NONE if nothing is queued
+  */
+static uint32_t W9825G6KH_QoS_Pick(void)
+{
+    uint32_t best = QOS_NONE;
+    uint32_t best_deadline = 0;
+
+    if (qos_policy == W9825G6KH_QOS_POLICY_EDF) {
+        for (uint32_t c = 0; c < W9825G6KH_QOS_CLASSES; c++) {
+            uint32_t head = qos_classes[c].Head;
+            uint32_t deadline;
+
+            if (head == QOS_NONE || qos_entries[head].Req.Deadline == W9825G6KH_QOS_NO_DEADLINE) {
+                continue;
+            }
+            deadline = qos_entries[head].Req.Deadline;
+            if (best == QOS_NONE || W9825G6KH_QoS_Before(deadline, best_deadline)) {
+                best = c;
+                best_deadline = deadline;
+            }
+        }
+        if (best != QOS_NONE) {
+            return best;
+        }
+    }
+
+    for (uint32_t c = 0; c < W9825G6KH_QOS_CLASSES; c++) {
+        if (qos_classes[c].Head == QOS_NONE) {
+            continue;
+        }
+        if (best == QOS_NONE || W9825G6KH_QoS_Before(qos_classes[c].VTime, qos_classes[best].VTime)) {
+            best = c;
+        }
+    }
+
+    return best;
+}
+
+/**
+  * @brief  Length of the next burst of a request
+  */
+static uint32_t W9825G6KH_QoS_BurstLength(const W9825G6KH_QoS_EntryTypeDef *e)
+{
+    uint32_t left = e->Req.Size - e->Done;
+    uint32_t addr = 0;
+    uint32_t room;
+
+    if (W9825G6KH_QoS_InSdram(e->Req.pDst)) {
+        addr = (uint32_t)(uintptr_t)e->Req.pDst + e->Done;
+    } else if (W9825G6KH_QoS_InSdram(e->Req.pSrc)) {
+        addr = (uint32_t)(uintptr_t)e->Req.pSrc + e->Done;
+    }
+
+    room = W9825G6KH_QOS_BURST_BYTES - (addr & (W9825G6KH_QOS_BURST_BYTES - 1U));
+    return (left < room) ? left : room;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Empties the queues and sets the policy; weights reset to 1
+  * @note   Not safe against concurrent Submit or Run
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Init(W9825G6KH_QoSPolicyTypeDef Policy)
+{
+    if (Policy != W9825G6KH_QOS_POLICY_WFQ && Policy != W9825G6KH_QOS_POLICY_EDF) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    memset(qos_entries, 0, sizeof(qos_entries));
+    memset(qos_classes, 0, sizeof(qos_classes));
+
+    for (uint32_t i = 0; i < W9825G6KH_QOS_MAX_REQUESTS; i++) {
+        qos_entries[i].Next = (i + 1U < W9825G6KH_QOS_MAX_REQUESTS) ? i + 1U : QOS_NONE;
+    }
+    qos_free = 0;
+
+    for (uint32_t c = 0; c < W9825G6KH_QOS_CLASSES; c++) {
+        qos_classes[c].Head = QOS_NONE;
+        qos_classes[c].Tail = QOS_NONE;
+        qos_classes[c].Stats.Weight = 1;
+    }
+
+    qos_policy = Policy;
+    qos_vnow = 0;
+    qos_pending = 0;
+    qos_stats_start = W9825G6KH_QoS_GetTime();
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Deadline Ticks from now, never W9825G6KH_QOS_NO_DEADLINE
+  * @param  Ticks: Budget in W9825G6KH_QoS_GetTime ticks
+  * @retval Absolute deadline for W9825G6KH_QoSRequestTypeDef.Deadline
+  */
+uint32_t W9825G6KH_QoS_DeadlineIn(uint32_t Ticks)
+{
+    return W9825G6KH_QOS_DEADLINE_AT(W9825G6KH_QoS_GetTime() + Ticks);
+}
+
+/**
+  * @brief  Sets a class's share under WFQ (relative to the other weights)
+  * @param  Weight: 1 .. 256
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_SetWeight(uint32_t Class, uint32_t Weight)
+{
+    if (Class >= W9825G6KH_QOS_CLASSES || Weight == 0U || Weight > QOS_WEIGHT_SCALE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    qos_classes[Class].Stats.Weight = Weight;
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Queues a transfer; callable from ISRs
+  * @param  Req: Request (copied)
+  * @retval W9825G6KH_OK, W9825G6KH_BUSY if the queue is full, or
+  *         W9825G6KH_INVALID_PARAM
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Submit(const W9825G6KH_QoSRequestTypeDef *Req)
+{
+    W9825G6KH_QoS_ClassTypeDef *cls;
+    uint32_t primask, i;
+
+    if (Req == NULL || Req->Class >= W9825G6KH_QOS_CLASSES || Req->Size == 0U ||
+        Req->pSrc == NULL || Req->pDst == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    cls = &qos_classes[Req->Class];
+
+    primask = W9825G6KH_QoS_Lock();
+
+    i = qos_free;
+    if (i == QOS_NONE) {
+        W9825G6KH_QoS_Unlock(primask);
+        return W9825G6KH_BUSY;
+    }
+    qos_free = qos_entries[i].Next;
+
+    qos_entries[i].Req = *Req;
+    qos_entries[i].Done = 0;
+    qos_entries[i].Next = QOS_NONE;
+
+    if (cls->Tail == QOS_NONE) {
+        /* Idle class rejoins at the current virtual time */
+        if (W9825G6KH_QoS_Before(cls->VTime, qos_vnow)) {
+            cls->VTime = qos_vnow;
+        }
+        cls->Head = i;
+    } else {
+        qos_entries[cls->Tail].Next = i;
+    }
+    cls->Tail = i;
+    cls->Stats.Submitted++;
+    cls->Stats.Queued++;
+    qos_pending++;
+
+    W9825G6KH_QoS_Unlock(primask);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Issues bursts in policy order
+  * @param  MaxBursts: Bursts to issue at most (0: until the queues are empty)
+  * @retval W9825G6KH_OK when idle, W9825G6KH_BUSY if work is left
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Run(uint32_t MaxBursts)
+{
+    W9825G6KH_QoS_EntryTypeDef *e;
+    W9825G6KH_QoS_ClassTypeDef *cls;
+    uint32_t issued = 0;
+    uint32_t primask, c, i, len, t0, t1, late;
+
+    while (MaxBursts == 0U || issued < MaxBursts) {
+        primask = W9825G6KH_QoS_Lock();
+        c = W9825G6KH_QoS_Pick();
+        if (c == QOS_NONE) {
+            W9825G6KH_QoS_Unlock(primask);
+            return W9825G6KH_OK;
+        }
+        cls = &qos_classes[c];
+        i = cls->Head;
+        qos_vnow = cls->VTime;
+        W9825G6KH_QoS_Unlock(primask);
+
+        /* Only Run touches a queued entry's Done, and Submit only appends */
+        e = &qos_entries[i];
+        len = W9825G6KH_QoS_BurstLength(e);
+
+        t0 = W9825G6KH_QoS_GetTime();
+        W9825G6KH_QoS_IssueBurst((uint8_t *)e->Req.pDst + e->Done, (const uint8_t *)e->Req.pSrc + e->Done, len);
+        t1 = W9825G6KH_QoS_GetTime();
+
+        e->Done += len;
+        cls->VTime += (len * QOS_WEIGHT_SCALE) / cls->Stats.Weight;
+        cls->Stats.Bursts++;
+        cls->Stats.Bytes += len;
+        cls->Stats.BusyTicks += t1 - t0;
+        issued++;
+
+        if (e->Done < e->Req.Size) {
+            continue;
+        }
+
+        late = 0;
+        if (e->Req.Deadline != W9825G6KH_QOS_NO_DEADLINE && W9825G6KH_QoS_Before(e->Req.Deadline, t1)) {
+            late = t1 - e->Req.Deadline;
+            cls->Stats.Missed++;
+            if (late > cls->Stats.MaxLate) {
+                cls->Stats.MaxLate = late;
+            }
+        }
+        cls->Stats.Completed++;
+
+        primask = W9825G6KH_QoS_Lock();
+        cls->Head = e->Next;
+        if (cls->Head == QOS_NONE) {
+            cls->Tail = QOS_NONE;
+        }
+        cls->Stats.Queued--;
+        qos_pending--;
+        W9825G6KH_QoS_Unlock(primask);
+
+        /* The callback may submit again, so release the entry first */
+        {
+            W9825G6KH_QoSDoneTypeDef cb = e->Req.Callback;
+            void *ctx = e->Req.Context;
+
+            primask = W9825G6KH_QoS_Lock();
+            e->Next = qos_free;
+            qos_free = i;
+            W9825G6KH_QoS_Unlock(primask);
+
+            if (cb != NULL) {
+                cb(ctx, late);
+            }
+        }
+    }
+
+    return (qos_pending != 0U) ? W9825G6KH_BUSY : W9825G6KH_OK;
+}
+
+uint32_t W9825G6KH_QoS_Pending(void)
+{
+    return qos_pending;
+}
+
+/**
+  * @brief  Reads a class's counters and bandwidth since ResetStats
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_GetClassStats(uint32_t Class, W9825G6KH_QoSClassStatsTypeDef *stats)
+{
+    uint32_t elapsed;
+
+    if (Class >= W9825G6KH_QOS_CLASSES || stats == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    *stats = qos_classes[Class].Stats;
+    elapsed = W9825G6KH_QoS_GetTime() - qos_stats_start;
+    stats->BandwidthKBps = (elapsed != 0U) ?
+        (uint32_t)(((uint64_t)stats->Bytes * W9825G6KH_QOS_TIME_HZ) / ((uint64_t)elapsed * 1024U)) : 0U;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Clears the counters and restarts the bandwidth window
+  */
+void W9825G6KH_QoS_ResetStats(void)
+{
+    uint32_t primask = W9825G6KH_QoS_Lock();
+
+    for (uint32_t c = 0; c < W9825G6KH_QOS_CLASSES; c++) {
+        W9825G6KH_QoSClassStatsTypeDef *s = &qos_classes[c].Stats;
+        uint32_t weight = s->Weight;
+        uint32_t queued = s->Queued;
+
+        memset(s, 0, sizeof(*s));
+        s->Weight = weight;
+        s->Queued = queued;
+    }
+    qos_stats_start = W9825G6KH_QoS_GetTime();
+
+    W9825G6KH_QoS_Unlock(primask);
+}
+
+void W9825G6KH_QoS_PrintStats(void)
+{
+    W9825G6KH_QoSClassStatsTypeDef s;
+
+    printf("\r\n=== SDRAM QoS (%s) ===\r\n", (qos_policy == W9825G6KH_QOS_POLICY_EDF) ? "EDF" : "WFQ");
+    printf("%5s %6s %10s %10s %8s %8s %8s %10s %6s\r\n",
+           "Class", "Weight", "Bytes", "KB/s", "Bursts", "Done", "Missed", "MaxLate", "Queue");
+    for (uint32_t c = 0; c < W9825G6KH_QOS_CLASSES; c++) {
+        (void)W9825G6KH_QoS_GetClassStats(c, &s);
+        printf("%5lu %6lu %10lu %10lu %8lu %8lu %8lu %10lu %6lu\r\n",
+               (unsigned long)c, (unsigned long)s.Weight, (unsigned long)s.Bytes,
+               (unsigned long)s.BandwidthKBps, (unsigned long)s.Bursts, (unsigned long)s.Completed,
+               (unsigned long)s.Missed, (unsigned long)s.MaxLate, (unsigned long)s.Queued);
+    }
+}
+
+__weak uint32_t W9825G6KH_QoS_GetTime(void)
+{
+    return W9825G6KH_Perf_GetCycles();
+}
+
+__weak void W9825G6KH_QoS_IssueBurst(void *pDst, const void *pSrc, uint32_t Size)
+{
+    memcpy(pDst, pSrc, Size);
+}
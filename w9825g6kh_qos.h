@@ -0,0 +1,109 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_qos.h
+  * @brief   Bandwidth QoS scheduler for W9825G6KH SDRAM transfers:
+  *          page-sized bursts in weighted-fair or earliest-deadline order
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_QOS_H
+#define __W9825G6KH_QOS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef W9825G6KH_QOS_CLASSES
+#define W9825G6KH_QOS_CLASSES            4U
+#endif
+
+/* Outstanding submissions over all classes */
+#ifndef W9825G6KH_QOS_MAX_REQUESTS
+#define W9825G6KH_QOS_MAX_REQUESTS       32U
+#endif
+
+/* Bursts never cross a boundary of this size on the SDRAM side, so each
+ * one stays in a single open row */
+#ifndef W9825G6KH_QOS_BURST_BYTES
+#define W9825G6KH_QOS_BURST_BYTES        W9825G6KH_PAGE_SIZE_BYTES
+#endif
+
+/* Ticks per second of W9825G6KH_QoS_GetTime (default: DWT cycles) */
+#ifndef W9825G6KH_QOS_TIME_HZ
+#define W9825G6KH_QOS_TIME_HZ            SystemCoreClock
+#endif
+
+/* Deadline 0 means none. The tick clock wraps, so a computed deadline can
+ * land on 0: build it with W9825G6KH_QOS_DEADLINE_AT (or
+ * W9825G6KH_QoS_DeadlineIn), which moves it to 1, one tick late. */
+#define W9825G6KH_QOS_NO_DEADLINE        0U
+#define W9825G6KH_QOS_DEADLINE_AT(t)     (((uint32_t)(t) == W9825G6KH_QOS_NO_DEADLINE) ? 1U : (uint32_t)(t))
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_QOS_POLICY_WFQ = 0,    /* Share bursts by class weight */
+    W9825G6KH_QOS_POLICY_EDF         /* Earliest deadline first; WFQ among the rest */
+} W9825G6KH_QoSPolicyTypeDef;
+
+/* Completion: Late is how far past its deadline the last burst finished
+ * (0 if met or no deadline) */
+typedef void (*W9825G6KH_QoSDoneTypeDef)(void *Context, uint32_t Late);
+
+typedef struct {
+    uint32_t Class;              /* 0 .. W9825G6KH_QOS_CLASSES - 1 */
+    const void *pSrc;            /* CPU addresses; either side may be SDRAM */
+    void *pDst;
+    uint32_t Size;
+    uint32_t Deadline;           /* Absolute, in W9825G6KH_QoS_GetTime ticks;
+                                    see W9825G6KH_QOS_DEADLINE_AT */
+    W9825G6KH_QoSDoneTypeDef Callback;
+    void *Context;
+} W9825G6KH_QoSRequestTypeDef;
+
+typedef struct {
+    uint32_t Weight;
+    uint32_t Submitted;
+    uint32_t Completed;
+    uint32_t Bursts;
+    uint32_t Bytes;
+    uint32_t BusyTicks;          /* Time spent issuing this class's bursts */
+    uint32_t Missed;             /* Requests completed after their deadline */
+    uint32_t MaxLate;
+    uint32_t Queued;             /* Requests not yet complete */
+    uint32_t BandwidthKBps;      /* Bytes over the time since ResetStats */
+} W9825G6KH_QoSClassStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Init(W9825G6KH_QoSPolicyTypeDef Policy);
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_SetWeight(uint32_t Class, uint32_t Weight);
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Submit(const W9825G6KH_QoSRequestTypeDef *Req);
+uint32_t W9825G6KH_QoS_DeadlineIn(uint32_t Ticks);
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_Run(uint32_t MaxBursts);
+uint32_t W9825G6KH_QoS_Pending(void);
+W9825G6KH_StatusTypeDef W9825G6KH_QoS_GetClassStats(uint32_t Class, W9825G6KH_QoSClassStatsTypeDef *stats);
+void W9825G6KH_QoS_ResetStats(void);
+void W9825G6KH_QoS_PrintStats(void);
+
+/* Weak hooks: time base (default DWT cycles) and burst engine (default
+ * memcpy). Override IssueBurst to run each burst on DMA and wait. */
+uint32_t W9825G6KH_QoS_GetTime(void);
+void W9825G6KH_QoS_IssueBurst(void *pDst, const void *pSrc, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_QOS_H */
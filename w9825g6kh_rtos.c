@@ -0,0 +1,480 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_rtos.c
+  * @brief   Optional thread-safe front end for the W9825G6KH driver: a driver
+  *          task serving a priority request queue
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * All driver and HAL calls made through this layer run in one driver task,
+  * so commands, mode register loads and data transfers never interleave.
+  * The task always serves the highest non-empty priority class. Requests
+  * below CRITICAL are executed in W9825G6KH_RTOS_CHUNK_BYTES slices and
+  * re-queued at the head of their class after each slice, which lets a
+  * latency-critical read overtake a multi-megabyte fill within one slice.
+  *
+  * Without an OS backend (W9825G6KH_OS_NONE) requests execute inline in the
+  * caller. Submit and the blocking helpers are task-context only.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_rtos.h"
+#include "w9825g6kh_heap.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    W9825G6KH_RequestTypeDef *Head;
+    W9825G6KH_RequestTypeDef *Tail;
+} W9825G6KH_RTOS_QueueTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_OS_MutexTypeDef rtos_driver_mutex = NULL;
+static W9825G6KH_OS_MutexTypeDef rtos_queue_mutex = NULL;
+static W9825G6KH_OS_SemTypeDef rtos_work_sem = NULL;
+static W9825G6KH_OS_SemTypeDef rtos_slot_sem = NULL;
+static W9825G6KH_OS_SemTypeDef rtos_slot_done[W9825G6KH_RTOS_SYNC_SLOTS];
+static uint32_t rtos_slot_busy[W9825G6KH_RTOS_SYNC_SLOTS];
+static W9825G6KH_RTOS_QueueTypeDef rtos_queues[W9825G6KH_PRIO_COUNT];
+static volatile uint32_t rtos_running = 0;
+static void *volatile rtos_task = NULL;
+
+#if W9825G6KH_RTOS_HEAP_LOCKS
+static W9825G6KH_OS_MutexTypeDef rtos_heap_mutex = NULL;
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+static void W9825G6KH_RTOS_PushBack(W9825G6KH_RequestTypeDef *req)
+{
+    W9825G6KH_RTOS_QueueTypeDef *q = &rtos_queues[req->Priority];
+
+    req->Next = NULL;
+    if (q->Tail != NULL) {
+        q->Tail->Next = req;
+    } else {
+        q->Head = req;
+    }
+    q->Tail = req;
+}
+
+static void W9825G6KH_RTOS_PushFront(W9825G6KH_RequestTypeDef *req)
+{
+    W9825G6KH_RTOS_QueueTypeDef *q = &rtos_queues[req->Priority];
+
+    req->Next = q->Head;
+    q->Head = req;
+    if (q->Tail == NULL) {
+        q->Tail = req;
+    }
+}
+
+static W9825G6KH_RequestTypeDef* W9825G6KH_RTOS_PopHighest(void)
+{
+    for (uint32_t p = 0; p < W9825G6KH_PRIO_COUNT; p++) {
+        W9825G6KH_RTOS_QueueTypeDef *q = &rtos_queues[p];
+        W9825G6KH_RequestTypeDef *req = q->Head;
+
+        if (req != NULL) {
+            q->Head = req->Next;
+            if (q->Head == NULL) {
+                q->Tail = NULL;
+            }
+            req->Next = NULL;
+            return req;
+        }
+    }
+    return NULL;
+}
+
+/**
+  * @brief  Executes one slice of a request under the driver lock
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Execute(W9825G6KH_RequestTypeDef *req)
+{
+    W9825G6KH_StatusTypeDef status;
+    uint32_t n = req->Size - req->Done;
+
+    if (req->Priority != W9825G6KH_PRIO_CRITICAL && n > W9825G6KH_RTOS_CHUNK_BYTES) {
+        n = W9825G6KH_RTOS_CHUNK_BYTES;
+    }
+
+    W9825G6KH_OS_MutexLock(rtos_driver_mutex);
+
+    switch (req->Type) {
+        case W9825G6KH_REQ_READ:
+            status = W9825G6KH_ReadBuffer(req->pBuffer + req->Done, req->Address + req->Done, n);
+            break;
+        case W9825G6KH_REQ_WRITE:
+            status = W9825G6KH_WriteBuffer(req->pBuffer + req->Done, req->Address + req->Done, n);
+            break;
+        case W9825G6KH_REQ_FILL:
+            status = W9825G6KH_FillBuffer(req->Address + req->Done, n, (uint8_t)req->Value);
+            break;
+        case W9825G6KH_REQ_COMMAND:
+            status = W9825G6KH_SendCommand(req->pCommand);
+            break;
+        case W9825G6KH_REQ_MODE_REGISTER:
+            status = W9825G6KH_SetModeRegister(req->Value);
+            break;
+        default:
+            status = W9825G6KH_INVALID_PARAM;
+            break;
+    }
+
+    W9825G6KH_OS_MutexUnlock(rtos_driver_mutex);
+
+    req->Done += n;
+    return status;
+}
+
+/**
+  * @brief  Callback marker for SubmitAndWait; Complete wakes the waiter itself
+  */
+static void W9825G6KH_RTOS_SyncDone(W9825G6KH_RequestTypeDef *req)
+{
+    (void)req;
+}
+
+/**
+  * @brief  Runs the callback, then publishes Completed as the last access to
+  *         req: the owner may reuse or release it as soon as it reads 1
+  */
+static void W9825G6KH_RTOS_Complete(W9825G6KH_RequestTypeDef *req, W9825G6KH_StatusTypeDef status)
+{
+    W9825G6KH_ReqCallbackTypeDef callback = req->Callback;
+    W9825G6KH_OS_SemTypeDef waiter = NULL;
+
+    req->Status = status;
+    if (callback == W9825G6KH_RTOS_SyncDone) {
+        /* The waiter's request is on its stack: wake it after the last store */
+        waiter = rtos_slot_done[(uint32_t)(uintptr_t)req->Context];
+    } else if (callback != NULL) {
+        callback(req);
+    }
+
+    __atomic_store_n(&req->Completed, 1U, __ATOMIC_RELEASE);
+
+    if (waiter != NULL) {
+        W9825G6KH_OS_SemGive(waiter);
+    }
+}
+
+/**
+  * @brief  Runs a request to completion in the calling context
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_RTOS_RunInline(W9825G6KH_RequestTypeDef *req)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    do {
+        status = W9825G6KH_RTOS_Execute(req);
+    } while (status == W9825G6KH_OK && req->Done < req->Size);
+
+    W9825G6KH_RTOS_Complete(req, status);
+    return status;
+}
+
+static void W9825G6KH_RTOS_Task(void *arg)
+{
+    (void)arg;
+    rtos_task = W9825G6KH_OS_CurrentThread();
+
+    for (;;) {
+        W9825G6KH_RequestTypeDef *req;
+        W9825G6KH_StatusTypeDef status;
+
+        W9825G6KH_OS_MutexLock(rtos_queue_mutex);
+        req = W9825G6KH_RTOS_PopHighest();
+        W9825G6KH_OS_MutexUnlock(rtos_queue_mutex);
+
+        if (req == NULL) {
+            W9825G6KH_OS_SemTake(rtos_work_sem, W9825G6KH_OS_WAIT_FOREVER);
+            continue;
+        }
+
+        status = W9825G6KH_RTOS_Execute(req);
+
+        if (status == W9825G6KH_OK && req->Done < req->Size) {
+            /* Give higher classes a chance before the next slice */
+            W9825G6KH_OS_MutexLock(rtos_queue_mutex);
+            W9825G6KH_RTOS_PushFront(req);
+            W9825G6KH_OS_MutexUnlock(rtos_queue_mutex);
+            continue;
+        }
+
+        W9825G6KH_RTOS_Complete(req, status);
+    }
+}
+
+/**
+  * @brief  Validates a request and resets its driver-owned fields
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Prepare(W9825G6KH_RequestTypeDef *req)
+{
+    if (req == NULL || (uint32_t)req->Priority >= W9825G6KH_PRIO_COUNT) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (rtos_driver_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+    if (req->Type == W9825G6KH_REQ_COMMAND || req->Type == W9825G6KH_REQ_MODE_REGISTER) {
+        req->Size = 0;
+    } else if (req->Size == 0 || (req->Type != W9825G6KH_REQ_FILL && req->pBuffer == NULL)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    req->Done = 0;
+    req->Completed = 0;
+    req->Status = W9825G6KH_BUSY;
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Submits a request and blocks until the driver task completes it
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_RTOS_SubmitAndWait(W9825G6KH_RequestTypeDef *req)
+{
+    uint32_t slot = 0;
+    W9825G6KH_StatusTypeDef status;
+
+    if (!rtos_running || W9825G6KH_OS_CurrentThread() == rtos_task) {
+        /* No driver task, or called from a completion callback */
+        status = W9825G6KH_RTOS_Prepare(req);
+        return (status == W9825G6KH_OK) ? W9825G6KH_RTOS_RunInline(req) : status;
+    }
+
+    W9825G6KH_OS_SemTake(rtos_slot_sem, W9825G6KH_OS_WAIT_FOREVER);
+
+    W9825G6KH_OS_MutexLock(rtos_queue_mutex);
+    while (rtos_slot_busy[slot]) {
+        slot++;
+    }
+    rtos_slot_busy[slot] = 1;
+    W9825G6KH_OS_MutexUnlock(rtos_queue_mutex);
+
+    req->Callback = W9825G6KH_RTOS_SyncDone;
+    req->Context = (void *)(uintptr_t)slot;
+
+    status = W9825G6KH_RTOS_Submit(req);
+    if (status == W9825G6KH_OK) {
+        W9825G6KH_OS_SemTake(rtos_slot_done[slot], W9825G6KH_OS_WAIT_FOREVER);
+        status = req->Status;
+    }
+
+    W9825G6KH_OS_MutexLock(rtos_queue_mutex);
+    rtos_slot_busy[slot] = 0;
+    W9825G6KH_OS_MutexUnlock(rtos_queue_mutex);
+    W9825G6KH_OS_SemGive(rtos_slot_sem);
+
+    return status;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Creates the driver lock, queues and driver task
+  * @note   Call after W9825G6KH_Init. With W9825G6KH_OS_NONE no task is
+  *         created and requests run inline.
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Init(void)
+{
+    if (rtos_driver_mutex != NULL) {
+        return W9825G6KH_OK;
+    }
+
+    memset(rtos_queues, 0, sizeof(rtos_queues));
+    memset(rtos_slot_busy, 0, sizeof(rtos_slot_busy));
+
+    rtos_driver_mutex = W9825G6KH_OS_MutexCreate();
+    rtos_queue_mutex = W9825G6KH_OS_MutexCreate();
+    if (rtos_driver_mutex == NULL || rtos_queue_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+
+#if W9825G6KH_RTOS_HEAP_LOCKS
+    rtos_heap_mutex = W9825G6KH_OS_MutexCreate();
+    if (rtos_heap_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+#endif
+
+#if (W9825G6KH_OS != W9825G6KH_OS_NONE)
+    rtos_work_sem = W9825G6KH_OS_SemCreate(0xFFFFU, 0);
+    rtos_slot_sem = W9825G6KH_OS_SemCreate(W9825G6KH_RTOS_SYNC_SLOTS, W9825G6KH_RTOS_SYNC_SLOTS);
+    if (rtos_work_sem == NULL || rtos_slot_sem == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    for (uint32_t i = 0; i < W9825G6KH_RTOS_SYNC_SLOTS; i++) {
+        rtos_slot_done[i] = W9825G6KH_OS_SemCreate(1, 0);
+        if (rtos_slot_done[i] == NULL) {
+            return W9825G6KH_ERROR;
+        }
+    }
+
+    if (W9825G6KH_OS_ThreadCreate(W9825G6KH_RTOS_Task, NULL, "sdram",
+                                  W9825G6KH_RTOS_TASK_STACK_BYTES,
+                                  W9825G6KH_RTOS_TASK_PRIORITY) != W9825G6KH_OK) {
+        return W9825G6KH_ERROR;
+    }
+    rtos_running = 1;
+#endif
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Queues a request for the driver task (non-blocking)
+  * @param  req: Caller-owned request; Callback runs in the driver task
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Submit(W9825G6KH_RequestTypeDef *req)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_RTOS_Prepare(req);
+
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    if (!rtos_running) {
+        W9825G6KH_RTOS_RunInline(req);
+        return W9825G6KH_OK;
+    }
+
+    W9825G6KH_OS_MutexLock(rtos_queue_mutex);
+    W9825G6KH_RTOS_PushBack(req);
+    W9825G6KH_OS_MutexUnlock(rtos_queue_mutex);
+    W9825G6KH_OS_SemGive(rtos_work_sem);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Blocking read through the request queue
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize, W9825G6KH_PrioTypeDef prio)
+{
+    W9825G6KH_RequestTypeDef req = {0};
+
+    req.Type = W9825G6KH_REQ_READ;
+    req.Priority = prio;
+    req.Address = ReadAddr;
+    req.Size = BufferSize;
+    req.pBuffer = pBuffer;
+    return W9825G6KH_RTOS_SubmitAndWait(&req);
+}
+
+/**
+  * @brief  Blocking write through the request queue
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Write(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize, W9825G6KH_PrioTypeDef prio)
+{
+    W9825G6KH_RequestTypeDef req = {0};
+
+    req.Type = W9825G6KH_REQ_WRITE;
+    req.Priority = prio;
+    req.Address = WriteAddr;
+    req.Size = BufferSize;
+    req.pBuffer = pBuffer;
+    return W9825G6KH_RTOS_SubmitAndWait(&req);
+}
+
+/**
+  * @brief  Blocking fill through the request queue
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Fill(uint32_t StartAddr, uint32_t BufferSize, uint8_t Value, W9825G6KH_PrioTypeDef prio)
+{
+    W9825G6KH_RequestTypeDef req = {0};
+
+    req.Type = W9825G6KH_REQ_FILL;
+    req.Priority = prio;
+    req.Address = StartAddr;
+    req.Size = BufferSize;
+    req.Value = Value;
+    return W9825G6KH_RTOS_SubmitAndWait(&req);
+}
+
+/**
+  * @brief  Serialised W9825G6KH_SendCommand (CRITICAL class)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_SendCommand(FMC_SDRAM_CommandTypeDef *Command)
+{
+    W9825G6KH_RequestTypeDef req = {0};
+
+    if (Command == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    req.Type = W9825G6KH_REQ_COMMAND;
+    req.Priority = W9825G6KH_PRIO_CRITICAL;
+    req.pCommand = Command;
+    return W9825G6KH_RTOS_SubmitAndWait(&req);
+}
+
+/**
+  * @brief  Serialised W9825G6KH_SetModeRegister (CRITICAL class)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_SetModeRegister(uint32_t mode_value)
+{
+    W9825G6KH_RequestTypeDef req = {0};
+
+    req.Type = W9825G6KH_REQ_MODE_REGISTER;
+    req.Priority = W9825G6KH_PRIO_CRITICAL;
+    req.Value = mode_value;
+    return W9825G6KH_RTOS_SubmitAndWait(&req);
+}
+
+/**
+  * @brief  Takes the driver lock for direct W9825G6KH_* calls from a task
+  */
+void W9825G6KH_RTOS_Lock(void)
+{
+    if (rtos_driver_mutex != NULL) {
+        W9825G6KH_OS_MutexLock(rtos_driver_mutex);
+    }
+}
+
+/**
+  * @brief  Releases the driver lock
+  */
+void W9825G6KH_RTOS_Unlock(void)
+{
+    if (rtos_driver_mutex != NULL) {
+        W9825G6KH_OS_MutexUnlock(rtos_driver_mutex);
+    }
+}
+
+#if W9825G6KH_RTOS_HEAP_LOCKS
+/**
+  * @brief  Heap lock backed by a recursive mutex (replaces the weak default)
+  * @note   No-op until W9825G6KH_RTOS_Init has run, i.e. before the
+  *         scheduler starts
+  */
+void W9825G6KH_Heap_Lock(void)
+{
+    if (rtos_heap_mutex != NULL) {
+        W9825G6KH_OS_MutexLock(rtos_heap_mutex);
+    }
+}
+
+void W9825G6KH_Heap_Unlock(void)
+{
+    if (rtos_heap_mutex != NULL) {
+        W9825G6KH_OS_MutexUnlock(rtos_heap_mutex);
+    }
+}
+#endif /* W9825G6KH_RTOS_HEAP_LOCKS */
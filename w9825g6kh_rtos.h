@@ -0,0 +1,111 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_rtos.h
+  * @brief   Optional thread-safe front end for the W9825G6KH driver: a driver
+  *          task serving a priority request queue
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_RTOS_H
+#define __W9825G6KH_RTOS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include "w9825g6kh_os.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Non-critical requests are served in slices of at most this many bytes */
+#ifndef W9825G6KH_RTOS_CHUNK_BYTES
+#define W9825G6KH_RTOS_CHUNK_BYTES       4096U
+#endif
+
+/* Completion slots shared by the blocking convenience calls */
+#ifndef W9825G6KH_RTOS_SYNC_SLOTS
+#define W9825G6KH_RTOS_SYNC_SLOTS        8U
+#endif
+
+#ifndef W9825G6KH_RTOS_TASK_STACK_BYTES
+#define W9825G6KH_RTOS_TASK_STACK_BYTES  1024U
+#endif
+
+/* Native priority value of the driver task for the selected backend */
+#ifndef W9825G6KH_RTOS_TASK_PRIORITY
+#define W9825G6KH_RTOS_TASK_PRIORITY     24U
+#endif
+
+/* 1: implement the heap lock hooks with a driver-owned recursive mutex */
+#ifndef W9825G6KH_RTOS_HEAP_LOCKS
+#define W9825G6KH_RTOS_HEAP_LOCKS        (W9825G6KH_OS != W9825G6KH_OS_NONE)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_PRIO_CRITICAL = 0,  /* Served first, never sliced */
+    W9825G6KH_PRIO_NORMAL,
+    W9825G6KH_PRIO_BULK,          /* Large fills/copies; yields after each slice */
+    W9825G6KH_PRIO_COUNT
+} W9825G6KH_PrioTypeDef;
+
+typedef enum {
+    W9825G6KH_REQ_READ = 0,
+    W9825G6KH_REQ_WRITE,
+    W9825G6KH_REQ_FILL,
+    W9825G6KH_REQ_COMMAND,
+    W9825G6KH_REQ_MODE_REGISTER
+} W9825G6KH_ReqTypeDef;
+
+typedef struct W9825G6KH_Request W9825G6KH_RequestTypeDef;
+typedef void (*W9825G6KH_ReqCallbackTypeDef)(W9825G6KH_RequestTypeDef *req);
+
+/* Caller-owned request; must stay valid until the callback has run */
+struct W9825G6KH_Request {
+    W9825G6KH_ReqTypeDef Type;
+    W9825G6KH_PrioTypeDef Priority;
+    uint32_t Address;                       /* Offset from SDRAM base */
+    uint32_t Size;                          /* Bytes (READ/WRITE/FILL) */
+    uint8_t *pBuffer;                       /* READ destination / WRITE source */
+    uint32_t Value;                         /* FILL byte or mode register value */
+    FMC_SDRAM_CommandTypeDef *pCommand;     /* COMMAND */
+    W9825G6KH_ReqCallbackTypeDef Callback;  /* Runs in the driver task; may be NULL */
+    void *Context;
+
+    /* Filled in by the driver */
+    volatile W9825G6KH_StatusTypeDef Status;
+    volatile uint32_t Completed;
+    uint32_t Done;                          /* Bytes processed so far */
+    W9825G6KH_RequestTypeDef *Next;
+};
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Init(void);
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Submit(W9825G6KH_RequestTypeDef *req);
+
+/* Blocking helpers: enqueue and wait for completion */
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize, W9825G6KH_PrioTypeDef prio);
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Write(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize, W9825G6KH_PrioTypeDef prio);
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_Fill(uint32_t StartAddr, uint32_t BufferSize, uint8_t Value, W9825G6KH_PrioTypeDef prio);
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_SendCommand(FMC_SDRAM_CommandTypeDef *Command);
+W9825G6KH_StatusTypeDef W9825G6KH_RTOS_SetModeRegister(uint32_t mode_value);
+
+/* Direct driver access from a task: hold the driver lock around it */
+void W9825G6KH_RTOS_Lock(void);
+void W9825G6KH_RTOS_Unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_RTOS_H */
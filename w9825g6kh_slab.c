@@ -0,0 +1,325 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_slab.c
+  * @brief   Lock-free fixed-size object pools in W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Each pool is a run of equal, aligned objects with the free list threaded
+  * through the first word of the free objects (a Treiber stack). The head
+  * packs the index of the first free object with a tag that every push and
+  * pop increments, and is updated with a single 32-bit compare-and-swap, so
+  * a pop that was preempted while another context recycled the same object
+  * sees the tag change and retries (ARMv7-M has no 64-bit CAS for a
+  * pointer + counter pair). The index takes as many bits as the pool
+  * needs; the rest, at least 12, form the tag.
+  *
+  * Alloc and Free take no lock and may be called from any task or ISR.
+  * FreeBulk links the objects first and returns them with one CAS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_slab.h"
+#include "w9825g6kh_atomic.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SLAB_MAX_INDEX_BITS          20U         /* Leaves a 12-bit tag */
+
+/* Private functions ---------------------------------------------------------*/
+
+static inline uint32_t W9825G6KH_Slab_Mask(const W9825G6KH_SlabPoolTypeDef *pool)
+{
+    return (1UL << pool->IndexBits) - 1U;
+}
+
+/* Link word of a free object */
+static inline volatile uint32_t* W9825G6KH_Slab_Link(const W9825G6KH_SlabPoolTypeDef *pool, uint32_t index)
+{
+    return (volatile uint32_t *)(pool->Base + index * pool->Stride);
+}
+
+/**
+  * @brief  Index of an object of this pool
+  * @retval Index, or the pool's mask (no object) if ptr is not one
+  */
+static uint32_t W9825G6KH_Slab_Index(const W9825G6KH_SlabPoolTypeDef *pool, const void *ptr)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)ptr;
+    uint32_t rel = addr - pool->Base;
+
+    if (ptr == NULL || addr < pool->Base || rel / pool->Stride >= pool->Count || (rel % pool->Stride) != 0U) {
+        return W9825G6KH_Slab_Mask(pool);
+    }
+    return rel / pool->Stride;
+}
+
+/**
+  * @brief  Pushes the chain first..last (already linked) onto the free list
+  */
+static void W9825G6KH_Slab_Push(W9825G6KH_SlabPoolTypeDef *pool, uint32_t first, uint32_t last)
+{
+    uint32_t mask = W9825G6KH_Slab_Mask(pool);
+    uint32_t old = W9825G6KH_AtomicLoad32(&pool->Head);
+    uint32_t next;
+
+    do {
+        *W9825G6KH_Slab_Link(pool, last) = old & mask;
+        next = ((old + (mask + 1U)) & ~mask) | first;
+    } while (!W9825G6KH_AtomicCas32(&pool->Head, &old, next));
+}
+
+/**
+  * @brief  Pops one object
+  * @retval Index, or the pool's mask if the pool is empty
+  */
+static uint32_t W9825G6KH_Slab_Pop(W9825G6KH_SlabPoolTypeDef *pool)
+{
+    uint32_t mask = W9825G6KH_Slab_Mask(pool);
+    uint32_t old = W9825G6KH_AtomicLoad32(&pool->Head);
+    uint32_t index, next;
+
+    do {
+        index = old & mask;
+        if (index == mask) {
+            return mask;
+        }
+        /* May read a recycled object's payload; the tag check rejects it */
+        next = *W9825G6KH_Slab_Link(pool, index) & mask;
+        next = ((old + (mask + 1U)) & ~mask) | next;
+    } while (!W9825G6KH_AtomicCas32(&pool->Head, &old, next));
+
+    return index;
+}
+
+static void W9825G6KH_Slab_Taken(W9825G6KH_SlabPoolTypeDef *pool, uint32_t n)
+{
+    uint32_t in_use = W9825G6KH_AtomicAdd32(&pool->InUse, n) + n;
+
+    W9825G6KH_AtomicMax32(&pool->HighWater, in_use);
+    (void)W9825G6KH_AtomicAdd32(&pool->Allocs, n);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Carves a pool out of an SDRAM range and links all objects free
+  * @param  pool: Descriptor to initialize (SRAM)
+  * @param  Offset: Range start (offset from SDRAM base)
+  * @param  Size: Range size in bytes
+  * @param  ObjSize: Object size in bytes (at least 4)
+  * @param  Align: Object alignment, a power of two >= 4 (e.g.
+  *         W9825G6KH_SLAB_ALIGN_CACHE_LINE or W9825G6KH_SLAB_ALIGN_PAGE)
+  * @note   Not thread-safe against use of the same pool
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_Create(W9825G6KH_SlabPoolTypeDef *pool, uint32_t Offset, uint32_t Size,
+                                              uint32_t ObjSize, uint32_t Align)
+{
+    uint32_t base, end, stride, count, bits;
+
+    if (pool == NULL || ObjSize < 4U || Align < 4U || (Align & (Align - 1U)) != 0U ||
+        Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    base = (W9825G6KH_BANK_ADDR + Offset + Align - 1U) & ~(Align - 1U);
+    end = W9825G6KH_BANK_ADDR + Offset + Size;
+    stride = (ObjSize + Align - 1U) & ~(Align - 1U);
+    count = (base < end) ? (end - base) / stride : 0U;
+    if (count == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    /* Index field must hold count plus the "none" value */
+    bits = 32U - (uint32_t)__builtin_clz(count);
+    if (bits > SLAB_MAX_INDEX_BITS) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    pool->Base = base;
+    pool->Stride = stride;
+    pool->ObjSize = ObjSize;
+    pool->Count = count;
+    pool->IndexBits = bits;
+
+    for (uint32_t i = 0; i + 1U < count; i++) {
+        *W9825G6KH_Slab_Link(pool, i) = i + 1U;
+    }
+    *W9825G6KH_Slab_Link(pool, count - 1U) = W9825G6KH_Slab_Mask(pool);
+
+    W9825G6KH_AtomicStore32(&pool->Head, 0U);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Takes one object; lock-free, callable from tasks and ISRs
+  * @retval Object, or NULL if the pool is empty
+  */
+void* W9825G6KH_Slab_Alloc(W9825G6KH_SlabPoolTypeDef *pool)
+{
+    uint32_t index = W9825G6KH_Slab_Pop(pool);
+
+    if (index == W9825G6KH_Slab_Mask(pool)) {
+        (void)W9825G6KH_AtomicAdd32(&pool->Fails, 1U);
+        return NULL;
+    }
+
+    W9825G6KH_Slab_Taken(pool, 1U);
+    return (void *)(pool->Base + index * pool->Stride);
+}
+
+/**
+  * @brief  Returns one object; lock-free, callable from tasks and ISRs
+  * @retval W9825G6KH_OK, or W9825G6KH_INVALID_PARAM if ptr is not an
+  *         object of this pool (double frees are not detected)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_Free(W9825G6KH_SlabPoolTypeDef *pool, void *ptr)
+{
+    uint32_t index = W9825G6KH_Slab_Index(pool, ptr);
+
+    if (index == W9825G6KH_Slab_Mask(pool)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    (void)W9825G6KH_AtomicAdd32(&pool->InUse, (uint32_t)-1);
+    W9825G6KH_Slab_Push(pool, index, index);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Takes Count objects, all or none
+  * @param  ppObjs: Receives the objects
+  * @retval Count, or 0 if the pool could not supply them all
+  */
+uint32_t W9825G6KH_Slab_AllocBulk(W9825G6KH_SlabPoolTypeDef *pool, void **ppObjs, uint32_t Count)
+{
+    uint32_t mask = W9825G6KH_Slab_Mask(pool);
+    uint32_t first = mask;
+    uint32_t got = 0;
+    uint32_t index;
+
+    if (ppObjs == NULL || Count == 0U) {
+        return 0U;
+    }
+
+    while (got < Count) {
+        index = W9825G6KH_Slab_Pop(pool);
+        if (index == mask) {
+            break;
+        }
+        ppObjs[got++] = (void *)(pool->Base + index * pool->Stride);
+    }
+
+    if (got < Count) {
+        /* Put back what we took as one chain */
+        for (uint32_t i = 0; i < got; i++) {
+            index = W9825G6KH_Slab_Index(pool, ppObjs[i]);
+            *W9825G6KH_Slab_Link(pool, index) = first;
+            first = index;
+        }
+        if (got != 0U) {
+            W9825G6KH_Slab_Push(pool, first, W9825G6KH_Slab_Index(pool, ppObjs[0]));
+        }
+        (void)W9825G6KH_AtomicAdd32(&pool->Fails, 1U);
+        return 0U;
+    }
+
+    W9825G6KH_Slab_Taken(pool, Count);
+    return Count;
+}
+
+/**
+  * @brief  Returns Count objects with a single update of the free list
+  * @retval W9825G6KH_OK, or W9825G6KH_INVALID_PARAM (nothing freed) if any
+  *         entry is not an object of this pool
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_FreeBulk(W9825G6KH_SlabPoolTypeDef *pool, void * const *ppObjs, uint32_t Count)
+{
+    uint32_t mask = W9825G6KH_Slab_Mask(pool);
+    uint32_t first = mask;
+    uint32_t index;
+
+    if (ppObjs == NULL || Count == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < Count; i++) {
+        if (W9825G6KH_Slab_Index(pool, ppObjs[i]) == mask) {
+            return W9825G6KH_INVALID_PARAM;
+        }
+    }
+
+    /* Chain ppObjs[Count-1] -> ... -> ppObjs[0]; Push links [0] to the list */
+    for (uint32_t i = 0; i < Count; i++) {
+        index = W9825G6KH_Slab_Index(pool, ppObjs[i]);
+        if (first != mask) {
+            *W9825G6KH_Slab_Link(pool, index) = first;
+        }
+        first = index;
+    }
+
+    (void)W9825G6KH_AtomicAdd32(&pool->InUse, 0U - Count);
+    W9825G6KH_Slab_Push(pool, first, W9825G6KH_Slab_Index(pool, ppObjs[0]));
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Tells whether ptr is an object of the pool
+  * @retval 1 or 0
+  */
+uint32_t W9825G6KH_Slab_Owns(const W9825G6KH_SlabPoolTypeDef *pool, const void *ptr)
+{
+    return (W9825G6KH_Slab_Index(pool, ptr) != W9825G6KH_Slab_Mask(pool)) ? 1U : 0U;
+}
+
+void W9825G6KH_Slab_GetStats(const W9825G6KH_SlabPoolTypeDef *pool, W9825G6KH_SlabStatsTypeDef *stats)
+{
+    if (pool == NULL || stats == NULL) {
+        return;
+    }
+
+    stats->Count = pool->Count;
+    stats->ObjSize = pool->ObjSize;
+    stats->Stride = pool->Stride;
+    stats->InUse = pool->InUse;
+    stats->HighWater = pool->HighWater;
+    stats->Allocs = pool->Allocs;
+    stats->Fails = pool->Fails;
+    stats->OccupancyPct = (pool->Count != 0U) ? (uint32_t)((uint64_t)stats->InUse * 100U / pool->Count) : 0U;
+}
+
+/**
+  * @brief  Restarts the high-water mark from the current occupancy
+  */
+void W9825G6KH_Slab_ResetHighWater(W9825G6KH_SlabPoolTypeDef *pool)
+{
+    W9825G6KH_AtomicStore32(&pool->HighWater, W9825G6KH_AtomicLoad32(&pool->InUse));
+}
+
+void W9825G6KH_Slab_PrintStats(const char *Name, const W9825G6KH_SlabPoolTypeDef *pool)
+{
+    W9825G6KH_SlabStatsTypeDef s;
+
+    if (pool == NULL) {
+        return;
+    }
+
+    W9825G6KH_Slab_GetStats(pool, &s);
+    printf("Slab %-12s %6lu x %5lu B (stride %lu): in use %lu (%lu%%), high-water %lu, allocs %lu, fails %lu\r\n",
+           (Name != NULL) ? Name : "", (unsigned long)s.Count, (unsigned long)s.ObjSize, (unsigned long)s.Stride,
+           (unsigned long)s.InUse, (unsigned long)s.OccupancyPct, (unsigned long)s.HighWater,
+           (unsigned long)s.Allocs, (unsigned long)s.Fails);
+}
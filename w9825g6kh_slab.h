@@ -0,0 +1,76 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_slab.h
+  * @brief   Lock-free fixed-size object pools carved from W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_SLAB_H
+#define __W9825G6KH_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Common object alignments */
+#define W9825G6KH_SLAB_ALIGN_WORD        4U
+#define W9825G6KH_SLAB_ALIGN_CACHE_LINE  32U
+#define W9825G6KH_SLAB_ALIGN_PAGE        W9825G6KH_PAGE_SIZE_BYTES
+
+/* Exported types ------------------------------------------------------------*/
+/* Pool descriptor; lives in SRAM, objects live in SDRAM. Fields are managed
+ * by the W9825G6KH_Slab functions. */
+typedef struct {
+    volatile uint32_t Head;      /* Free list: (tag << IndexBits) | index */
+    uint32_t Base;               /* CPU address of object 0 */
+    uint32_t Stride;             /* Object size rounded up to the alignment */
+    uint32_t ObjSize;
+    uint32_t Count;
+    uint32_t IndexBits;
+    volatile uint32_t InUse;
+    volatile uint32_t HighWater;
+    volatile uint32_t Allocs;
+    volatile uint32_t Fails;
+} W9825G6KH_SlabPoolTypeDef;
+
+typedef struct {
+    uint32_t Count;              /* Objects in the pool */
+    uint32_t ObjSize;
+    uint32_t Stride;
+    uint32_t InUse;
+    uint32_t HighWater;          /* Peak InUse since Create or ResetHighWater */
+    uint32_t Allocs;             /* Objects handed out */
+    uint32_t Fails;              /* Alloc / AllocBulk calls that found too few */
+    uint32_t OccupancyPct;
+} W9825G6KH_SlabStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_Create(W9825G6KH_SlabPoolTypeDef *pool, uint32_t Offset, uint32_t Size,
+                                              uint32_t ObjSize, uint32_t Align);
+void* W9825G6KH_Slab_Alloc(W9825G6KH_SlabPoolTypeDef *pool);
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_Free(W9825G6KH_SlabPoolTypeDef *pool, void *ptr);
+uint32_t W9825G6KH_Slab_AllocBulk(W9825G6KH_SlabPoolTypeDef *pool, void **ppObjs, uint32_t Count);
+W9825G6KH_StatusTypeDef W9825G6KH_Slab_FreeBulk(W9825G6KH_SlabPoolTypeDef *pool, void * const *ppObjs, uint32_t Count);
+uint32_t W9825G6KH_Slab_Owns(const W9825G6KH_SlabPoolTypeDef *pool, const void *ptr);
+void W9825G6KH_Slab_GetStats(const W9825G6KH_SlabPoolTypeDef *pool, W9825G6KH_SlabStatsTypeDef *stats);
+void W9825G6KH_Slab_ResetHighWater(W9825G6KH_SlabPoolTypeDef *pool);
+void W9825G6KH_Slab_PrintStats(const char *Name, const W9825G6KH_SlabPoolTypeDef *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_SLAB_H */
@@ -0,0 +1,403 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_snapshot.c
+  * @brief   Low-power snapshot of selected SDRAM regions
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Only the registered regions are checksummed before self-refresh and
+  * checked after wake, so the cost scales with live data, not with the
+  * 32 MB part. W9825G6KH_Snapshot_Compact packs the regions together first
+  * so they span as few rows as possible.
+  *
+  * The checksum is two running 32-bit word sums (Fletcher style): one add
+  * per word for the data, one for the order, which keeps it SDRAM bound.
+  * Verification can run incrementally with VerifyStep, so the application
+  * can restart DMA streams and use regions marked VALID while the rest are
+  * still being checked.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_snapshot.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SNAPSHOT_STAGE_BYTES         512U    /* SRAM staging for compaction */
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_SnapRegionTypeDef snap_regions[W9825G6KH_SNAPSHOT_MAX_REGIONS];
+static W9825G6KH_SnapshotStatsTypeDef snap_stats;
+static uint32_t snap_verify_pos = 0;       /* Bytes checked in current region */
+static uint32_t snap_verify_a = 0;
+static uint32_t snap_verify_b = 0;
+static uint32_t snap_verify_bytes = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void W9825G6KH_Snapshot_Sum(uint32_t Offset, uint32_t Size, uint32_t *a, uint32_t *b)
+{
+    const uint32_t *p = (const uint32_t *)(W9825G6KH_BANK_ADDR + Offset);
+    uint32_t words = Size / 4U;
+    uint32_t sa = *a, sb = *b;
+
+    while (words >= 4U) {
+        sa += p[0]; sb += sa;
+        sa += p[1]; sb += sa;
+        sa += p[2]; sb += sa;
+        sa += p[3]; sb += sa;
+        p += 4;
+        words -= 4U;
+    }
+    while (words--) {
+        sa += *p++;
+        sb += sa;
+    }
+
+    *a = sa;
+    *b = sb;
+}
+
+static uint32_t W9825G6KH_Snapshot_KBps(uint32_t bytes, uint32_t cycles)
+{
+    if (cycles == 0U) {
+        return 0U;
+    }
+    return (uint32_t)(((uint64_t)bytes * (SystemCoreClock / 1000U)) / cycles);
+}
+
+static void W9825G6KH_Snapshot_CacheClean(const W9825G6KH_SnapRegionTypeDef *r)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)(W9825G6KH_BANK_ADDR + r->Offset), (int32_t)r->Size);
+#else
+    (void)r;
+#endif
+}
+
+static void W9825G6KH_Snapshot_CacheInvalidate(const W9825G6KH_SnapRegionTypeDef *r)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(W9825G6KH_BANK_ADDR + r->Offset), (int32_t)r->Size);
+#else
+    (void)r;
+#endif
+}
+
+static void W9825G6KH_Snapshot_UpdateFootprint(void)
+{
+    snap_stats.Regions = 0;
+    snap_stats.ProtectedBytes = 0;
+    snap_stats.PagesSpanned = 0;
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        const W9825G6KH_SnapRegionTypeDef *r = &snap_regions[i];
+        if (r->State == W9825G6KH_SNAP_REGION_FREE) {
+            continue;
+        }
+        snap_stats.Regions++;
+        snap_stats.ProtectedBytes += r->Size;
+        snap_stats.PagesSpanned += (r->Offset + r->Size - 1U) / W9825G6KH_PAGE_SIZE_BYTES -
+                                   r->Offset / W9825G6KH_PAGE_SIZE_BYTES + 1U;
+    }
+}
+
+/* Lowest registered region not in done_mask, or NULL */
+static W9825G6KH_SnapRegionTypeDef* W9825G6KH_Snapshot_NextLowest(uint32_t done_mask, uint32_t *pId)
+{
+    W9825G6KH_SnapRegionTypeDef *r = NULL;
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        if (snap_regions[i].State != W9825G6KH_SNAP_REGION_FREE && (done_mask & (1UL << i)) == 0U &&
+            (r == NULL || snap_regions[i].Offset < r->Offset)) {
+            r = &snap_regions[i];
+            *pId = i;
+        }
+    }
+    return r;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Registers a region to be preserved across self-refresh
+  * @param  Offset: Region start (offset from SDRAM base, word aligned)
+  * @param  Size: Region size in bytes (multiple of 4)
+  * @param  pId: Receives the region id
+  * @retval W9825G6KH_OK, W9825G6KH_BUSY if every slot is taken
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Register(uint32_t Offset, uint32_t Size, uint32_t *pId)
+{
+    if (pId == NULL || Size == 0 || (Offset % 4U) != 0U || (Size % 4U) != 0U ||
+        Offset >= W9825G6KH_SIZE_BYTES || Size > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        if (snap_regions[i].State == W9825G6KH_SNAP_REGION_FREE) {
+            memset(&snap_regions[i], 0, sizeof(snap_regions[i]));
+            snap_regions[i].Offset = Offset;
+            snap_regions[i].Size = Size;
+            snap_regions[i].State = W9825G6KH_SNAP_REGION_REGISTERED;
+            *pId = i;
+            W9825G6KH_Snapshot_UpdateFootprint();
+            return W9825G6KH_OK;
+        }
+    }
+
+    return W9825G6KH_BUSY;
+}
+
+/**
+  * @brief  Releases a region slot
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Unregister(uint32_t Id)
+{
+    if (Id >= W9825G6KH_SNAPSHOT_MAX_REGIONS || snap_regions[Id].State == W9825G6KH_SNAP_REGION_FREE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    snap_regions[Id].State = W9825G6KH_SNAP_REGION_FREE;
+    W9825G6KH_Snapshot_UpdateFootprint();
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Copies a region descriptor (its offset changes after Compact)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_GetRegion(uint32_t Id, W9825G6KH_SnapRegionTypeDef *region)
+{
+    if (Id >= W9825G6KH_SNAPSHOT_MAX_REGIONS || region == NULL ||
+        snap_regions[Id].State == W9825G6KH_SNAP_REGION_FREE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    *region = snap_regions[Id];
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Packs all registered regions back to back from DestOffset so the
+  *         live data occupies as few rows as possible
+  * @note   Regions are moved down in address order; DestOffset must not be
+  *         above the lowest region. The whole layout is checked before
+  *         anything moves. If a copy fails, that region keeps its old offset
+  *         (its data may be partly overwritten) and later regions are not
+  *         moved. Callers must re-read region offsets with GetRegion
+  *         afterwards.
+  * @param  DestOffset: Start of the packed area (word aligned)
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Compact(uint32_t DestOffset)
+{
+    uint8_t stage[SNAPSHOT_STAGE_BYTES];
+    uint32_t cursor = DestOffset;
+    uint32_t done_mask = 0;
+    uint32_t id = 0;
+    W9825G6KH_SnapRegionTypeDef *r;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if ((DestOffset % 4U) != 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    /* Dry run: every region must sit at or above its packed position */
+    while ((r = W9825G6KH_Snapshot_NextLowest(done_mask, &id)) != NULL) {
+        if (r->Offset < cursor) {
+            return W9825G6KH_INVALID_PARAM;   /* Overlap or DestOffset too high */
+        }
+        cursor += r->Size;
+        done_mask |= 1UL << id;
+    }
+
+    cursor = DestOffset;
+    done_mask = 0;
+    while (status == W9825G6KH_OK && (r = W9825G6KH_Snapshot_NextLowest(done_mask, &id)) != NULL) {
+        /* Staged copy is safe for overlapping moves towards lower addresses */
+        for (uint32_t done = 0; done < r->Size && cursor != r->Offset && status == W9825G6KH_OK; ) {
+            uint32_t len = r->Size - done;
+            if (len > SNAPSHOT_STAGE_BYTES) {
+                len = SNAPSHOT_STAGE_BYTES;
+            }
+            status = W9825G6KH_ReadBuffer(stage, r->Offset + done, len);
+            if (status == W9825G6KH_OK) {
+                status = W9825G6KH_WriteBuffer(stage, cursor + done, len);
+            }
+            done += len;
+        }
+        if (status != W9825G6KH_OK) {
+            break;
+        }
+
+        r->Offset = cursor;
+        r->State = W9825G6KH_SNAP_REGION_REGISTERED;
+        cursor += r->Size;
+        done_mask |= 1UL << id;
+    }
+
+    W9825G6KH_Snapshot_UpdateFootprint();
+    return status;
+}
+
+/**
+  * @brief  Checksums every registered region and enters self-refresh
+  * @retval W9825G6KH status of the self-refresh entry
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Enter(void)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t bytes = 0;
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        W9825G6KH_SnapRegionTypeDef *r = &snap_regions[i];
+        if (r->State == W9825G6KH_SNAP_REGION_FREE) {
+            continue;
+        }
+
+        /* Dirty lines must reach SDRAM before they are summed */
+        W9825G6KH_Snapshot_CacheClean(r);
+        r->SumA = 0;
+        r->SumB = 0;
+        W9825G6KH_Snapshot_Sum(r->Offset, r->Size, &r->SumA, &r->SumB);
+        r->State = W9825G6KH_SNAP_REGION_SEALED;
+        bytes += r->Size;
+    }
+    __DSB();
+
+    snap_stats.ChecksumCycles = W9825G6KH_Perf_GetCycles() - t0;
+    snap_stats.ChecksumKBps = W9825G6KH_Snapshot_KBps(bytes, snap_stats.ChecksumCycles);
+
+    return W9825G6KH_EnterSelfRefresh();
+}
+
+/**
+  * @brief  Leaves self-refresh and arms verification of the sealed regions
+  * @note   SDRAM is usable on return; regions are PENDING until checked
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Exit(void)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    W9825G6KH_StatusTypeDef status = W9825G6KH_ExitSelfRefresh();
+
+    snap_stats.ExitCycles = W9825G6KH_Perf_GetCycles() - t0;
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        W9825G6KH_SnapRegionTypeDef *r = &snap_regions[i];
+        if (r->State == W9825G6KH_SNAP_REGION_SEALED) {
+            /* Lines cached before sleep may not match what SDRAM retained */
+            W9825G6KH_Snapshot_CacheInvalidate(r);
+            r->State = W9825G6KH_SNAP_REGION_PENDING;
+        }
+    }
+
+    snap_verify_pos = 0;
+    snap_verify_a = 0;
+    snap_verify_b = 0;
+    snap_verify_bytes = 0;
+    snap_stats.VerifyCycles = 0;
+    snap_stats.VerifyKBps = 0;
+    snap_stats.CorruptRegions = 0;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Verifies up to MaxBytes of the pending regions
+  * @param  MaxBytes: Budget for this call (0: no limit)
+  * @retval W9825G6KH_BUSY while regions are pending, then W9825G6KH_OK or
+  *         W9825G6KH_ERROR if any region was corrupted
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_VerifyStep(uint32_t MaxBytes)
+{
+    uint32_t t0 = W9825G6KH_Perf_GetCycles();
+    uint32_t budget = (MaxBytes != 0U) ? (MaxBytes & ~3U) : 0xFFFFFFFCU;
+    uint32_t pending = 0;
+
+    if (budget == 0U) {
+        budget = 4U;
+    }
+
+    for (uint32_t i = 0; i < W9825G6KH_SNAPSHOT_MAX_REGIONS; i++) {
+        W9825G6KH_SnapRegionTypeDef *r = &snap_regions[i];
+        uint32_t len;
+
+        if (r->State != W9825G6KH_SNAP_REGION_PENDING) {
+            continue;
+        }
+        if (budget == 0U) {
+            pending = 1;
+            break;
+        }
+
+        len = r->Size - snap_verify_pos;
+        if (len > budget) {
+            len = budget;
+        }
+        W9825G6KH_Snapshot_Sum(r->Offset + snap_verify_pos, len, &snap_verify_a, &snap_verify_b);
+        snap_verify_pos += len;
+        snap_verify_bytes += len;
+        budget -= len;
+
+        if (snap_verify_pos < r->Size) {
+            pending = 1;
+            break;
+        }
+
+        if (snap_verify_a == r->SumA && snap_verify_b == r->SumB) {
+            r->State = W9825G6KH_SNAP_REGION_VALID;
+        } else {
+            r->State = W9825G6KH_SNAP_REGION_CORRUPT;
+            snap_stats.CorruptRegions++;
+            printf("Snapshot region %lu (0x%08lX, %lu bytes) CORRUPT\n", i, r->Offset, r->Size);
+        }
+        snap_verify_pos = 0;
+        snap_verify_a = 0;
+        snap_verify_b = 0;
+    }
+
+    snap_stats.VerifyCycles += W9825G6KH_Perf_GetCycles() - t0;
+    snap_stats.VerifyKBps = W9825G6KH_Snapshot_KBps(snap_verify_bytes, snap_stats.VerifyCycles);
+
+    if (pending) {
+        return W9825G6KH_BUSY;
+    }
+    return (snap_stats.CorruptRegions == 0U) ? W9825G6KH_OK : W9825G6KH_ERROR;
+}
+
+/**
+  * @brief  Blocking wake: leaves self-refresh and verifies every region
+  * @retval W9825G6KH_OK if all regions survived, W9825G6KH_ERROR otherwise
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Wake(void)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_Snapshot_Exit();
+
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+    return W9825G6KH_Snapshot_VerifyStep(0);
+}
+
+/**
+  * @brief  Copies footprint, checksum and wake timing figures
+  */
+void W9825G6KH_Snapshot_GetStats(W9825G6KH_SnapshotStatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = snap_stats;
+    }
+}
@@ -0,0 +1,80 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_snapshot.h
+  * @brief   Low-power snapshot of selected SDRAM regions: checksum on entry
+  *          to self-refresh, verification after wake
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_SNAPSHOT_H
+#define __W9825G6KH_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef W9825G6KH_SNAPSHOT_MAX_REGIONS
+#define W9825G6KH_SNAPSHOT_MAX_REGIONS   8U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_SNAP_REGION_FREE = 0,
+    W9825G6KH_SNAP_REGION_REGISTERED,   /* No checksum taken yet */
+    W9825G6KH_SNAP_REGION_SEALED,       /* Checksummed, SDRAM in self-refresh */
+    W9825G6KH_SNAP_REGION_PENDING,      /* Awake, not verified yet */
+    W9825G6KH_SNAP_REGION_VALID,
+    W9825G6KH_SNAP_REGION_CORRUPT
+} W9825G6KH_SnapRegionStateTypeDef;
+
+typedef struct {
+    uint32_t Offset;             /* Offset from SDRAM base (word aligned) */
+    uint32_t Size;               /* Bytes (multiple of 4) */
+    uint32_t SumA;               /* Fletcher-style word sums taken on entry */
+    uint32_t SumB;
+    W9825G6KH_SnapRegionStateTypeDef State;
+} W9825G6KH_SnapRegionTypeDef;
+
+typedef struct {
+    uint32_t Regions;
+    uint32_t ProtectedBytes;
+    uint32_t PagesSpanned;       /* 512-byte pages holding registered data */
+    uint32_t ChecksumCycles;     /* Entry: cycles spent checksumming */
+    uint32_t ChecksumKBps;
+    uint32_t ExitCycles;         /* Wake: until SDRAM accepts accesses again */
+    uint32_t VerifyCycles;       /* Wake: verification time, all steps */
+    uint32_t VerifyKBps;
+    uint32_t CorruptRegions;
+} W9825G6KH_SnapshotStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Register(uint32_t Offset, uint32_t Size, uint32_t *pId);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Unregister(uint32_t Id);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_GetRegion(uint32_t Id, W9825G6KH_SnapRegionTypeDef *region);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Compact(uint32_t DestOffset);
+
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Enter(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Exit(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_VerifyStep(uint32_t MaxBytes);
+W9825G6KH_StatusTypeDef W9825G6KH_Snapshot_Wake(void);
+
+void W9825G6KH_Snapshot_GetStats(W9825G6KH_SnapshotStatsTypeDef *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_SNAPSHOT_H */
@@ -0,0 +1,603 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_sort.c
+  * @brief   External-memory sort and static search index for record arrays
+  *          resident in W9825G6KH SDRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Sorting in place in SDRAM jumps between rows on almost every compare.
+  * W9825G6KH_Sort treats SRAM as the fast tier instead:
+  *
+  *  1. Run generation: the array is loaded one workspace at a time (page
+  *     bursts through W9825G6KH_ReadRect, so DMA2D when blits use it),
+  *     sorted in SRAM and stored back as a sorted run.
+  *  2. Merge passes: the workspace is split into up to
+  *     W9825G6KH_SORT_MAX_WAYS input buffers and one output buffer. Each
+  *     pass merges groups of runs from one SDRAM area into the other with a
+  *     heap over the run heads; SDRAM only ever sees whole-buffer sequential
+  *     reads and writes.
+  *
+  * Passes alternate between the array and the scratch area; runs are
+  * placed so the last pass ends in the array. Runs are merged in order and
+  * ties go to the earlier run.
+  *
+  * The search index stores keys in Eytzinger (breadth-first) order. A
+  * lookup touches one entry per level, children of neighbouring nodes
+  * share a cache line, and the top levels are served from SRAM.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_sort.h"
+#include "w9825g6kh_perf.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SORT_BENCH_LOOKUPS           100000U
+#define SORT_INDEX_ALIGN             32U         /* Cache line */
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint8_t *pBuf;
+    uint32_t Len;                /* Records in the buffer */
+    uint32_t Pos;                /* Next record in the buffer */
+    uint32_t Next;               /* SDRAM offset of the next unread record */
+    uint32_t Left;               /* Records not yet loaded */
+} W9825G6KH_Sort_CursorTypeDef;
+
+typedef struct {
+    uint32_t RecordSize;
+    W9825G6KH_SortCompareTypeDef Compare;
+    uint8_t *pWork;
+    uint32_t BufRecords;         /* Records per merge buffer */
+} W9825G6KH_Sort_ContextTypeDef;
+
+typedef struct {
+    uint32_t Key;
+    uint32_t Seq;
+    uint32_t Pad[2];
+} W9825G6KH_Sort_BenchRecordTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_SortStatsTypeDef sort_stats;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Moves bytes between SRAM and SDRAM as whole-page bursts plus a tail
+  * @param  write: 1 for SRAM -> SDRAM
+  * @retval W9825G6KH status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_Sort_Move(uint8_t *buf, uint32_t offset, uint32_t bytes, uint32_t write)
+{
+    W9825G6KH_RectTypeDef rect = { W9825G6KH_PAGE_SIZE_BYTES / 4U, bytes / W9825G6KH_PAGE_SIZE_BYTES, 4U };
+    uint32_t head = rect.Height * W9825G6KH_PAGE_SIZE_BYTES;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (rect.Height != 0U) {
+        status = write ? W9825G6KH_WriteRect(buf, W9825G6KH_PAGE_SIZE_BYTES, offset, W9825G6KH_PAGE_SIZE_BYTES, &rect)
+                       : W9825G6KH_ReadRect(buf, W9825G6KH_PAGE_SIZE_BYTES, offset, W9825G6KH_PAGE_SIZE_BYTES, &rect);
+    }
+    if (status == W9825G6KH_OK && bytes > head) {
+        status = write ? W9825G6KH_WriteBuffer(buf + head, offset + head, bytes - head)
+                       : W9825G6KH_ReadBuffer(buf + head, offset + head, bytes - head);
+    }
+
+    return status;
+}
+
+static W9825G6KH_StatusTypeDef W9825G6KH_Sort_Refill(const W9825G6KH_Sort_ContextTypeDef *ctx,
+                                                     W9825G6KH_Sort_CursorTypeDef *cur)
+{
+    uint32_t n = (cur->Left < ctx->BufRecords) ? cur->Left : ctx->BufRecords;
+
+    cur->Len = n;
+    cur->Pos = 0;
+    cur->Left -= n;
+    cur->Next += n * ctx->RecordSize;
+
+    return W9825G6KH_Sort_Move(cur->pBuf, cur->Next - n * ctx->RecordSize, n * ctx->RecordSize, 0);
+}
+
+/* Heap order: smaller record first, earlier run on ties */
+static inline uint32_t W9825G6KH_Sort_Less(const W9825G6KH_Sort_ContextTypeDef *ctx,
+                                           const W9825G6KH_Sort_CursorTypeDef *cur, uint8_t a, uint8_t b)
+{
+    int c = ctx->Compare(cur[a].pBuf + cur[a].Pos * ctx->RecordSize, cur[b].pBuf + cur[b].Pos * ctx->RecordSize);
+
+    return (c < 0 || (c == 0 && a < b)) ? 1U : 0U;
+}
+
+static void W9825G6KH_Sort_SiftDown(const W9825G6KH_Sort_ContextTypeDef *ctx, const W9825G6KH_Sort_CursorTypeDef *cur,
+                                    uint8_t *heap, uint32_t n, uint32_t i)
+{
+    uint8_t top = heap[i];
+
+    for (;;) {
+        uint32_t child = 2U * i + 1U;
+
+        if (child >= n) {
+            break;
+        }
+        if (child + 1U < n && W9825G6KH_Sort_Less(ctx, cur, heap[child + 1U], heap[child])) {
+            child++;
+        }
+        if (!W9825G6KH_Sort_Less(ctx, cur, heap[child], top)) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = top;
+}
+
+/**
+  * @brief  Merges up to 'ways' consecutive runs starting at record 'first'
+  * @param  src: SDRAM offset of the source area
+  * @param  dst: SDRAM offset of the destination area
+  * @param  run_len: Records per run (the last run may be shorter)
+  * @param  count: Records in the whole array
+  * @retval W9825G6KH status
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_Sort_Merge(const W9825G6KH_Sort_ContextTypeDef *ctx, uint32_t src, uint32_t dst,
+                                                    uint32_t first, uint32_t ways, uint32_t run_len, uint32_t count)
+{
+    W9825G6KH_Sort_CursorTypeDef cur[W9825G6KH_SORT_MAX_WAYS];
+    uint8_t heap[W9825G6KH_SORT_MAX_WAYS];
+    uint32_t rs = ctx->RecordSize;
+    uint8_t *pOut = ctx->pWork + ways * ctx->BufRecords * rs;
+    uint32_t out_off = dst + first * rs;
+    uint32_t out_n = 0;
+    uint32_t n = 0;
+    W9825G6KH_StatusTypeDef status;
+
+    for (uint32_t w = 0; w < ways; w++) {
+        uint32_t start = first + w * run_len;
+
+        cur[w].pBuf = ctx->pWork + w * ctx->BufRecords * rs;
+        cur[w].Next = src + start * rs;
+        cur[w].Left = (count - start < run_len) ? count - start : run_len;
+        status = W9825G6KH_Sort_Refill(ctx, &cur[w]);
+        if (status != W9825G6KH_OK) {
+            return status;
+        }
+        heap[n++] = (uint8_t)w;
+    }
+    for (uint32_t i = n / 2U; i-- > 0U;) {
+        W9825G6KH_Sort_SiftDown(ctx, cur, heap, n, i);
+    }
+
+    while (n > 0U) {
+        W9825G6KH_Sort_CursorTypeDef *c = &cur[heap[0]];
+
+        memcpy(pOut + out_n * rs, c->pBuf + c->Pos * rs, rs);
+        if (++out_n == ctx->BufRecords) {
+            status = W9825G6KH_Sort_Move(pOut, out_off, out_n * rs, 1);
+            if (status != W9825G6KH_OK) {
+                return status;
+            }
+            out_off += out_n * rs;
+            out_n = 0;
+        }
+
+        if (++c->Pos == c->Len) {
+            if (c->Left != 0U) {
+                status = W9825G6KH_Sort_Refill(ctx, c);
+                if (status != W9825G6KH_OK) {
+                    return status;
+                }
+            } else {
+                heap[0] = heap[--n];
+            }
+        }
+        W9825G6KH_Sort_SiftDown(ctx, cur, heap, n, 0);
+    }
+
+    return (out_n != 0U) ? W9825G6KH_Sort_Move(pOut, out_off, out_n * rs, 1) : W9825G6KH_OK;
+}
+
+static uint32_t W9825G6KH_Sort_IndexFill(W9825G6KH_SortIndexEntryTypeDef *entries, uint32_t count,
+                                         const uint8_t *keys, uint32_t stride, uint32_t k, uint32_t i)
+{
+    /* In-order walk: node k gets the i-th smallest key. Depth is log2(count). */
+    if (k <= count) {
+        i = W9825G6KH_Sort_IndexFill(entries, count, keys, stride, 2U * k, i);
+        entries[k].Key = *(const uint32_t *)(keys + i * stride);
+        entries[k].Value = i;
+        i++;
+        i = W9825G6KH_Sort_IndexFill(entries, count, keys, stride, 2U * k + 1U, i);
+    }
+
+    return i;
+}
+
+static int W9825G6KH_Sort_BenchCompare(const void *a, const void *b)
+{
+    uint32_t ka = ((const W9825G6KH_Sort_BenchRecordTypeDef *)a)->Key;
+    uint32_t kb = ((const W9825G6KH_Sort_BenchRecordTypeDef *)b)->Key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+static void W9825G6KH_Sort_BenchFill(W9825G6KH_Sort_BenchRecordTypeDef *rec, uint32_t count)
+{
+    uint32_t x = 0x2545F491U;
+
+    for (uint32_t i = 0; i < count; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        rec[i].Key = x;
+        rec[i].Seq = i;
+        rec[i].Pad[0] = ~x;
+        rec[i].Pad[1] = 0;
+    }
+    __DSB();
+}
+
+static uint32_t W9825G6KH_Sort_BenchCheck(const W9825G6KH_Sort_BenchRecordTypeDef *rec, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        if (rec[i].Pad[0] != ~rec[i].Key || (i > 0U && rec[i - 1U].Key > rec[i].Key)) {
+            return 0U;
+        }
+    }
+    return 1U;
+}
+
+/* Plain lower bound over the sorted records, straight from SDRAM */
+static uint32_t W9825G6KH_Sort_BenchBinary(const W9825G6KH_Sort_BenchRecordTypeDef *rec, uint32_t count, uint32_t key)
+{
+    uint32_t lo = 0;
+    uint32_t hi = count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2U;
+
+        if (rec[mid].Key < key) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Sorts an array of fixed-size records in SDRAM
+  * @note   Arrays that fit in the workspace are sorted in one load/store.
+  *         Larger ones need a scratch area of the same size that does not
+  *         overlap the array; it is overwritten.
+  * @param  Offset: Array offset in SDRAM (4-byte aligned)
+  * @param  Count: Records
+  * @param  RecordSize: Bytes per record (multiple of 4)
+  * @param  Compare: qsort-style comparison
+  * @param  ScratchOffset: Scratch area offset (4-byte aligned)
+  * @param  pWork: SRAM workspace (4-byte aligned, reachable by DMA2D when
+  *         blits use it). Larger is faster: it sets the run length and the
+  *         merge buffer sizes.
+  * @param  WorkSize: Workspace size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Sort(uint32_t Offset, uint32_t Count, uint32_t RecordSize,
+                                       W9825G6KH_SortCompareTypeDef Compare, uint32_t ScratchOffset,
+                                       uint8_t *pWork, uint32_t WorkSize)
+{
+    W9825G6KH_Sort_ContextTypeDef ctx;
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+    uint32_t t0 = HAL_GetTick();
+    uint32_t run_len, runs, ways = 0, passes = 0, bytes, unit, area, src, dst, t1;
+
+    if (Compare == NULL || pWork == NULL || Count == 0U || RecordSize == 0U ||
+        (RecordSize & 3U) != 0U || (Offset & 3U) != 0U || ((uint32_t)(uintptr_t)pWork & 3U) != 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (Offset >= W9825G6KH_SIZE_BYTES || (uint64_t)Count * RecordSize > W9825G6KH_SIZE_BYTES - Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    bytes = Count * RecordSize;
+
+    run_len = WorkSize / RecordSize;
+    if (run_len == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    runs = (Count + run_len - 1U) / run_len;
+
+    if (runs > 1U) {
+        if ((ScratchOffset & 3U) != 0U || ScratchOffset >= W9825G6KH_SIZE_BYTES ||
+            bytes > W9825G6KH_SIZE_BYTES - ScratchOffset ||
+            (ScratchOffset < Offset + bytes && Offset < ScratchOffset + bytes)) {
+            return W9825G6KH_INVALID_PARAM;
+        }
+
+        /* Each merge buffer should hold at least a page (or one record) */
+        unit = (RecordSize > W9825G6KH_PAGE_SIZE_BYTES) ? RecordSize : W9825G6KH_PAGE_SIZE_BYTES;
+        ways = WorkSize / unit;
+        ways = (ways > 0U) ? ways - 1U : 0U;
+        if (ways > W9825G6KH_SORT_MAX_WAYS) {
+            ways = W9825G6KH_SORT_MAX_WAYS;
+        }
+        if (ways > runs) {
+            ways = runs;
+        }
+        if (ways < 2U) {
+            return W9825G6KH_INVALID_PARAM;   /* Workspace too small to merge */
+        }
+        for (uint32_t r = runs; r > 1U; r = (r + ways - 1U) / ways) {
+            passes++;
+        }
+    }
+
+    memset(&sort_stats, 0, sizeof(sort_stats));
+    sort_stats.Records = Count;
+    sort_stats.Runs = runs;
+    sort_stats.Ways = ways;
+    sort_stats.Passes = passes;
+
+    /* Runs go where an even number of passes leaves the result in the array */
+    area = (passes & 1U) ? ScratchOffset : Offset;
+    for (uint32_t first = 0; first < Count && status == W9825G6KH_OK; first += run_len) {
+        uint32_t n = (Count - first < run_len) ? Count - first : run_len;
+
+        status = W9825G6KH_Sort_Move(pWork, Offset + first * RecordSize, n * RecordSize, 0);
+        if (status == W9825G6KH_OK) {
+            qsort(pWork, n, RecordSize, Compare);
+            status = W9825G6KH_Sort_Move(pWork, area + first * RecordSize, n * RecordSize, 1);
+        }
+    }
+    t1 = HAL_GetTick();
+    sort_stats.RunMs = t1 - t0;
+
+    ctx.RecordSize = RecordSize;
+    ctx.Compare = Compare;
+    ctx.pWork = pWork;
+    ctx.BufRecords = (WorkSize / (ways + 1U)) / RecordSize;
+
+    src = area;
+    dst = (area == Offset) ? ScratchOffset : Offset;
+    for (uint32_t p = 0; p < passes && status == W9825G6KH_OK; p++) {
+        for (uint32_t first = 0; first < Count && status == W9825G6KH_OK; first += run_len * ways) {
+            uint32_t left = (Count - first + run_len - 1U) / run_len;
+
+            status = W9825G6KH_Sort_Merge(&ctx, src, dst, first, (left < ways) ? left : ways, run_len, Count);
+        }
+        run_len = (run_len > Count / ways) ? Count : run_len * ways;
+        area = src;
+        src = dst;
+        dst = area;
+    }
+
+    sort_stats.MergeMs = HAL_GetTick() - t1;
+    sort_stats.TotalMs = HAL_GetTick() - t0;
+
+    return status;
+}
+
+void W9825G6KH_Sort_GetStats(W9825G6KH_SortStatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = sort_stats;
+    }
+}
+
+/**
+  * @brief  Builds an Eytzinger index over sorted 32-bit keys in SDRAM
+  * @param  index: Index descriptor to fill
+  * @param  IndexOffset: (Count + 1) * 8 bytes in SDRAM, 32-byte aligned
+  * @param  KeysOffset: First key; keys must be in ascending order
+  * @param  KeyStride: Bytes between keys (4 for a plain key array, the
+  *         record size to index a field of sorted records)
+  * @param  Count: Keys
+  * @param  pTop: SRAM for the top levels (may be NULL)
+  * @param  TopCapacity: Words at pTop; the largest full tree that fits is used
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Sort_IndexBuild(W9825G6KH_SortIndexTypeDef *index, uint32_t IndexOffset,
+                                                  uint32_t KeysOffset, uint32_t KeyStride, uint32_t Count,
+                                                  uint32_t *pTop, uint32_t TopCapacity)
+{
+    W9825G6KH_SortIndexEntryTypeDef *entries;
+    uint32_t top;
+
+    if (index == NULL || Count == 0U || Count >= 0x7FFFFFFFU || KeyStride < 4U ||
+        (KeysOffset & 3U) != 0U || (KeyStride & 3U) != 0U || (IndexOffset & (SORT_INDEX_ALIGN - 1U)) != 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (IndexOffset >= W9825G6KH_SIZE_BYTES ||
+        (uint64_t)(Count + 1U) * sizeof(W9825G6KH_SortIndexEntryTypeDef) > W9825G6KH_SIZE_BYTES - IndexOffset ||
+        KeysOffset >= W9825G6KH_SIZE_BYTES ||
+        (uint64_t)(Count - 1U) * KeyStride + 4U > W9825G6KH_SIZE_BYTES - KeysOffset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (!W9825G6KH_IsReady()) {
+        return W9825G6KH_ERROR;
+    }
+
+    entries = (W9825G6KH_SortIndexEntryTypeDef *)(W9825G6KH_BANK_ADDR + IndexOffset);
+    (void)W9825G6KH_Sort_IndexFill(entries, Count, (const uint8_t *)(W9825G6KH_BANK_ADDR + KeysOffset), KeyStride, 1U, 0U);
+    entries[0].Key = 0;
+    entries[0].Value = Count;
+    __DSB();
+
+    top = 0;
+    if (pTop != NULL) {
+        if (TopCapacity > Count) {
+            TopCapacity = Count;
+        }
+        while (2U * top + 1U <= TopCapacity) {
+            top = 2U * top + 1U;
+        }
+        for (uint32_t k = 1; k <= top; k++) {
+            pTop[k - 1U] = entries[k].Key;
+        }
+    }
+
+    index->Offset = IndexOffset;
+    index->Count = Count;
+    index->pTop = pTop;
+    index->TopCount = top;
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Finds the first key not less than Key
+  * @param  pKey: Found key (may be NULL)
+  * @param  pValue: Its position in the sorted source (may be NULL)
+  * @retval 1 if found, 0 if every key is less than Key
+  */
+uint32_t W9825G6KH_Sort_IndexLowerBound(const W9825G6KH_SortIndexTypeDef *index, uint32_t Key,
+                                        uint32_t *pKey, uint32_t *pValue)
+{
+    const W9825G6KH_SortIndexEntryTypeDef *entries =
+        (const W9825G6KH_SortIndexEntryTypeDef *)(W9825G6KH_BANK_ADDR + index->Offset);
+    uint32_t k = 1;
+
+    while (k <= index->TopCount) {
+        k = 2U * k + ((index->pTop[k - 1U] < Key) ? 1U : 0U);
+    }
+    while (k <= index->Count) {
+        /* Nodes 4k .. 4k+3 share a line: fetch two levels ahead */
+        __builtin_prefetch(&entries[4U * k]);
+        k = 2U * k + ((entries[k].Key < Key) ? 1U : 0U);
+    }
+
+    /* Undo the right turns taken after the last left turn */
+    k >>= (uint32_t)__builtin_ffs((int)~k);
+    if (k == 0U) {
+        return 0U;
+    }
+
+    if (pKey != NULL) {
+        *pKey = entries[k].Key;
+    }
+    if (pValue != NULL) {
+        *pValue = entries[k].Value;
+    }
+    return 1U;
+}
+
+/**
+  * @brief  Finds an exact key
+  * @param  pValue: Position of its first occurrence in the sorted source
+  * @retval W9825G6KH_OK, or W9825G6KH_ERROR if absent
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Sort_IndexFind(const W9825G6KH_SortIndexTypeDef *index, uint32_t Key,
+                                                 uint32_t *pValue)
+{
+    uint32_t found;
+
+    if (index == NULL || index->Count == 0U) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    if (!W9825G6KH_Sort_IndexLowerBound(index, Key, &found, pValue) || found != Key) {
+        return W9825G6KH_ERROR;
+    }
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Compares qsort in place in SDRAM with W9825G6KH_Sort, then
+  *         binary search in SDRAM with the Eytzinger index, on random
+  *         16-byte records
+  * @param  Offset: Array area, Count * 16 bytes (overwritten)
+  * @param  Count: Records
+  * @param  ScratchOffset: Scratch area of the same size (overwritten; also
+  *         holds the index afterwards, so 32-byte aligned)
+  * @param  pWork: SRAM workspace (its start also holds the top levels)
+  * @param  WorkSize: Workspace size in bytes
+  * @retval None
+  */
+void W9825G6KH_Sort_Benchmark(uint32_t Offset, uint32_t Count, uint32_t ScratchOffset,
+                              uint8_t *pWork, uint32_t WorkSize)
+{
+    W9825G6KH_Sort_BenchRecordTypeDef *rec;
+    W9825G6KH_SortIndexTypeDef index;
+    uint32_t naive_ms, ext_ms, naive_cyc, index_cyc, t0;
+    uint32_t x = 0x9E3779B9U;
+    uint32_t mismatch = 0;
+    uint32_t sink = 0;
+    W9825G6KH_StatusTypeDef status;
+
+    if (Count < 2U || (Offset & 3U) != 0U || Offset >= W9825G6KH_SIZE_BYTES ||
+        (uint64_t)Count * sizeof(*rec) > W9825G6KH_SIZE_BYTES - Offset) {
+        printf("Sort benchmark: invalid parameters\r\n");
+        return;
+    }
+    if (!W9825G6KH_IsReady()) {
+        printf("Sort benchmark: SDRAM not ready\r\n");
+        return;
+    }
+    rec = (W9825G6KH_Sort_BenchRecordTypeDef *)(W9825G6KH_BANK_ADDR + Offset);
+
+    printf("\r\n=== SDRAM Sort (%lu records of %u bytes, %lu KB SRAM) ===\r\n",
+           (unsigned long)Count, (unsigned)sizeof(*rec), (unsigned long)(WorkSize / 1024U));
+
+    W9825G6KH_Sort_BenchFill(rec, Count);
+    t0 = HAL_GetTick();
+    qsort(rec, Count, sizeof(*rec), W9825G6KH_Sort_BenchCompare);
+    __DSB();
+    naive_ms = HAL_GetTick() - t0;
+    printf("qsort in SDRAM:   %8lu ms %s\r\n", (unsigned long)naive_ms,
+           W9825G6KH_Sort_BenchCheck(rec, Count) ? "" : "(NOT SORTED)");
+
+    W9825G6KH_Sort_BenchFill(rec, Count);
+    t0 = HAL_GetTick();
+    status = W9825G6KH_Sort(Offset, Count, sizeof(*rec), W9825G6KH_Sort_BenchCompare, ScratchOffset, pWork, WorkSize);
+    ext_ms = HAL_GetTick() - t0;
+    if (status != W9825G6KH_OK) {
+        printf("External sort failed: %s\r\n", W9825G6KH_StatusToString(status));
+        return;
+    }
+    printf("External sort:    %8lu ms %s (%lu runs, %lu-way, %lu passes; runs %lu ms, merge %lu ms)\r\n",
+           (unsigned long)ext_ms, W9825G6KH_Sort_BenchCheck(rec, Count) ? "" : "(NOT SORTED)",
+           (unsigned long)sort_stats.Runs, (unsigned long)sort_stats.Ways, (unsigned long)sort_stats.Passes,
+           (unsigned long)sort_stats.RunMs, (unsigned long)sort_stats.MergeMs);
+    if (ext_ms != 0U) {
+        printf("Speedup:          %5lu.%02lu x\r\n", (unsigned long)(naive_ms / ext_ms),
+               (unsigned long)((naive_ms % ext_ms) * 100U / ext_ms));
+    }
+
+    status = W9825G6KH_Sort_IndexBuild(&index, ScratchOffset, Offset, sizeof(*rec), Count,
+                                       (uint32_t *)pWork, WorkSize / 4U);
+    if (status != W9825G6KH_OK) {
+        printf("Index build failed: %s\r\n", W9825G6KH_StatusToString(status));
+        return;
+    }
+
+    /* Same keys for both: half present, half random */
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < SORT_BENCH_LOOKUPS; i++) {
+        x = x * 1664525U + 1013904223U;
+        sink += W9825G6KH_Sort_BenchBinary(rec, Count, (i & 1U) ? x : rec[x % Count].Key);
+    }
+    naive_cyc = W9825G6KH_Perf_GetCycles() - t0;
+
+    x = 0x9E3779B9U;
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t i = 0; i < SORT_BENCH_LOOKUPS; i++) {
+        uint32_t value = Count;
+
+        x = x * 1664525U + 1013904223U;
+        (void)W9825G6KH_Sort_IndexLowerBound(&index, (i & 1U) ? x : rec[x % Count].Key, NULL, &value);
+        sink -= value;
+    }
+    index_cyc = W9825G6KH_Perf_GetCycles() - t0;
+    mismatch = sink;
+
+    printf("Binary search:    %8lu cycles/lookup\r\n", (unsigned long)(naive_cyc / SORT_BENCH_LOOKUPS));
+    printf("Eytzinger index:  %8lu cycles/lookup (%lu top nodes in SRAM) %s\r\n",
+           (unsigned long)(index_cyc / SORT_BENCH_LOOKUPS), (unsigned long)index.TopCount,
+           (mismatch == 0U) ? "" : "(RESULTS DIFFER)");
+}
@@ -0,0 +1,85 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_sort.h
+  * @brief   External-memory sort and static search index for record arrays
+  *          resident in W9825G6KH SDRAM, using SRAM as the fast tier
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_SORT_H
+#define __W9825G6KH_SORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest merge fan-in; the workspace is split into this many input buffers
+ * plus one output buffer */
+#ifndef W9825G6KH_SORT_MAX_WAYS
+#define W9825G6KH_SORT_MAX_WAYS          16U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* qsort-style comparison of two records */
+typedef int (*W9825G6KH_SortCompareTypeDef)(const void *a, const void *b);
+
+typedef struct {
+    uint32_t Records;
+    uint32_t Runs;               /* Sorted runs produced (one per workspace fill) */
+    uint32_t Ways;               /* Merge fan-in used */
+    uint32_t Passes;             /* Merge passes over the data */
+    uint32_t RunMs;              /* Load, sort in SRAM, store */
+    uint32_t MergeMs;
+    uint32_t TotalMs;
+} W9825G6KH_SortStatsTypeDef;
+
+/* Entry of the Eytzinger-ordered index in SDRAM */
+typedef struct {
+    uint32_t Key;
+    uint32_t Value;              /* Position of the key in the sorted source array */
+} W9825G6KH_SortIndexEntryTypeDef;
+
+/* Static search index: keys in breadth-first (Eytzinger) order, so a lookup
+ * walks down one cache line per level. The top levels are kept in SRAM. */
+typedef struct {
+    uint32_t Offset;             /* (Count + 1) entries in SDRAM; entry 0 unused */
+    uint32_t Count;
+    uint32_t *pTop;              /* Keys of nodes 1 .. TopCount, in SRAM */
+    uint32_t TopCount;
+} W9825G6KH_SortIndexTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Sort(uint32_t Offset, uint32_t Count, uint32_t RecordSize,
+                                       W9825G6KH_SortCompareTypeDef Compare, uint32_t ScratchOffset,
+                                       uint8_t *pWork, uint32_t WorkSize);
+void W9825G6KH_Sort_GetStats(W9825G6KH_SortStatsTypeDef *stats);
+
+W9825G6KH_StatusTypeDef W9825G6KH_Sort_IndexBuild(W9825G6KH_SortIndexTypeDef *index, uint32_t IndexOffset,
+                                                  uint32_t KeysOffset, uint32_t KeyStride, uint32_t Count,
+                                                  uint32_t *pTop, uint32_t TopCapacity);
+uint32_t W9825G6KH_Sort_IndexLowerBound(const W9825G6KH_SortIndexTypeDef *index, uint32_t Key,
+                                        uint32_t *pKey, uint32_t *pValue);
+W9825G6KH_StatusTypeDef W9825G6KH_Sort_IndexFind(const W9825G6KH_SortIndexTypeDef *index, uint32_t Key,
+                                                 uint32_t *pValue);
+
+void W9825G6KH_Sort_Benchmark(uint32_t Offset, uint32_t Count, uint32_t ScratchOffset,
+                              uint8_t *pWork, uint32_t WorkSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_SORT_H */
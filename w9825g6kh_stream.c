@@ -0,0 +1,411 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_stream.c
+  * @brief   Chunked streaming API for SDRAM transfers larger than SRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * A stream owns a ring of NumChunks SRAM chunks. The data side (caller,
+  * UART/SPI/USB DMA) acquires and releases chunks; W9825G6KH_Stream_Process
+  * moves chunks between the ring and SDRAM. Because the two sides work on
+  * different chunks, a source can be filling chunk N by DMA while chunk N-1
+  * is being copied to SDRAM. When every chunk is busy, AcquireChunk returns
+  * NULL: that is the back-pressure signal.
+  *
+  * The ring is single-producer/single-consumer: Acquire/Release may run in
+  * one context (including an ISR) and Process in another, lock-free.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_stream.h"
+#include "w9825g6kh_atomic.h"
+#include "w9825g6kh_perf.h"
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint8_t* W9825G6KH_Stream_Chunk(W9825G6KH_StreamTypeDef *stream, uint32_t index)
+{
+    return stream->Config.pChunkMemory + (index % stream->Config.NumChunks) * stream->Config.ChunkSize;
+}
+
+static uint32_t W9825G6KH_Stream_Min(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+static void W9825G6KH_Stream_MarkEnd(W9825G6KH_StreamTypeDef *stream)
+{
+    if (stream->EndCycles == 0U) {
+        stream->EndCycles = W9825G6KH_Perf_GetCycles();
+        if (stream->EndCycles == 0U) {
+            stream->EndCycles = 1U;
+        }
+    }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Opens a stream over an SDRAM range
+  * @param  stream: Caller-owned stream object
+  * @param  config: Direction, range and chunk ring
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Open(W9825G6KH_StreamTypeDef *stream, const W9825G6KH_StreamConfigTypeDef *config)
+{
+    if (stream == NULL || config == NULL || config->pChunkMemory == NULL ||
+        config->ChunkSize == 0 || config->NumChunks < 2U ||
+        config->NumChunks > W9825G6KH_STREAM_MAX_CHUNKS) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (config->Length == 0 || config->Offset >= W9825G6KH_SIZE_BYTES ||
+        config->Length > W9825G6KH_SIZE_BYTES - config->Offset) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->Config = *config;
+    stream->StartCycles = W9825G6KH_Perf_GetCycles();
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Gets the next chunk for the data side
+  * @note   WRITE: an empty chunk to fill, *len = its capacity.
+  *         READ: the unconsumed part of the oldest chunk holding SDRAM
+  *         data, *len = bytes available.
+  * @param  stream: Open stream
+  * @param  len: Receives the usable length
+  * @retval Chunk pointer, or NULL when the ring is full/empty or the stream
+  *         has ended
+  */
+uint8_t* W9825G6KH_Stream_AcquireChunk(W9825G6KH_StreamTypeDef *stream, uint32_t *len)
+{
+    uint32_t head, tail;
+
+    if (stream == NULL || len == NULL) {
+        return NULL;
+    }
+    *len = 0;
+
+    head = W9825G6KH_AtomicLoad32(&stream->Head);
+    tail = W9825G6KH_AtomicLoad32(&stream->Tail);
+
+    if (stream->Config.Direction == W9825G6KH_STREAM_WRITE) {
+        if (stream->UserBytes >= stream->Config.Length) {
+            return NULL;
+        }
+        if (head - tail >= stream->Config.NumChunks) {
+            stream->Stats.Stalls++;
+            return NULL;
+        }
+        *len = W9825G6KH_Stream_Min(stream->Config.ChunkSize, stream->Config.Length - stream->UserBytes);
+        return W9825G6KH_Stream_Chunk(stream, head);
+    }
+
+    if (head == tail) {
+        if (stream->UserBytes < stream->Config.Length) {
+            stream->Stats.Stalls++;
+        }
+        return NULL;
+    }
+    *len = stream->ChunkLen[tail % stream->Config.NumChunks] - stream->ReadPos;
+    return W9825G6KH_Stream_Chunk(stream, tail) + stream->ReadPos;
+}
+
+/**
+  * @brief  Returns the chunk obtained with AcquireChunk
+  * @param  stream: Open stream
+  * @param  len: WRITE: bytes placed in the chunk. READ: bytes consumed from
+  *         the front of what AcquireChunk returned; the chunk goes back to
+  *         the ring once all of it has been consumed
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_ReleaseChunk(W9825G6KH_StreamTypeDef *stream, uint32_t len)
+{
+    uint32_t head, tail;
+
+    if (stream == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    head = W9825G6KH_AtomicLoad32(&stream->Head);
+    tail = W9825G6KH_AtomicLoad32(&stream->Tail);
+
+    if (stream->Config.Direction == W9825G6KH_STREAM_WRITE) {
+        if (len == 0) {
+            return W9825G6KH_OK;
+        }
+        if (head - tail >= stream->Config.NumChunks ||
+            len > W9825G6KH_Stream_Min(stream->Config.ChunkSize, stream->Config.Length - stream->UserBytes)) {
+            return W9825G6KH_INVALID_PARAM;
+        }
+        stream->ChunkLen[head % stream->Config.NumChunks] = len;
+        stream->UserBytes += len;
+        W9825G6KH_AtomicStore32(&stream->Head, head + 1U);
+        return W9825G6KH_OK;
+    }
+
+    if (head == tail || len > stream->ChunkLen[tail % stream->Config.NumChunks] - stream->ReadPos) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    stream->UserBytes += len;
+    stream->ReadPos += len;
+    if (stream->ReadPos == stream->ChunkLen[tail % stream->Config.NumChunks]) {
+        stream->ReadPos = 0;
+        W9825G6KH_AtomicStore32(&stream->Tail, tail + 1U);
+    }
+    if (stream->UserBytes >= stream->Config.Length) {
+        W9825G6KH_Stream_MarkEnd(stream);
+    }
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  SDRAM side of the pipeline: drains committed chunks (WRITE) or
+  *         refills free chunks (READ). Call from the main loop or a task.
+  * @param  stream: Open stream
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Process(W9825G6KH_StreamTypeDef *stream)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (stream == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (stream->Config.Direction == W9825G6KH_STREAM_WRITE) {
+        uint32_t tail = W9825G6KH_AtomicLoad32(&stream->Tail);
+
+        while (status == W9825G6KH_OK && tail != W9825G6KH_AtomicLoad32(&stream->Head)) {
+            uint32_t len = stream->ChunkLen[tail % stream->Config.NumChunks];
+            uint32_t t0 = W9825G6KH_Perf_GetCycles();
+
+            status = W9825G6KH_WriteBuffer(W9825G6KH_Stream_Chunk(stream, tail),
+                                           stream->Config.Offset + stream->SdramBytes, len);
+            stream->Stats.SdramCycles += W9825G6KH_Perf_GetCycles() - t0;
+            if (status != W9825G6KH_OK) {
+                break;
+            }
+
+            stream->SdramBytes += len;
+            stream->Stats.Chunks++;
+            W9825G6KH_AtomicStore32(&stream->Tail, ++tail);
+        }
+
+        if (stream->SdramBytes >= stream->Config.Length) {
+            W9825G6KH_Stream_MarkEnd(stream);
+        }
+        return status;
+    }
+
+    uint32_t head = W9825G6KH_AtomicLoad32(&stream->Head);
+
+    while (stream->SdramBytes < stream->Config.Length &&
+           head - W9825G6KH_AtomicLoad32(&stream->Tail) < stream->Config.NumChunks) {
+        uint32_t len = W9825G6KH_Stream_Min(stream->Config.ChunkSize,
+                                            stream->Config.Length - stream->SdramBytes);
+        uint32_t t0 = W9825G6KH_Perf_GetCycles();
+
+        status = W9825G6KH_ReadBuffer(W9825G6KH_Stream_Chunk(stream, head),
+                                      stream->Config.Offset + stream->SdramBytes, len);
+        stream->Stats.SdramCycles += W9825G6KH_Perf_GetCycles() - t0;
+        if (status != W9825G6KH_OK) {
+            break;
+        }
+
+        stream->ChunkLen[head % stream->Config.NumChunks] = len;
+        stream->SdramBytes += len;
+        stream->Stats.Chunks++;
+        W9825G6KH_AtomicStore32(&stream->Head, ++head);
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Copies data into a WRITE stream, draining chunks when the ring
+  *         is full
+  * @retval W9825G6KH status (INVALID_PARAM if data exceeds the stream length)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Push(W9825G6KH_StreamTypeDef *stream, const uint8_t *data, uint32_t len)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (stream == NULL || data == NULL || stream->Config.Direction != W9825G6KH_STREAM_WRITE) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    while (len > 0 && status == W9825G6KH_OK) {
+        uint32_t room;
+        uint8_t *chunk = W9825G6KH_Stream_AcquireChunk(stream, &room);
+
+        if (chunk == NULL) {
+            if (stream->UserBytes >= stream->Config.Length) {
+                return W9825G6KH_INVALID_PARAM;
+            }
+            status = W9825G6KH_Stream_Process(stream);
+            continue;
+        }
+
+        room = W9825G6KH_Stream_Min(room, len);
+        memcpy(chunk, data, room);
+        status = W9825G6KH_Stream_ReleaseChunk(stream, room);
+        data += room;
+        len -= room;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Copies data out of a READ stream, refilling chunks as needed
+  * @note   Any len works: a chunk only partly copied out stays at the
+  *         tail and the next call continues from where this one stopped
+  * @retval W9825G6KH status (INVALID_PARAM if len exceeds what is left)
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Pull(W9825G6KH_StreamTypeDef *stream, uint8_t *data, uint32_t len)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (stream == NULL || data == NULL || stream->Config.Direction != W9825G6KH_STREAM_READ ||
+        len > stream->Config.Length - stream->UserBytes) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    while (len > 0 && status == W9825G6KH_OK) {
+        uint32_t avail;
+        uint8_t *chunk = W9825G6KH_Stream_AcquireChunk(stream, &avail);
+
+        if (chunk == NULL) {
+            status = W9825G6KH_Stream_Process(stream);
+            continue;
+        }
+
+        avail = W9825G6KH_Stream_Min(avail, len);
+        memcpy(data, chunk, avail);
+        status = W9825G6KH_Stream_ReleaseChunk(stream, avail);
+        data += avail;
+        len -= avail;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Drives a stream to completion with a callback on the data side
+  * @note   WRITE: a callback returning 0 ends the stream early (the length
+  *         is truncated to what was produced). READ: returning 0 aborts.
+  * @param  stream: Open stream
+  * @param  callback: Producer (WRITE) or consumer (READ)
+  * @param  ctx: Passed to the callback
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Run(W9825G6KH_StreamTypeDef *stream, W9825G6KH_StreamCallbackTypeDef callback, void *ctx)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (stream == NULL || callback == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    while (status == W9825G6KH_OK && !W9825G6KH_Stream_IsComplete(stream)) {
+        uint32_t len;
+        uint8_t *chunk;
+
+        if (stream->Config.Direction == W9825G6KH_STREAM_READ) {
+            status = W9825G6KH_Stream_Process(stream);
+            chunk = W9825G6KH_Stream_AcquireChunk(stream, &len);
+            if (chunk != NULL && status == W9825G6KH_OK) {
+                if (callback(ctx, chunk, len) == 0U) {
+                    return W9825G6KH_ERROR;
+                }
+                status = W9825G6KH_Stream_ReleaseChunk(stream, len);
+            }
+            continue;
+        }
+
+        chunk = W9825G6KH_Stream_AcquireChunk(stream, &len);
+        if (chunk != NULL) {
+            uint32_t produced = callback(ctx, chunk, len);
+            if (produced == 0U) {
+                stream->Config.Length = stream->UserBytes;
+            } else {
+                status = W9825G6KH_Stream_ReleaseChunk(stream, W9825G6KH_Stream_Min(produced, len));
+            }
+        }
+        if (status == W9825G6KH_OK) {
+            status = W9825G6KH_Stream_Process(stream);
+        }
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Flushes outstanding chunks of a WRITE stream
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Close(W9825G6KH_StreamTypeDef *stream)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    if (stream == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    if (stream->Config.Direction == W9825G6KH_STREAM_WRITE) {
+        status = W9825G6KH_Stream_Process(stream);
+        /* A short stream ends at whatever the caller committed */
+        stream->Config.Length = stream->UserBytes;
+    }
+
+    W9825G6KH_Stream_MarkEnd(stream);
+    return status;
+}
+
+/**
+  * @brief  Tells whether all bytes have reached their destination
+  * @retval 1 if complete, 0 otherwise
+  */
+uint32_t W9825G6KH_Stream_IsComplete(W9825G6KH_StreamTypeDef *stream)
+{
+    if (stream->Config.Direction == W9825G6KH_STREAM_WRITE) {
+        return (stream->SdramBytes >= stream->Config.Length) ? 1U : 0U;
+    }
+    return (stream->UserBytes >= stream->Config.Length) ? 1U : 0U;
+}
+
+/**
+  * @brief  Reports transfer counters and throughput
+  */
+void W9825G6KH_Stream_GetStats(W9825G6KH_StreamTypeDef *stream, W9825G6KH_StreamStatsTypeDef *stats)
+{
+    uint32_t end, khz = SystemCoreClock / 1000U;
+
+    if (stream == NULL || stats == NULL) {
+        return;
+    }
+
+    *stats = stream->Stats;
+    stats->Bytes = stream->SdramBytes;
+
+    end = (stream->EndCycles != 0U) ? stream->EndCycles : W9825G6KH_Perf_GetCycles();
+    stats->ElapsedCycles = end - stream->StartCycles;
+
+    stats->ThroughputKBps = (stats->ElapsedCycles != 0U) ?
+        (uint32_t)(((uint64_t)stats->Bytes * khz) / stats->ElapsedCycles) : 0U;
+    stats->SdramKBps = (stats->SdramCycles != 0U) ?
+        (uint32_t)(((uint64_t)stats->Bytes * khz) / stats->SdramCycles) : 0U;
+}
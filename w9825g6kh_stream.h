@@ -0,0 +1,90 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_stream.h
+  * @brief   Chunked streaming API for SDRAM transfers larger than SRAM
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_STREAM_H
+#define __W9825G6KH_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef W9825G6KH_STREAM_MAX_CHUNKS
+#define W9825G6KH_STREAM_MAX_CHUNKS      8U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_STREAM_WRITE = 0,  /* Source -> SRAM chunks -> SDRAM */
+    W9825G6KH_STREAM_READ        /* SDRAM -> SRAM chunks -> sink */
+} W9825G6KH_StreamDirTypeDef;
+
+/* Run() callback. WRITE: fill up to len bytes, return bytes produced
+ * (0 ends the stream). READ: consume len bytes, return 0 to abort. */
+typedef uint32_t (*W9825G6KH_StreamCallbackTypeDef)(void *ctx, uint8_t *chunk, uint32_t len);
+
+typedef struct {
+    W9825G6KH_StreamDirTypeDef Direction;
+    uint32_t Offset;             /* SDRAM start (offset from base) */
+    uint32_t Length;             /* Total bytes to transfer */
+    uint32_t ChunkSize;          /* Bytes per SRAM chunk (multiple of 512 recommended) */
+    uint32_t NumChunks;          /* 2..W9825G6KH_STREAM_MAX_CHUNKS */
+    uint8_t *pChunkMemory;       /* NumChunks * ChunkSize bytes of SRAM */
+} W9825G6KH_StreamConfigTypeDef;
+
+typedef struct {
+    uint32_t Bytes;              /* Bytes moved to/from SDRAM */
+    uint32_t Chunks;             /* Chunks moved to/from SDRAM */
+    uint32_t Stalls;             /* AcquireChunk calls refused (back-pressure) */
+    uint32_t SdramCycles;        /* Cycles spent in SDRAM copies */
+    uint32_t ElapsedCycles;      /* Cycles since Open (or until completion) */
+    uint32_t ThroughputKBps;     /* End-to-end, over ElapsedCycles */
+    uint32_t SdramKBps;          /* SDRAM side only, over SdramCycles */
+} W9825G6KH_StreamStatsTypeDef;
+
+typedef struct {
+    W9825G6KH_StreamConfigTypeDef Config;
+    volatile uint32_t Head;      /* Chunks handed to the ring by the data side */
+    volatile uint32_t Tail;      /* Chunks taken out of the ring */
+    uint32_t ChunkLen[W9825G6KH_STREAM_MAX_CHUNKS];
+    uint32_t ReadPos;            /* READ: bytes of the tail chunk already consumed */
+    uint32_t UserBytes;          /* Bytes committed (WRITE) by the caller */
+    uint32_t SdramBytes;         /* Bytes moved to/from SDRAM */
+    uint32_t StartCycles;
+    uint32_t EndCycles;
+    W9825G6KH_StreamStatsTypeDef Stats;
+} W9825G6KH_StreamTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Open(W9825G6KH_StreamTypeDef *stream, const W9825G6KH_StreamConfigTypeDef *config);
+uint8_t* W9825G6KH_Stream_AcquireChunk(W9825G6KH_StreamTypeDef *stream, uint32_t *len);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_ReleaseChunk(W9825G6KH_StreamTypeDef *stream, uint32_t len);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Process(W9825G6KH_StreamTypeDef *stream);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Push(W9825G6KH_StreamTypeDef *stream, const uint8_t *data, uint32_t len);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Pull(W9825G6KH_StreamTypeDef *stream, uint8_t *data, uint32_t len);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Run(W9825G6KH_StreamTypeDef *stream, W9825G6KH_StreamCallbackTypeDef callback, void *ctx);
+W9825G6KH_StatusTypeDef W9825G6KH_Stream_Close(W9825G6KH_StreamTypeDef *stream);
+uint32_t W9825G6KH_Stream_IsComplete(W9825G6KH_StreamTypeDef *stream);
+void W9825G6KH_Stream_GetStats(W9825G6KH_StreamTypeDef *stream, W9825G6KH_StreamStatsTypeDef *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_STREAM_H */
@@ -0,0 +1,356 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_tlm.c
+  * @brief   Binary telemetry for the W9825G6KH driver over ITM/SWO or an
+  *          SRAM ring buffer
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * A frame is built on the stack (at most 57 bytes) and gets its sequence
+  * number inside a short PRIMASK section; every frame takes one, so frames
+  * dropped on the target leave a gap just like frames lost in transport.
+  * The ring copy runs inside that section. The ITM words are written with
+  * interrupts enabled, since waiting on the stimulus FIFO at SWO speed
+  * takes far too long to mask; the port is claimed for the frame instead,
+  * and a frame emitted from an ISR while another frame holds the port is
+  * dropped rather than interleaved. With ITM and no trace enabled the cost
+  * is two register reads. Nothing is formatted on the target.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_tlm.h"
+#include "w9825g6kh_perf.h"
+#include <string.h>
+
+#if W9825G6KH_TLM_ENABLE
+
+/* Private defines -----------------------------------------------------------*/
+#define TLM_FRAME_MAX    (W9825G6KH_TLM_HEADER_BYTES + W9825G6KH_TLM_MAX_PAYLOAD + 1U)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint8_t Data[TLM_FRAME_MAX + 3U];   /* Room for ITM word padding */
+    uint32_t Len;
+} W9825G6KH_Tlm_FrameTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_TlmSinkTypeDef tlm_sink = W9825G6KH_TLM_SINK_NONE;
+static uint8_t *tlm_ring = NULL;
+static uint32_t tlm_ring_size = 0;
+static volatile uint32_t tlm_head = 0;          /* Free-running byte counters */
+static volatile uint32_t tlm_tail = 0;
+static uint8_t tlm_seq = 0;
+static volatile uint32_t tlm_itm_busy = 0;     /* 1 while a frame is written to ITM */
+static W9825G6KH_TlmStatsTypeDef tlm_stats;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void W9825G6KH_Tlm_Begin(W9825G6KH_Tlm_FrameTypeDef *f, uint8_t type)
+{
+    uint32_t now = W9825G6KH_Perf_GetCycles();
+
+    f->Data[0] = W9825G6KH_TLM_SYNC;
+    f->Data[1] = type;
+    f->Data[4] = (uint8_t)now;
+    f->Data[5] = (uint8_t)(now >> 8);
+    f->Data[6] = (uint8_t)(now >> 16);
+    f->Data[7] = (uint8_t)(now >> 24);
+    f->Len = W9825G6KH_TLM_HEADER_BYTES;
+}
+
+static void W9825G6KH_Tlm_Put8(W9825G6KH_Tlm_FrameTypeDef *f, uint32_t v)
+{
+    f->Data[f->Len++] = (uint8_t)v;
+}
+
+static void W9825G6KH_Tlm_Put16(W9825G6KH_Tlm_FrameTypeDef *f, uint32_t v)
+{
+    f->Data[f->Len++] = (uint8_t)v;
+    f->Data[f->Len++] = (uint8_t)(v >> 8);
+}
+
+static void W9825G6KH_Tlm_Put32(W9825G6KH_Tlm_FrameTypeDef *f, uint32_t v)
+{
+    W9825G6KH_Tlm_Put16(f, v);
+    W9825G6KH_Tlm_Put16(f, v >> 16);
+}
+
+static void W9825G6KH_Tlm_Put64(W9825G6KH_Tlm_FrameTypeDef *f, uint64_t v)
+{
+    W9825G6KH_Tlm_Put32(f, (uint32_t)v);
+    W9825G6KH_Tlm_Put32(f, (uint32_t)(v >> 32));
+}
+
+/**
+  * @brief  Completes the header and checksum and writes the frame to the sink
+  */
+static void W9825G6KH_Tlm_Emit(W9825G6KH_Tlm_FrameTypeDef *f)
+{
+    uint32_t primask;
+    uint32_t sum = 0;
+    uint32_t len;
+
+    if (tlm_sink == W9825G6KH_TLM_SINK_NONE) {
+        return;
+    }
+
+    f->Data[2] = (uint8_t)(f->Len - W9825G6KH_TLM_HEADER_BYTES);
+    for (uint32_t i = 1; i < f->Len; i++) {
+        if (i != 3U) {
+            sum += f->Data[i];
+        }
+    }
+    len = f->Len + 1U;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Taken even if the frame is dropped below, so the drop shows as a gap */
+    f->Data[3] = tlm_seq++;
+    f->Data[f->Len] = (uint8_t)~(sum + f->Data[3]);
+
+    if (tlm_sink == W9825G6KH_TLM_SINK_ITM) {
+        volatile uint32_t *port = &ITM->PORT[W9825G6KH_TLM_ITM_PORT].u32;
+
+        if ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U || (ITM->TER & (1UL << W9825G6KH_TLM_ITM_PORT)) == 0U ||
+            tlm_itm_busy != 0U) {
+            tlm_stats.Dropped++;
+            __set_PRIMASK(primask);
+            return;
+        }
+        tlm_itm_busy = 1U;
+        __set_PRIMASK(primask);
+
+        while ((len & 3U) != 0U) {
+            f->Data[len++] = 0U;
+        }
+        for (uint32_t i = 0; i < len; i += 4U) {
+            while (*port == 0U) {
+                __NOP();
+            }
+            *port = (uint32_t)f->Data[i] | ((uint32_t)f->Data[i + 1U] << 8) |
+                    ((uint32_t)f->Data[i + 2U] << 16) | ((uint32_t)f->Data[i + 3U] << 24);
+        }
+
+        __disable_irq();
+        tlm_itm_busy = 0U;
+    } else {
+        if (tlm_ring_size - (tlm_head - tlm_tail) < len) {
+            tlm_stats.Dropped++;
+            __set_PRIMASK(primask);
+            return;
+        }
+        for (uint32_t i = 0; i < len; i++) {
+            tlm_ring[(tlm_head + i) & (tlm_ring_size - 1U)] = f->Data[i];
+        }
+        __DMB();
+        tlm_head += len;
+    }
+
+    tlm_stats.Frames++;
+    tlm_stats.Bytes += len;
+
+    __set_PRIMASK(primask);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Selects where frames go
+  * @param  Sink: ITM, ring buffer, or none
+  * @param  pBuffer: Ring storage for W9825G6KH_TLM_SINK_BUFFER (SRAM)
+  * @param  Size: Ring size in bytes, a power of two of at least 64
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Tlm_Init(W9825G6KH_TlmSinkTypeDef Sink, uint8_t *pBuffer, uint32_t Size)
+{
+    uint32_t primask;
+
+    if (Sink > W9825G6KH_TLM_SINK_BUFFER ||
+        (Sink == W9825G6KH_TLM_SINK_BUFFER &&
+         (pBuffer == NULL || Size < TLM_FRAME_MAX || (Size & (Size - 1U)) != 0U))) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    tlm_sink = Sink;
+    tlm_ring = pBuffer;
+    tlm_ring_size = (Sink == W9825G6KH_TLM_SINK_BUFFER) ? Size : 0U;
+    tlm_head = 0;
+    tlm_tail = 0;
+    tlm_seq = 0;
+    tlm_itm_busy = 0;
+    memset(&tlm_stats, 0, sizeof(tlm_stats));
+    __set_PRIMASK(primask);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Emits the device configuration and FMC registers
+  */
+void W9825G6KH_Tlm_SendConfig(void)
+{
+    W9825G6KH_Tlm_FrameTypeDef f;
+    W9825G6KH_InitTypeDef cfg;
+
+    if (tlm_sink == W9825G6KH_TLM_SINK_NONE || W9825G6KH_GetConfig(&cfg) != W9825G6KH_OK) {
+        return;
+    }
+
+    W9825G6KH_Tlm_Begin(&f, W9825G6KH_TLM_TYPE_CONFIG);
+    W9825G6KH_Tlm_Put32(&f, W9825G6KH_SIZE_BYTES);
+    W9825G6KH_Tlm_Put32(&f, W9825G6KH_GetClockHz());
+    W9825G6KH_Tlm_Put16(&f, cfg.BurstLength | cfg.BurstType | cfg.CASLatency | cfg.OperatingMode | cfg.WriteBurstMode);
+    W9825G6KH_Tlm_Put16(&f, cfg.RefreshRate);
+    W9825G6KH_Tlm_Put32(&f, FMC_Bank5_6_R->SDCR[0]);
+    W9825G6KH_Tlm_Put32(&f, FMC_Bank5_6_R->SDTR[0]);
+    W9825G6KH_Tlm_Put32(&f, FMC_Bank5_6_R->SDRTR);
+    W9825G6KH_Tlm_Put32(&f, FMC_Bank5_6_R->SDSR);
+    W9825G6KH_Tlm_Emit(&f);
+}
+
+/**
+  * @brief  Emits the programmed mode register next to the FMC CAS setting
+  * @param  Mode: Mode register value
+  * @param  Sdcr: FMC SDCR[0]
+  */
+void W9825G6KH_Tlm_SendModeRegister(uint32_t Mode, uint32_t Sdcr)
+{
+    W9825G6KH_Tlm_FrameTypeDef f;
+
+    W9825G6KH_Tlm_Begin(&f, W9825G6KH_TLM_TYPE_MODEREG);
+    W9825G6KH_Tlm_Put16(&f, Mode);
+    W9825G6KH_Tlm_Put8(&f, (Mode >> W9825G6KH_MR_CAS_LATENCY_POS) & 0x7U);
+    W9825G6KH_Tlm_Put8(&f, (Sdcr & FMC_SDCRx_CAS) >> FMC_SDCRx_CAS_Pos);
+    W9825G6KH_Tlm_Put32(&f, Sdcr);
+    W9825G6KH_Tlm_Emit(&f);
+}
+
+/**
+  * @brief  Emits one frame per perf counter with calls
+  */
+void W9825G6KH_Tlm_SendPerf(void)
+{
+    static W9825G6KH_PerfSnapshotTypeDef snap;
+    W9825G6KH_Tlm_FrameTypeDef f;
+
+    if (tlm_sink == W9825G6KH_TLM_SINK_NONE) {
+        return;
+    }
+
+    W9825G6KH_Perf_GetSnapshot(&snap);
+    for (uint32_t a = 0; a < W9825G6KH_PERF_API_COUNT; a++) {
+        const W9825G6KH_PerfCounterTypeDef *c = &snap.Api[a];
+
+        if (c->Calls == 0U) {
+            continue;
+        }
+        W9825G6KH_Tlm_Begin(&f, W9825G6KH_TLM_TYPE_PERF);
+        W9825G6KH_Tlm_Put8(&f, a);
+        W9825G6KH_Tlm_Put32(&f, c->Calls);
+        W9825G6KH_Tlm_Put64(&f, c->Bytes);
+        W9825G6KH_Tlm_Put64(&f, c->TotalCycles);
+        W9825G6KH_Tlm_Put32(&f, c->MinCycles);
+        W9825G6KH_Tlm_Put32(&f, c->MaxCycles);
+        W9825G6KH_Tlm_Put32(&f, snap.CoreClockHz);
+        W9825G6KH_Tlm_Emit(&f);
+    }
+}
+
+/**
+  * @brief  Emits a memory test result
+  * @param  Pattern: Index of the failing pattern, W9825G6KH_TLM_PATTERN_INCREMENT
+  *         or W9825G6KH_TLM_PATTERN_NONE
+  * @param  FailWord: First failing word (valid when Errors > 0)
+  * @param  Got: Value read there
+  */
+void W9825G6KH_Tlm_SendMemTest(uint32_t Start, uint32_t Size, W9825G6KH_StatusTypeDef Status, uint32_t Pattern,
+                               uint32_t Errors, uint32_t FailWord, uint32_t Got, uint32_t Cycles)
+{
+    W9825G6KH_Tlm_FrameTypeDef f;
+
+    W9825G6KH_Tlm_Begin(&f, W9825G6KH_TLM_TYPE_MEMTEST);
+    W9825G6KH_Tlm_Put32(&f, Start);
+    W9825G6KH_Tlm_Put32(&f, Size);
+    W9825G6KH_Tlm_Put8(&f, (uint32_t)Status);
+    W9825G6KH_Tlm_Put8(&f, Pattern);
+    W9825G6KH_Tlm_Put32(&f, Errors);
+    W9825G6KH_Tlm_Put32(&f, FailWord);
+    W9825G6KH_Tlm_Put32(&f, Got);
+    W9825G6KH_Tlm_Put32(&f, Cycles);
+    W9825G6KH_Tlm_Emit(&f);
+}
+
+/**
+  * @brief  Emits an application event
+  */
+void W9825G6KH_Tlm_Event(uint16_t Id, uint32_t Arg)
+{
+    W9825G6KH_Tlm_FrameTypeDef f;
+
+    W9825G6KH_Tlm_Begin(&f, W9825G6KH_TLM_TYPE_EVENT);
+    W9825G6KH_Tlm_Put16(&f, Id);
+    W9825G6KH_Tlm_Put32(&f, Arg);
+    W9825G6KH_Tlm_Emit(&f);
+}
+
+/**
+  * @brief  Drains the ring buffer (e.g. to a UART or USB CDC)
+  * @note   One reader at a time; runs with interrupts enabled, since
+  *         producers only ever append past head
+  * @param  pDst: Destination
+  * @param  Max: Bytes at most
+  * @retval Bytes copied; whole frames only
+  */
+uint32_t W9825G6KH_Tlm_Read(uint8_t *pDst, uint32_t Max)
+{
+    uint32_t mask = tlm_ring_size - 1U;
+    uint32_t tail = tlm_tail;
+    uint32_t head = tlm_head;
+    uint32_t n = 0;
+
+    if (pDst == NULL || tlm_sink != W9825G6KH_TLM_SINK_BUFFER) {
+        return 0U;
+    }
+
+    __DMB();
+    while (head != tail) {
+        /* Frame length from its header: header + payload + check */
+        uint32_t len = W9825G6KH_TLM_HEADER_BYTES + 1U + tlm_ring[(tail + 2U) & mask];
+
+        if (n + len > Max) {
+            break;
+        }
+        for (uint32_t i = 0; i < len; i++) {
+            pDst[n + i] = tlm_ring[(tail + i) & mask];
+        }
+        tail += len;
+        n += len;
+    }
+    __DMB();
+    tlm_tail = tail;
+
+    return n;
+}
+
+/**
+  * @brief  Returns frame, byte and drop counts since W9825G6KH_Tlm_Init
+  * @param  stats: Destination
+  */
+void W9825G6KH_Tlm_GetStats(W9825G6KH_TlmStatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = tlm_stats;
+    }
+}
+
+#endif /* W9825G6KH_TLM_ENABLE */
@@ -0,0 +1,112 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_tlm.h
+  * @brief   Binary telemetry for the W9825G6KH driver over ITM/SWO or an
+  *          SRAM ring buffer
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Frame layout (little-endian), decoded on the host by
+  * w9825g6kh_tlm_decode.py:
+  *
+  *   0     Sync  0xA5
+  *   1     Type  W9825G6KH_TLM_TYPE_x
+  *   2     Len   payload bytes
+  *   3     Seq   frame counter; gaps show frames dropped on the target
+  *                 (see Dropped) or lost in transport
+  *   4..7  Time  DWT cycle count
+  *   8..   Payload
+  *   last  Check ~(sum of bytes 1 .. last - 1)
+  *
+  * ITM frames are padded with zero bytes to a whole number of words.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_TLM_H
+#define __W9825G6KH_TLM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* 0 compiles every W9825G6KH_Tlm_x call down to nothing */
+#ifndef W9825G6KH_TLM_ENABLE
+#define W9825G6KH_TLM_ENABLE             1
+#endif
+
+/* ITM stimulus port (port 0 is usually taken by printf retargeting) */
+#ifndef W9825G6KH_TLM_ITM_PORT
+#define W9825G6KH_TLM_ITM_PORT           1U
+#endif
+
+#define W9825G6KH_TLM_SYNC               0xA5U
+#define W9825G6KH_TLM_HEADER_BYTES       8U
+#define W9825G6KH_TLM_MAX_PAYLOAD        48U
+
+/* Frame types; payload fields in order */
+#define W9825G6KH_TLM_TYPE_CONFIG        0x01U   /* u32 size, u32 sdclk_hz, u16 mode, u16 refresh,
+                                                    u32 sdcr, u32 sdtr, u32 sdrtr, u32 sdsr */
+#define W9825G6KH_TLM_TYPE_MODEREG       0x02U   /* u16 mode, u8 mode_cas, u8 fmc_cas, u32 sdcr */
+#define W9825G6KH_TLM_TYPE_PERF          0x03U   /* u8 api, u32 calls, u64 bytes, u64 cycles,
+                                                    u32 min, u32 max, u32 core_hz */
+#define W9825G6KH_TLM_TYPE_MEMTEST       0x04U   /* u32 start, u32 size, u8 status, u8 pattern,
+                                                    u32 errors, u32 fail_word, u32 got, u32 cycles */
+#define W9825G6KH_TLM_TYPE_EVENT         0x05U   /* u16 id, u32 arg */
+
+/* MEMTEST pattern index for the incrementing pass, and when none ran */
+#define W9825G6KH_TLM_PATTERN_INCREMENT  0xFEU
+#define W9825G6KH_TLM_PATTERN_NONE       0xFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    W9825G6KH_TLM_SINK_NONE = 0,
+    W9825G6KH_TLM_SINK_ITM,          /* Stimulus port; frames are dropped while no trace is enabled */
+    W9825G6KH_TLM_SINK_BUFFER        /* SRAM ring, drained with W9825G6KH_Tlm_Read */
+} W9825G6KH_TlmSinkTypeDef;
+
+typedef struct {
+    uint32_t Frames;             /* Frames emitted */
+    uint32_t Bytes;
+    uint32_t Dropped;            /* Ring full, ITM port disabled, or ITM port busy
+                                    with the frame this one preempted */
+} W9825G6KH_TlmStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+#if W9825G6KH_TLM_ENABLE
+W9825G6KH_StatusTypeDef W9825G6KH_Tlm_Init(W9825G6KH_TlmSinkTypeDef Sink, uint8_t *pBuffer, uint32_t Size);
+void W9825G6KH_Tlm_SendConfig(void);
+void W9825G6KH_Tlm_SendModeRegister(uint32_t Mode, uint32_t Sdcr);
+void W9825G6KH_Tlm_SendPerf(void);
+void W9825G6KH_Tlm_SendMemTest(uint32_t Start, uint32_t Size, W9825G6KH_StatusTypeDef Status, uint32_t Pattern,
+                               uint32_t Errors, uint32_t FailWord, uint32_t Got, uint32_t Cycles);
+void W9825G6KH_Tlm_Event(uint16_t Id, uint32_t Arg);
+uint32_t W9825G6KH_Tlm_Read(uint8_t *pDst, uint32_t Max);
+void W9825G6KH_Tlm_GetStats(W9825G6KH_TlmStatsTypeDef *stats);
+#else
+#define W9825G6KH_Tlm_Init(Sink, pBuffer, Size)                  (W9825G6KH_OK)
+#define W9825G6KH_Tlm_SendConfig()                               ((void)0)
+#define W9825G6KH_Tlm_SendModeRegister(Mode, Sdcr)               ((void)(Mode), (void)(Sdcr))
+#define W9825G6KH_Tlm_SendPerf()                                 ((void)0)
+#define W9825G6KH_Tlm_SendMemTest(St, Sz, S, P, E, F, G, C) \
+    ((void)(St), (void)(Sz), (void)(S), (void)(P), (void)(E), (void)(F), (void)(G), (void)(C))
+#define W9825G6KH_Tlm_Event(Id, Arg)                             ((void)(Id), (void)(Arg))
+#define W9825G6KH_Tlm_Read(pDst, Max)                            (0U)
+#define W9825G6KH_Tlm_GetStats(stats)                            ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_TLM_H */
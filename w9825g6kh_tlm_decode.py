@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Decoder for W9825G6KH binary telemetry (w9825g6kh_tlm.h).
+
+Reads a raw capture from a file or stdin and prints one line per frame.
+
+  w9825g6kh_tlm_decode.py ring.bin              bytes from W9825G6KH_Tlm_Read
+  w9825g6kh_tlm_decode.py --itm 1 swo.bin       SWO capture, ITM stimulus port 1
+  w9825g6kh_tlm_decode.py --hz 480000000 ...    print timestamps in microseconds
+
+Frame: A5 type len seq time[4] payload[len] check, check = ~sum(type .. payload).
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = 0xA5
+HEADER_BYTES = 8
+
+API_NAMES = ["WRITE", "READ", "FILL", "MEMTEST", "COMMAND"]
+TEST_PATTERNS = [0x00000000, 0xFFFFFFFF, 0x55555555, 0xAAAAAAAA,
+                 0x33333333, 0xCCCCCCCC, 0x0F0F0F0F, 0xF0F0F0F0]
+STATUS_NAMES = ["OK", "ERROR", "BUSY", "TIMEOUT", "INVALID_PARAM"]
+
+
+def itm_port_bytes(data, port):
+    """Extracts the payload of one stimulus port from an ITM/SWO stream."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        h = data[i]
+        i += 1
+        if h == 0x00 or h == 0x80 or h == 0x70:
+            continue                        # sync / overflow
+        if h & 0x03:
+            size = {1: 1, 2: 2, 3: 4}[h & 0x03]
+            if not h & 0x04 and (h >> 3) == port:
+                out += data[i:i + size]
+            i += size                       # other ports, hardware source
+            continue
+        # Timestamp or extension packet: continuation bytes while bit 7
+        if h & 0x80:
+            while i < len(data) and data[i] & 0x80:
+                i += 1
+            i += 1
+    return bytes(out)
+
+
+def mode_register_text(mode):
+    bl = {0: "1", 1: "2", 2: "4", 3: "8", 7: "page"}.get(mode & 0x7, "reserved")
+    return "BL=%s %s CAS=%d %s" % (
+        bl,
+        "interleaved" if mode & 0x8 else "sequential",
+        (mode >> 4) & 0x7,
+        "single-write" if mode & 0x200 else "burst-write")
+
+
+def decode_payload(ftype, p):
+    if ftype == 0x01:
+        size, hz, mode, refresh, sdcr, sdtr, sdrtr, sdsr = struct.unpack("<IIHHIIII", p)
+        return ("CONFIG   size=%u sdclk=%.1fMHz mode=0x%03X (%s) refresh=%u "
+                "SDCR=0x%08X SDTR=0x%08X SDRTR=0x%08X SDSR=0x%08X" %
+                (size, hz / 1e6, mode, mode_register_text(mode), refresh, sdcr, sdtr, sdrtr, sdsr))
+    if ftype == 0x02:
+        mode, mode_cas, fmc_cas, sdcr = struct.unpack("<HBBI", p)
+        return ("MODEREG  mode=0x%03X (%s) FMC CAS=%u SDCR=0x%08X %s" %
+                (mode, mode_register_text(mode), fmc_cas, sdcr,
+                 "OK" if mode_cas == fmc_cas else "MISMATCH"))
+    if ftype == 0x03:
+        api, calls, nbytes, cycles, cmin, cmax, core_hz = struct.unpack("<BIQQIII", p)
+        name = API_NAMES[api] if api < len(API_NAMES) else "API%u" % api
+        kbps = (nbytes * core_hz // cycles // 1024) if cycles else 0
+        return ("PERF     %-8s calls=%u bytes=%u min=%u max=%u cyc %u KB/s" %
+                (name, calls, nbytes, cmin, cmax, kbps))
+    if ftype == 0x04:
+        start, size, status, pattern, errors, word, got, cycles = struct.unpack("<IIBBIIII", p)
+        text = ("MEMTEST  start=0x%08X size=%u %s cycles=%u" %
+                (start, size, STATUS_NAMES[status] if status < len(STATUS_NAMES) else status, cycles))
+        if errors:
+            if pattern == 0xFE:
+                expect, pname = word, "incrementing"
+            elif pattern < len(TEST_PATTERNS):
+                expect = TEST_PATTERNS[pattern]
+                pname = "0x%08X" % expect
+            else:
+                expect, pname = None, "?"
+            text += " pattern=%s errors=%u first word %u got=0x%08X" % (pname, errors, word, got)
+            if expect is not None:
+                text += " xor=0x%08X" % (got ^ expect)
+        return text
+    if ftype == 0x05:
+        ident, arg = struct.unpack("<HI", p)
+        return "EVENT    id=%u arg=0x%08X" % (ident, arg)
+    return "TYPE%02X   %s" % (ftype, p.hex())
+
+
+def decode(data, hz, out):
+    """Walks the stream, resyncing on 0xA5 whenever a frame does not check."""
+    frames = bad = lost = 0
+    last_seq = None
+    i = 0
+    while i + HEADER_BYTES + 1 <= len(data):
+        if data[i] != SYNC:
+            i += 1
+            continue
+        length = data[i + 2]
+        end = i + HEADER_BYTES + length
+        if end >= len(data):
+            break
+        if (~sum(data[i + 1:end]) & 0xFF) != data[end]:
+            bad += 1
+            i += 1
+            continue
+        ftype, _, seq, stamp = struct.unpack("<BBBI", data[i + 1:i + HEADER_BYTES])
+        if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+            gap = (seq - last_seq - 1) & 0xFF
+            lost += gap
+            out.write("-- %u frame(s) lost\n" % gap)
+        last_seq = seq
+        try:
+            text = decode_payload(ftype, data[i + HEADER_BYTES:end])
+        except struct.error:
+            text = "TYPE%02X   bad length %u" % (ftype, length)
+        t = ("%12.1fus" % (stamp * 1e6 / hz)) if hz else ("%10u" % stamp)
+        out.write("%3u %s  %s\n" % (seq, t, text))
+        frames += 1
+        i = end + 1                         # ITM zero padding is skipped by the resync
+    out.write("%u frames, %u lost, %u bad checksums\n" % (frames, lost, bad))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("file", nargs="?", help="capture file (default stdin)")
+    ap.add_argument("--itm", type=int, metavar="PORT",
+                    help="input is an ITM/SWO stream; decode this stimulus port")
+    ap.add_argument("--hz", type=int, default=0, help="core clock for timestamps")
+    args = ap.parse_args()
+
+    if args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+    if args.itm is not None:
+        data = itm_port_bytes(data, args.itm)
+    decode(data, args.hz, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,438 @@
+
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_wc.c
+  * @brief   Write-combining staging layer for small scattered SDRAM writes
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Writes are gathered in page-sized (512 B) lines, one line per open SDRAM
+  * row. A line that becomes fully dirty is written back immediately as one
+  * 512 B burst; partially dirty lines are written back as their dirty byte
+  * runs on eviction or on an explicit flush. W9825G6KH_WC_Read merges staged
+  * bytes over SDRAM contents, so reads through this layer are coherent.
+  *
+  * Accesses through the plain driver API to a page that is still staged must
+  * be preceded by W9825G6KH_WC_Flush/FlushRange. The layer is not reentrant;
+  * use it from a single context.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_wc.h"
+#include "w9825g6kh_perf.h"
+#include <string.h>
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define WC_PAGE_MASK                 (W9825G6KH_WC_LINE_SIZE - 1U)
+#define WC_MASK_WORDS                (W9825G6KH_WC_LINE_SIZE / 32U)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t Data[W9825G6KH_WC_LINE_SIZE / 4];  /* Staged page contents */
+    uint32_t Mask[WC_MASK_WORDS];               /* One bit per dirty byte */
+    uint32_t Tag;                               /* Page-aligned SDRAM offset */
+    uint32_t DirtyCount;                        /* Bits set in Mask */
+    uint32_t LastUse;
+    uint32_t Valid;
+} W9825G6KH_WC_LineTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static W9825G6KH_WC_LineTypeDef wc_lines[W9825G6KH_WC_LINE_COUNT] W9825G6KH_DTCM_ATTR __attribute__((aligned(32)));
+static W9825G6KH_WC_StatsTypeDef wc_stats;
+static uint32_t wc_tick = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+static W9825G6KH_StatusTypeDef W9825G6KH_WC_CheckRange(uint32_t addr, uint32_t size)
+{
+    if (size == 0 || addr >= W9825G6KH_SIZE_BYTES || size > W9825G6KH_SIZE_BYTES - addr) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+    return W9825G6KH_OK;
+}
+
+static W9825G6KH_WC_LineTypeDef* W9825G6KH_WC_Lookup(uint32_t page)
+{
+    for (uint32_t i = 0; i < W9825G6KH_WC_LINE_COUNT; i++) {
+        if (wc_lines[i].Valid && wc_lines[i].Tag == page) {
+            return &wc_lines[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+  * @brief  Marks bytes [start, start+len) of a line dirty
+  * @retval Number of bytes that were not dirty before
+  */
+static uint32_t W9825G6KH_WC_MarkDirty(W9825G6KH_WC_LineTypeDef *line, uint32_t start, uint32_t len)
+{
+    uint32_t end = start + len - 1U;
+    uint32_t newly = 0;
+
+    for (uint32_t w = start / 32U; w <= end / 32U; w++) {
+        uint32_t lo = (w == start / 32U) ? (start % 32U) : 0U;
+        uint32_t hi = (w == end / 32U) ? (end % 32U) : 31U;
+        uint32_t bits = ((hi == 31U) ? 0xFFFFFFFFU : ((1UL << (hi + 1U)) - 1U)) & ~((1UL << lo) - 1U);
+
+        newly += (uint32_t)__builtin_popcount(bits & ~line->Mask[w]);
+        line->Mask[w] |= bits;
+    }
+    return newly;
+}
+
+/**
+  * @brief  Writes a line back to SDRAM and releases it
+  * @note   On failure the line stays valid and dirty, so no staged byte is
+  *         lost and a later flush can retry
+  */
+static W9825G6KH_StatusTypeDef W9825G6KH_WC_FlushLine(W9825G6KH_WC_LineTypeDef *line)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+    uint8_t *data = (uint8_t *)line->Data;
+
+    if (!line->Valid) {
+        return W9825G6KH_OK;
+    }
+
+    if (line->DirtyCount == W9825G6KH_WC_LINE_SIZE) {
+        /* Whole row dirty: one aligned 512 B burst */
+        status = W9825G6KH_WriteBuffer32(line->Data, line->Tag, W9825G6KH_WC_LINE_SIZE / 4);
+        wc_stats.FullFlushes++;
+    } else {
+        uint32_t i = 0;
+        while (i < W9825G6KH_WC_LINE_SIZE && status == W9825G6KH_OK) {
+            if (line->Mask[i / 32U] == 0U) {
+                i = (i | 31U) + 1U;
+                continue;
+            }
+            if ((line->Mask[i / 32U] & (1UL << (i % 32U))) == 0U) {
+                i++;
+                continue;
+            }
+            uint32_t run = i;
+            while (i < W9825G6KH_WC_LINE_SIZE && (line->Mask[i / 32U] & (1UL << (i % 32U)))) {
+                i++;
+            }
+            status = W9825G6KH_WriteBuffer(&data[run], line->Tag + run, i - run);
+        }
+        wc_stats.PartialFlushes++;
+    }
+
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    line->Valid = 0;
+    line->DirtyCount = 0;
+    memset(line->Mask, 0, sizeof(line->Mask));
+
+    return status;
+}
+
+/**
+  * @brief  Returns a free line, evicting the least recently used one if needed
+  * @retval Line, or NULL with *status set if the victim could not be written
+  *         back (it then keeps its staged data)
+  */
+static W9825G6KH_WC_LineTypeDef* W9825G6KH_WC_Allocate(uint32_t page, W9825G6KH_StatusTypeDef *status)
+{
+    W9825G6KH_WC_LineTypeDef *victim = &wc_lines[0];
+
+    *status = W9825G6KH_OK;
+
+    for (uint32_t i = 0; i < W9825G6KH_WC_LINE_COUNT; i++) {
+        if (!wc_lines[i].Valid) {
+            victim = &wc_lines[i];
+            break;
+        }
+        if ((int32_t)(wc_lines[i].LastUse - victim->LastUse) < 0) {
+            victim = &wc_lines[i];
+        }
+    }
+
+    if (victim->Valid) {
+        *status = W9825G6KH_WC_FlushLine(victim);
+        if (*status != W9825G6KH_OK) {
+            return NULL;
+        }
+        wc_stats.Evictions++;
+    }
+
+    victim->Tag = page;
+    victim->Valid = 1;
+    wc_stats.LineAllocs++;
+    return victim;
+}
+
+static uint32_t W9825G6KH_WC_Random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Drops all staged lines and clears the statistics
+  * @note   Staged data is discarded; call W9825G6KH_WC_Flush first to keep it
+  */
+void W9825G6KH_WC_Init(void)
+{
+    memset(wc_lines, 0, sizeof(wc_lines));
+    memset(&wc_stats, 0, sizeof(wc_stats));
+    wc_tick = 0;
+}
+
+/**
+  * @brief  Stages a write; data reaches SDRAM when its line fills or is flushed
+  * @param  pBuffer: Pointer to data buffer
+  * @param  WriteAddr: Write address (offset from SDRAM base)
+  * @param  BufferSize: Size of buffer in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Write(const uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (pBuffer == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_WC_CheckRange(WriteAddr, BufferSize);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    wc_stats.Writes++;
+
+    while (BufferSize > 0 && status == W9825G6KH_OK) {
+        uint32_t page = WriteAddr & ~WC_PAGE_MASK;
+        uint32_t offset = WriteAddr & WC_PAGE_MASK;
+        uint32_t chunk = W9825G6KH_WC_LINE_SIZE - offset;
+        W9825G6KH_WC_LineTypeDef *line;
+
+        if (chunk > BufferSize) {
+            chunk = BufferSize;
+        }
+
+        line = W9825G6KH_WC_Lookup(page);
+        if (line == NULL && chunk == W9825G6KH_WC_LINE_SIZE) {
+            /* Whole page with nothing staged: no benefit in copying twice */
+            status = W9825G6KH_WriteBuffer((uint8_t *)pBuffer, page, chunk);
+        } else {
+            if (line != NULL) {
+                wc_stats.LineHits++;
+            } else {
+                line = W9825G6KH_WC_Allocate(page, &status);
+                if (line == NULL) {
+                    break;
+                }
+            }
+
+            memcpy((uint8_t *)line->Data + offset, pBuffer, chunk);
+            line->DirtyCount += W9825G6KH_WC_MarkDirty(line, offset, chunk);
+            line->LastUse = ++wc_tick;
+            wc_stats.BytesStaged += chunk;
+
+            if (line->DirtyCount == W9825G6KH_WC_LINE_SIZE) {
+                status = W9825G6KH_WC_FlushLine(line);
+            }
+        }
+
+        pBuffer += chunk;
+        WriteAddr += chunk;
+        BufferSize -= chunk;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Reads SDRAM with any staged bytes merged in
+  * @param  pBuffer: Pointer to data buffer
+  * @param  ReadAddr: Read address (offset from SDRAM base)
+  * @param  BufferSize: Size of buffer in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (pBuffer == NULL) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    status = W9825G6KH_WC_CheckRange(ReadAddr, BufferSize);
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    while (BufferSize > 0 && status == W9825G6KH_OK) {
+        uint32_t page = ReadAddr & ~WC_PAGE_MASK;
+        uint32_t offset = ReadAddr & WC_PAGE_MASK;
+        uint32_t chunk = W9825G6KH_WC_LINE_SIZE - offset;
+        W9825G6KH_WC_LineTypeDef *line;
+
+        if (chunk > BufferSize) {
+            chunk = BufferSize;
+        }
+
+        /* Full lines are flushed as soon as they fill, so a staged line
+         * always needs SDRAM data around its dirty bytes */
+        line = W9825G6KH_WC_Lookup(page);
+        status = W9825G6KH_ReadBuffer(pBuffer, ReadAddr, chunk);
+        if (line != NULL) {
+            const uint8_t *data = (const uint8_t *)line->Data;
+            for (uint32_t i = offset; i < offset + chunk; i++) {
+                if (line->Mask[i / 32U] & (1UL << (i % 32U))) {
+                    pBuffer[i - offset] = data[i];
+                }
+            }
+        }
+
+        pBuffer += chunk;
+        ReadAddr += chunk;
+        BufferSize -= chunk;
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Write barrier: pushes every staged line to SDRAM
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Flush(void)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_OK;
+
+    for (uint32_t i = 0; i < W9825G6KH_WC_LINE_COUNT; i++) {
+        W9825G6KH_StatusTypeDef s = W9825G6KH_WC_FlushLine(&wc_lines[i]);
+        if (s != W9825G6KH_OK) {
+            status = s;
+        }
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Pushes staged lines overlapping [StartAddr, StartAddr+Size) to SDRAM
+  * @param  StartAddr: Starting address (offset from SDRAM base)
+  * @param  Size: Size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WC_FlushRange(uint32_t StartAddr, uint32_t Size)
+{
+    W9825G6KH_StatusTypeDef status = W9825G6KH_WC_CheckRange(StartAddr, Size);
+
+    if (status != W9825G6KH_OK) {
+        return status;
+    }
+
+    for (uint32_t i = 0; i < W9825G6KH_WC_LINE_COUNT; i++) {
+        W9825G6KH_WC_LineTypeDef *line = &wc_lines[i];
+        if (line->Valid && line->Tag + W9825G6KH_WC_LINE_SIZE > StartAddr &&
+            line->Tag < StartAddr + Size) {
+            W9825G6KH_StatusTypeDef s = W9825G6KH_WC_FlushLine(line);
+            if (s != W9825G6KH_OK) {
+                status = s;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+  * @brief  Copies the staging statistics
+  */
+void W9825G6KH_WC_GetStats(W9825G6KH_WC_StatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = wc_stats;
+    }
+}
+
+/**
+  * @brief  Compares random 4-32 byte writes issued directly against the
+  *         same sequence issued through the staging layer
+  * @note   Destructive: overwrites the first RegionSize bytes
+  * @param  RegionSize: Size of the region the offsets are drawn from
+  * @param  NumRecords: Number of records written per pass
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Benchmark(uint32_t RegionSize, uint32_t NumRecords)
+{
+    static uint8_t record[32];
+    W9825G6KH_StatusTypeDef status;
+    uint32_t seed, t0, direct_cycles, wc_cycles;
+    uint32_t bytes = 0;
+    uint32_t hz = SystemCoreClock;
+
+    status = W9825G6KH_WC_CheckRange(0, RegionSize);
+    if (status != W9825G6KH_OK || RegionSize < sizeof(record) || NumRecords == 0) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < sizeof(record); i++) {
+        record[i] = (uint8_t)i;
+    }
+
+    printf("=== Write-combining benchmark (%lu records in %lu bytes) ===\n",
+           NumRecords, RegionSize);
+
+    seed = 0x12345678U;
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t n = 0; n < NumRecords && status == W9825G6KH_OK; n++) {
+        uint32_t size = 4U + (W9825G6KH_WC_Random(&seed) % 29U);
+        uint32_t offset = W9825G6KH_WC_Random(&seed) % (RegionSize - size + 1U);
+        status = W9825G6KH_WriteBuffer(record, offset, size);
+        bytes += size;
+    }
+    direct_cycles = W9825G6KH_Perf_GetCycles() - t0;
+
+    W9825G6KH_WC_Init();
+    seed = 0x12345678U;
+    t0 = W9825G6KH_Perf_GetCycles();
+    for (uint32_t n = 0; n < NumRecords && status == W9825G6KH_OK; n++) {
+        uint32_t size = 4U + (W9825G6KH_WC_Random(&seed) % 29U);
+        uint32_t offset = W9825G6KH_WC_Random(&seed) % (RegionSize - size + 1U);
+        status = W9825G6KH_WC_Write(record, offset, size);
+    }
+    if (status == W9825G6KH_OK) {
+        status = W9825G6KH_WC_Flush();
+    }
+    wc_cycles = W9825G6KH_Perf_GetCycles() - t0;
+
+    if (status != W9825G6KH_OK || direct_cycles == 0 || wc_cycles == 0) {
+        printf("Benchmark aborted: %s\n", W9825G6KH_StatusToString(status));
+        return (status != W9825G6KH_OK) ? status : W9825G6KH_ERROR;
+    }
+
+    printf("  Direct: %10lu cycles  %8lu rec/s  %6lu KB/s\n", direct_cycles,
+           (uint32_t)(((uint64_t)NumRecords * hz) / direct_cycles),
+           (uint32_t)(((uint64_t)bytes * (hz / 1000U)) / direct_cycles));
+    printf("  WC:     %10lu cycles  %8lu rec/s  %6lu KB/s\n", wc_cycles,
+           (uint32_t)(((uint64_t)NumRecords * hz) / wc_cycles),
+           (uint32_t)(((uint64_t)bytes * (hz / 1000U)) / wc_cycles));
+    printf("  Speedup: %lu.%02lux  (hits %lu, allocs %lu, full %lu, partial %lu)\n",
+           direct_cycles / wc_cycles, (uint32_t)(((uint64_t)(direct_cycles % wc_cycles) * 100U) / wc_cycles),
+           wc_stats.LineHits, wc_stats.LineAllocs,
+           wc_stats.FullFlushes, wc_stats.PartialFlushes);
+
+    return W9825G6KH_OK;
+}
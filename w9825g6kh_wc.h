@@ -0,0 +1,59 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_wc.h
+  * @brief   Write-combining staging layer for small scattered SDRAM writes
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_WC_H
+#define __W9825G6KH_WC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of page-sized (512 B) staging lines, placed with W9825G6KH_DTCM_ATTR */
+#ifndef W9825G6KH_WC_LINE_COUNT
+#define W9825G6KH_WC_LINE_COUNT          8
+#endif
+
+#define W9825G6KH_WC_LINE_SIZE           W9825G6KH_PAGE_SIZE_BYTES
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t Writes;             /* W9825G6KH_WC_Write calls */
+    uint32_t BytesStaged;        /* Bytes accepted into staging lines */
+    uint32_t LineHits;           /* Page segments that found an open line */
+    uint32_t LineAllocs;         /* Page segments that opened a new line */
+    uint32_t Evictions;          /* Lines flushed to make room */
+    uint32_t FullFlushes;        /* Lines written back as one 512 B burst */
+    uint32_t PartialFlushes;     /* Lines written back as dirty byte runs */
+} W9825G6KH_WC_StatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void W9825G6KH_WC_Init(void);
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Write(const uint8_t *pBuffer, uint32_t WriteAddr, uint32_t BufferSize);
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t BufferSize);
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Flush(void);
+W9825G6KH_StatusTypeDef W9825G6KH_WC_FlushRange(uint32_t StartAddr, uint32_t Size);
+void W9825G6KH_WC_GetStats(W9825G6KH_WC_StatsTypeDef *stats);
+W9825G6KH_StatusTypeDef W9825G6KH_WC_Benchmark(uint32_t RegionSize, uint32_t NumRecords);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_WC_H */
@@ -0,0 +1,527 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_zero.c
+  * @brief   Zero-on-demand for SDRAM regions
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  * Mark records chunks as "needs zeroing" in a bitmap (one bit per
+  * W9825G6KH_ZERO_CHUNK_BYTES) instead of clearing them; only the partial
+  * chunks at the ends of the range are cleared at once. Step clears pending
+  * chunks from the main loop or an idle task, one chunk per lock hold (or
+  * one DMA2D job per call), so a 32 MB clear is spread over many short
+  * slices. An access hook registered with the driver clears any pending
+  * chunk a checked read, write or fill is about to touch, so data never
+  * shows stale contents. Code that dereferences SDRAM pointers directly
+  * calls Ensure first. Marking and every clear run the other modules' write
+  * hooks, so the read cache drops lines holding the old contents.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh_zero.h"
+#include "w9825g6kh_heap.h"
+#include "w9825g6kh_os.h"
+#include "w9825g6kh_perf.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define ZERO_CHUNKS                  (W9825G6KH_SIZE_BYTES / W9825G6KH_ZERO_CHUNK_BYTES)
+#define ZERO_WORDS                   (ZERO_CHUNKS / 32U)
+#define ZERO_NONE                    0xFFFFFFFFU
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t zero_bitmap[ZERO_WORDS];
+static volatile uint32_t zero_pending = 0;      /* Chunks; read without lock */
+static uint32_t zero_cursor = 0;                /* Bitmap word Step resumes at */
+static W9825G6KH_OS_MutexTypeDef zero_mutex = NULL;
+static W9825G6KH_ZeroStatsTypeDef zero_stats;
+
+#if W9825G6KH_ZERO_USE_DMA2D
+static W9825G6KH_Dma2dJobTypeDef zero_dma_job;
+static uint32_t zero_dma_first = 0;             /* First chunk of the job */
+static uint32_t zero_dma_count = 0;             /* 0: no job in flight */
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void W9825G6KH_Zero_AccessHook(uint32_t Addr, uint32_t Size, uint32_t Access);
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint32_t W9825G6KH_Zero_CheckRange(uint32_t Offset, uint32_t Size)
+{
+    return (Size != 0U && Offset < W9825G6KH_SIZE_BYTES && Size <= W9825G6KH_SIZE_BYTES - Offset) ? 1U : 0U;
+}
+
+static uint32_t W9825G6KH_Zero_TestBit(uint32_t chunk)
+{
+    return (zero_bitmap[chunk >> 5] >> (chunk & 31U)) & 1U;
+}
+
+/* Caller holds zero_mutex */
+static void W9825G6KH_Zero_ClearBit(uint32_t chunk)
+{
+    zero_bitmap[chunk >> 5] &= ~(1UL << (chunk & 31U));
+    zero_pending--;
+}
+
+static void W9825G6KH_Zero_ChunkCpu(uint32_t chunk)
+{
+    uint32_t *p = (uint32_t *)(W9825G6KH_BANK_ADDR + chunk * W9825G6KH_ZERO_CHUNK_BYTES);
+    uint32_t n = W9825G6KH_ZERO_CHUNK_BYTES / 16U;
+
+    while (n--) {
+        p[0] = 0U;
+        p[1] = 0U;
+        p[2] = 0U;
+        p[3] = 0U;
+        p += 4;
+    }
+}
+
+/* Tells the other hooks (read cache, accounting) that chunks were cleared */
+static void W9825G6KH_Zero_NotifyChunks(uint32_t first, uint32_t count)
+{
+    W9825G6KH_NotifyWrite(first * W9825G6KH_ZERO_CHUNK_BYTES, count * W9825G6KH_ZERO_CHUNK_BYTES,
+                          W9825G6KH_Zero_AccessHook);
+}
+
+/* Next pending chunk at or after the cursor, wrapping once; caller holds
+ * zero_mutex */
+static uint32_t W9825G6KH_Zero_FindNext(void)
+{
+    for (uint32_t n = 0; n < ZERO_WORDS; n++) {
+        uint32_t w = zero_cursor;
+        if (zero_bitmap[w] != 0U) {
+            return (w << 5) + (uint32_t)__builtin_ctz(zero_bitmap[w]);
+        }
+        zero_cursor = (w + 1U < ZERO_WORDS) ? w + 1U : 0U;
+    }
+    return ZERO_NONE;
+}
+
+#if W9825G6KH_ZERO_USE_DMA2D
+/**
+  * @brief  Completes the DMA2D job if it has finished (or always, if wait)
+  * @note   Caller holds zero_mutex. If the job failed, or was aborted after
+  *         W9825G6KH_DMA2D_TIMEOUT_US, its chunks are cleared by the CPU.
+  * @retval 1 if no job is in flight on return
+  */
+static uint32_t W9825G6KH_Zero_DmaPoll(uint32_t wait)
+{
+    W9825G6KH_StatusTypeDef status;
+
+    if (zero_dma_count == 0U) {
+        return 1U;
+    }
+
+    status = W9825G6KH_Dma2d_Poll(&zero_dma_job, wait);
+    if (status == W9825G6KH_BUSY) {
+        return 0U;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(W9825G6KH_BANK_ADDR + zero_dma_first * W9825G6KH_ZERO_CHUNK_BYTES),
+                                 (int32_t)(zero_dma_count * W9825G6KH_ZERO_CHUNK_BYTES));
+#endif
+
+    for (uint32_t c = zero_dma_first; c < zero_dma_first + zero_dma_count; c++) {
+        if (status != W9825G6KH_OK) {
+            W9825G6KH_Zero_ChunkCpu(c);
+        }
+        W9825G6KH_Zero_ClearBit(c);
+    }
+    W9825G6KH_Zero_NotifyChunks(zero_dma_first, zero_dma_count);
+    zero_stats.BackgroundBytes += zero_dma_count * W9825G6KH_ZERO_CHUNK_BYTES;
+    zero_dma_count = 0;
+
+    return 1U;
+}
+
+/**
+  * @brief  Starts a register-to-memory job over up to MaxChunks consecutive
+  *         pending chunks beginning at first; caller holds zero_mutex
+  * @retval 1 if started, 0 if another user is programming DMA2D
+  */
+static uint32_t W9825G6KH_Zero_DmaStart(uint32_t first, uint32_t MaxChunks)
+{
+    uint32_t count = 1;
+    uint32_t addr = W9825G6KH_BANK_ADDR + first * W9825G6KH_ZERO_CHUNK_BYTES;
+
+    if (W9825G6KH_Dma2d_Acquire(0U) != W9825G6KH_OK) {
+        return 0U;
+    }
+
+    while (count < MaxChunks && first + count < ZERO_CHUNKS && W9825G6KH_Zero_TestBit(first + count)) {
+        count++;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* Write back dirty lines now so they cannot land on top of the zeros */
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)addr, (int32_t)(count * W9825G6KH_ZERO_CHUNK_BYTES));
+#endif
+
+    /* One line of ARGB8888 pixels per chunk, lines back to back */
+    DMA2D->CR = DMA2D_CR_MODE;
+    DMA2D->OPFCCR = 0U;
+    DMA2D->OCOLR = 0U;
+    DMA2D->OMAR = addr;
+    DMA2D->OOR = 0U;
+    DMA2D->NLR = ((W9825G6KH_ZERO_CHUNK_BYTES / 4U) << DMA2D_NLR_PL_Pos) | count;
+
+    zero_dma_first = first;
+    zero_dma_count = count;
+
+    DMA2D->CR |= DMA2D_CR_START;
+    W9825G6KH_Dma2d_Release(&zero_dma_job);
+
+    return 1U;
+}
+#endif /* W9825G6KH_ZERO_USE_DMA2D */
+
+/**
+  * @brief  Clears every pending chunk in [first, last); caller holds zero_mutex
+  * @retval Chunks cleared by this call
+  */
+static uint32_t W9825G6KH_Zero_ForceRange(uint32_t first, uint32_t last)
+{
+    uint32_t cleared = 0;
+    uint32_t c = first;
+
+    while (c < last) {
+        if (zero_bitmap[c >> 5] == 0U) {
+            c = (c | 31U) + 1U;        /* Skip the whole clean word */
+            continue;
+        }
+        if (W9825G6KH_Zero_TestBit(c)) {
+#if W9825G6KH_ZERO_USE_DMA2D
+            if (zero_dma_count != 0U && c >= zero_dma_first && c < zero_dma_first + zero_dma_count) {
+                (void)W9825G6KH_Zero_DmaPoll(1U);
+                continue;
+            }
+#endif
+            W9825G6KH_Zero_ChunkCpu(c);
+            W9825G6KH_Zero_ClearBit(c);
+            W9825G6KH_Zero_NotifyChunks(c, 1U);
+            cleared++;
+        }
+        c++;
+    }
+
+    return cleared;
+}
+
+/**
+  * @brief  Driver access hook: clears pending chunks before they are touched
+  */
+static void W9825G6KH_Zero_AccessHook(uint32_t Addr, uint32_t Size, uint32_t Access)
+{
+    uint32_t t0;
+    uint32_t cycles;
+    uint32_t cleared;
+
+    UNUSED(Access);
+
+    if (zero_pending == 0U) {
+        return;
+    }
+
+    t0 = W9825G6KH_Perf_GetCycles();
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+    cleared = W9825G6KH_Zero_ForceRange(Addr / W9825G6KH_ZERO_CHUNK_BYTES,
+                                        (Addr + Size - 1U) / W9825G6KH_ZERO_CHUNK_BYTES + 1U);
+    if (cleared != 0U) {
+        cycles = W9825G6KH_Perf_GetCycles() - t0;
+        zero_stats.ForcedBytes += cleared * W9825G6KH_ZERO_CHUNK_BYTES;
+        if (cycles > zero_stats.MaxForcedCycles) {
+            zero_stats.MaxForcedCycles = cycles;
+        }
+    }
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Clears the pending map and hooks the driver's checked accesses
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Init(void)
+{
+    if (zero_mutex == NULL) {
+        zero_mutex = W9825G6KH_OS_MutexCreate();
+        if (zero_mutex == NULL) {
+            return W9825G6KH_ERROR;
+        }
+    }
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+#if W9825G6KH_ZERO_USE_DMA2D
+    (void)W9825G6KH_Zero_DmaPoll(1U);
+#endif
+    memset(zero_bitmap, 0, sizeof(zero_bitmap));
+    memset(&zero_stats, 0, sizeof(zero_stats));
+    zero_pending = 0;
+    zero_cursor = 0;
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+
+    return W9825G6KH_RegisterAccessHook(W9825G6KH_Zero_AccessHook);
+}
+
+/**
+  * @brief  Marks a region as needing zeroing without clearing it now
+  * @note   Chunks wholly inside the region are deferred; the partial chunks
+  *         at either end are cleared immediately
+  * @param  Offset: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Mark(uint32_t Offset, uint32_t Size)
+{
+    uint8_t *base = (uint8_t *)W9825G6KH_BANK_ADDR;
+    uint32_t end = Offset + Size;
+    uint32_t first;
+    uint32_t last;
+
+    if (zero_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    if (!W9825G6KH_Zero_CheckRange(Offset, Size)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    first = (Offset + W9825G6KH_ZERO_CHUNK_BYTES - 1U) / W9825G6KH_ZERO_CHUNK_BYTES;
+    last = end / W9825G6KH_ZERO_CHUNK_BYTES;
+
+    if (first >= last) {
+        memset(base + Offset, 0, Size);
+        W9825G6KH_NotifyWrite(Offset, Size, W9825G6KH_Zero_AccessHook);
+        return W9825G6KH_OK;
+    }
+
+    memset(base + Offset, 0, first * W9825G6KH_ZERO_CHUNK_BYTES - Offset);
+    memset(base + last * W9825G6KH_ZERO_CHUNK_BYTES, 0, end - last * W9825G6KH_ZERO_CHUNK_BYTES);
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+    for (uint32_t c = first; c < last; c++) {
+        if (!W9825G6KH_Zero_TestBit(c)) {
+            zero_bitmap[c >> 5] |= 1UL << (c & 31U);
+            zero_pending++;
+        }
+    }
+    zero_stats.MarkedBytes += (last - first) * W9825G6KH_ZERO_CHUNK_BYTES;
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+
+    /* The region now reads as zero: cached copies of it are stale */
+    W9825G6KH_NotifyWrite(Offset, Size, W9825G6KH_Zero_AccessHook);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Clears any pending chunk overlapping a region now
+  * @note   Required before accessing the region through a raw pointer;
+  *         the driver's checked accesses do this automatically
+  * @param  Offset: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Ensure(uint32_t Offset, uint32_t Size)
+{
+    if (zero_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    if (!W9825G6KH_Zero_CheckRange(Offset, Size)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    W9825G6KH_Zero_AccessHook(Offset, Size, W9825G6KH_ACCESS_READ);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Drops pending chunks wholly inside a region without clearing them
+  * @note   Use when a marked region is released before it was cleared, so
+  *         the background pass cannot zero memory that has been reused
+  * @param  Offset: Region start (offset from SDRAM base)
+  * @param  Size: Region size in bytes
+  * @retval W9825G6KH status
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Cancel(uint32_t Offset, uint32_t Size)
+{
+    uint32_t first;
+    uint32_t last;
+
+    if (zero_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    if (!W9825G6KH_Zero_CheckRange(Offset, Size)) {
+        return W9825G6KH_INVALID_PARAM;
+    }
+
+    first = (Offset + W9825G6KH_ZERO_CHUNK_BYTES - 1U) / W9825G6KH_ZERO_CHUNK_BYTES;
+    last = (Offset + Size) / W9825G6KH_ZERO_CHUNK_BYTES;
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+#if W9825G6KH_ZERO_USE_DMA2D
+    if (zero_dma_count != 0U && first < zero_dma_first + zero_dma_count && zero_dma_first < last) {
+        (void)W9825G6KH_Zero_DmaPoll(1U);
+    }
+#endif
+    for (uint32_t c = first; c < last; c++) {
+        if (W9825G6KH_Zero_TestBit(c)) {
+            W9825G6KH_Zero_ClearBit(c);
+            zero_stats.CancelledBytes += W9825G6KH_ZERO_CHUNK_BYTES;
+        }
+    }
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+
+    return W9825G6KH_OK;
+}
+
+/**
+  * @brief  Clears pending chunks in the background
+  * @note   Call from the main loop or an idle task. The CPU path takes the
+  *         lock once per chunk; the DMA2D path starts or retires one job
+  *         per call and returns without waiting.
+  * @param  MaxBytes: Budget for this call (at least one chunk is cleared)
+  * @retval W9825G6KH_BUSY while chunks remain pending, W9825G6KH_OK when
+  *         none do, W9825G6KH_ERROR if not initialized
+  */
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Step(uint32_t MaxBytes)
+{
+    uint32_t budget = MaxBytes / W9825G6KH_ZERO_CHUNK_BYTES;
+    uint32_t c;
+
+    if (zero_mutex == NULL) {
+        return W9825G6KH_ERROR;
+    }
+    if (budget == 0U) {
+        budget = 1U;
+    }
+
+#if W9825G6KH_ZERO_USE_DMA2D
+    if (budget > W9825G6KH_ZERO_DMA_CHUNKS) {
+        budget = W9825G6KH_ZERO_DMA_CHUNKS;
+    }
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+    if (W9825G6KH_Zero_DmaPoll(0U)) {
+        c = W9825G6KH_Zero_FindNext();
+        if (c != ZERO_NONE && !W9825G6KH_Zero_DmaStart(c, budget)) {
+            /* DMA2D taken by another user: keep making progress */
+            W9825G6KH_Zero_ChunkCpu(c);
+            W9825G6KH_Zero_ClearBit(c);
+            W9825G6KH_Zero_NotifyChunks(c, 1U);
+            zero_stats.BackgroundBytes += W9825G6KH_ZERO_CHUNK_BYTES;
+        }
+    }
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+#else
+    while (budget-- > 0U) {
+        W9825G6KH_OS_MutexLock(zero_mutex);
+        c = W9825G6KH_Zero_FindNext();
+        if (c != ZERO_NONE) {
+            W9825G6KH_Zero_ChunkCpu(c);
+            W9825G6KH_Zero_ClearBit(c);
+            W9825G6KH_Zero_NotifyChunks(c, 1U);
+            zero_stats.BackgroundBytes += W9825G6KH_ZERO_CHUNK_BYTES;
+        }
+        W9825G6KH_OS_MutexUnlock(zero_mutex);
+
+        if (c == ZERO_NONE) {
+            break;
+        }
+    }
+#endif
+
+    return (zero_pending != 0U) ? W9825G6KH_BUSY : W9825G6KH_OK;
+}
+
+/**
+  * @brief  Tells whether any chunk overlapping a region is still pending
+  * @retval 1 if pending, 0 if the region already reads as zero (or was
+  *         never marked)
+  */
+uint32_t W9825G6KH_Zero_IsPending(uint32_t Offset, uint32_t Size)
+{
+    uint32_t last;
+
+    if (zero_pending == 0U || !W9825G6KH_Zero_CheckRange(Offset, Size)) {
+        return 0U;
+    }
+
+    last = (Offset + Size - 1U) / W9825G6KH_ZERO_CHUNK_BYTES;
+    for (uint32_t c = Offset / W9825G6KH_ZERO_CHUNK_BYTES; c <= last; c++) {
+        if (W9825G6KH_Zero_TestBit(c)) {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+  * @brief  Copies the zeroing counters
+  * @param  stats: Destination
+  */
+void W9825G6KH_Zero_GetStats(W9825G6KH_ZeroStatsTypeDef *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    W9825G6KH_OS_MutexLock(zero_mutex);
+    *stats = zero_stats;
+    stats->PendingBytes = zero_pending * W9825G6KH_ZERO_CHUNK_BYTES;
+    W9825G6KH_OS_MutexUnlock(zero_mutex);
+}
+
+/**
+  * @brief  Allocates a zeroed block from the SDRAM heap without clearing it
+  *         up front
+  * @note   Raw pointer access must be preceded by W9825G6KH_Zero_Ensure;
+  *         falls back to an immediate clear if zeroing is not initialized
+  * @retval Pointer, or NULL
+  */
+void* W9825G6KH_Zero_Calloc(size_t count, size_t size)
+{
+    void *ptr;
+    size_t total;
+
+    if (size != 0 && count > (size_t)-1 / size) {
+        return NULL;
+    }
+    total = count * size;
+
+    ptr = W9825G6KH_Heap_Malloc(total, W9825G6KH_HEAP_SDRAM);
+    if (ptr == NULL || total == 0) {
+        return ptr;
+    }
+
+    if (!W9825G6KH_Heap_IsSdram(ptr) ||
+        W9825G6KH_Zero_Mark((uint32_t)((uintptr_t)ptr - W9825G6KH_BANK_ADDR), (uint32_t)total) != W9825G6KH_OK) {
+        memset(ptr, 0, total);
+    }
+    return ptr;
+}
+
+/**
+  * @brief  Frees a block from W9825G6KH_Zero_Calloc
+  * @param  ptr: Block (NULL is ignored)
+  * @param  size: Size passed at allocation (count * size)
+  */
+void W9825G6KH_Zero_Free(void *ptr, size_t size)
+{
+    if (ptr != NULL && size != 0 && W9825G6KH_Heap_IsSdram(ptr)) {
+        (void)W9825G6KH_Zero_Cancel((uint32_t)((uintptr_t)ptr - W9825G6KH_BANK_ADDR), (uint32_t)size);
+    }
+    W9825G6KH_Heap_Free(ptr);
+}
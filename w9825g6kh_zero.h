@@ -0,0 +1,76 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    w9825g6kh_zero.h
+  * @brief   Zero-on-demand for SDRAM regions: background clearing with
+  *          synchronous clearing of a chunk on first access
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Your Company.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#ifndef __W9825G6KH_ZERO_H
+#define __W9825G6KH_ZERO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "w9825g6kh.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Tracking granularity: a power of two, multiple of the 512-byte SDRAM page.
+ * Bounds the synchronous clear on first access to one chunk. */
+#ifndef W9825G6KH_ZERO_CHUNK_BYTES
+#define W9825G6KH_ZERO_CHUNK_BYTES       2048U
+#endif
+
+/* 1: background clearing runs on DMA2D (register-to-memory) instead of the
+ * CPU. DMA2D is taken through W9825G6KH_Dma2d_Acquire like every other
+ * user; a job that fails or overruns W9825G6KH_DMA2D_TIMEOUT_US is redone
+ * by the CPU. */
+#ifndef W9825G6KH_ZERO_USE_DMA2D
+#define W9825G6KH_ZERO_USE_DMA2D         0
+#endif
+
+/* Chunks per DMA2D job */
+#ifndef W9825G6KH_ZERO_DMA_CHUNKS
+#define W9825G6KH_ZERO_DMA_CHUNKS        16U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t PendingBytes;       /* Marked, not cleared yet */
+    uint32_t MarkedBytes;        /* Total deferred by Mark */
+    uint32_t BackgroundBytes;    /* Cleared by Step */
+    uint32_t ForcedBytes;        /* Cleared synchronously on access/Ensure */
+    uint32_t CancelledBytes;     /* Dropped by Cancel before being cleared */
+    uint32_t MaxForcedCycles;    /* Worst single access stall */
+} W9825G6KH_ZeroStatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Init(void);
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Mark(uint32_t Offset, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Ensure(uint32_t Offset, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Cancel(uint32_t Offset, uint32_t Size);
+W9825G6KH_StatusTypeDef W9825G6KH_Zero_Step(uint32_t MaxBytes);
+uint32_t W9825G6KH_Zero_IsPending(uint32_t Offset, uint32_t Size);
+void W9825G6KH_Zero_GetStats(W9825G6KH_ZeroStatsTypeDef *stats);
+
+/* SDRAM heap blocks that read as zero; free with W9825G6KH_Zero_Free */
+void* W9825G6KH_Zero_Calloc(size_t count, size_t size);
+void W9825G6KH_Zero_Free(void *ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W9825G6KH_ZERO_H */